@@ -0,0 +1,166 @@
+/**
+ * @file    benchmark_vector_range.cpp
+ * @brief   Measures how fast vectorRange values are parsed and written.
+ * @author  Frank T. Bergmann
+ * 
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML.  Please visit http://sed-ml.org for more
+ * information about SED-ML, and the latest version of libSEDML.
+ *
+ * Copyright (c) 2013, Frank T. Bergmann  
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met: 
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer. 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sedml/SedTypes.h>
+
+using namespace std;
+LIBSEDML_CPP_NAMESPACE_USE
+
+static double
+secondsSince(const chrono::steady_clock::time_point& start)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static void
+report(const char* what, size_t count, double seconds)
+{
+  cout << "  " << what << ": " << (seconds > 0 ? count / seconds : 0)
+       << " values/s" << endl;
+}
+
+int
+main (int argc, char* argv[])
+{
+  if (argc > 2)
+  {
+    cout << endl << "Usage: benchmark_vector_range [number-of-values]"
+         << endl << endl;
+    return 2;
+  }
+
+  size_t count = argc == 2 ? (size_t)(strtoul(argv[1], NULL, 10)) : 1000000;
+
+  vector<double> values;
+  values.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    values.push_back(1.0 / (i + 1) + i * 0.1);
+  }
+
+  // the text of the values as they appear between <value> tags
+  vector<string> texts;
+  texts.reserve(count);
+  char buffer[32];
+  for (size_t i = 0; i < count; ++i)
+  {
+    SedVectorRange::formatValue(values[i], buffer);
+    texts.push_back(buffer);
+  }
+
+  cout << count << " values" << endl;
+
+  // previous implementation: a stringstream per value in either direction
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  size_t written = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    ostringstream text;
+    text.precision(15);
+    text << values[i];
+    written += text.str().size();
+  }
+  report("format (ostringstream)", count, secondsSince(start));
+
+  start = chrono::steady_clock::now();
+  double sum = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    stringstream text;
+    text << texts[i];
+    double value;
+    text >> value;
+    sum += value;
+  }
+  report("parse (stringstream)", count, secondsSince(start));
+
+  // current implementation
+  start = chrono::steady_clock::now();
+  for (size_t i = 0; i < count; ++i)
+  {
+    written += SedVectorRange::formatValue(values[i], buffer);
+  }
+  report("format (formatValue)", count, secondsSince(start));
+
+  start = chrono::steady_clock::now();
+  for (size_t i = 0; i < count; ++i)
+  {
+    double value;
+    SedVectorRange::parseValue(texts[i].c_str(), value);
+    sum += value;
+  }
+  report("parse (parseValue)", count, secondsSince(start));
+
+  // whole documents, including the XML layer
+  SedDocument doc(1, 4);
+  SedVectorRange* range = doc.createRepeatedTask()->createVectorRange();
+  range->setId("range");
+  range->setValues(std::move(values));
+
+  start = chrono::steady_clock::now();
+  char* xml = writeSedMLToString(&doc);
+  report("write document", count, secondsSince(start));
+
+  start = chrono::steady_clock::now();
+  SedDocument* read = readSedMLFromString(xml);
+  report("read document", count, secondsSince(start));
+
+  unsigned int numRead = 0;
+  if (read->getNumTasks() > 0)
+  {
+    SedRepeatedTask* task = static_cast<SedRepeatedTask*>(read->getTask(0));
+    if (task->getNumRanges() > 0)
+    {
+      numRead = static_cast<SedVectorRange*>(task->getRange(0))->getNumValues();
+    }
+  }
+
+  if (numRead != count || written == 0 || sum == 0)
+  {
+    cout << "read back " << numRead << " values" << endl;
+  }
+
+  delete read;
+  free(xml);
+
+  return 0;
+}
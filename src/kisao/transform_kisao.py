@@ -7,11 +7,60 @@ Created on Mon Jun 21 12:05:03 2021
 
 import csv
 
+# capacities of KisaoTerm, see SedKisao.h
+KISAO_ANCESTOR_WORDS = 2
+KISAO_MAX_ANCESTORS = 8
+
+terms = {}
+parents = {}
+with open('KISAO.csv', newline='') as csvfile:
+    reader = csv.reader(csvfile)
+    for row in reader:
+        if "Class ID" in row:
+            continue
+        k_id = int(row[0].split("_")[-1])
+        terms[k_id] = row[1]
+        parents[k_id] = [int(p.split("_")[-1])
+                         for p in row[7].split("|") if "KISAO_" in p]
+
+ids = sorted(terms)
+index = dict((k_id, n) for n, k_id in enumerate(ids))
+
+# the terms with children get a bit in the ancestor sets of their descendants
+bits = {}
+for k_id in ids:
+    parents[k_id] = [p for p in parents[k_id] if p in terms]
+    for p in parents[k_id]:
+        bits.setdefault(p, None)
+for n, k_id in enumerate(sorted(bits)):
+    bits[k_id] = n
+if len(bits) > 64 * KISAO_ANCESTOR_WORDS:
+    raise ValueError("raise KISAO_ANCESTOR_WORDS to %d" % ((len(bits) + 63) // 64))
+
+# the number of is_a links from each term to each of its ancestors
+def ancestors(k_id):
+    distances = {}
+    current = [k_id]
+    distance = 0
+    while current:
+        distance += 1
+        following = []
+        for term in current:
+            for p in parents[term]:
+                if p not in distances:
+                    distances[p] = distance
+                    following.append(p)
+        current = following
+    return sorted(distances.items(), key=lambda item: (item[1], item[0]))
+
+def quote(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
 kcpp = open("../sedml/kisaomap.cpp", "w")
 kcpp.write("""
 /**
- * \\file    kisao.cpp
- * \\brief   KiSAO map
+ * \\file    kisaomap.cpp
+ * \\brief   KiSAO term table
  * \\author  Lucian Smith
  * 
  * <!--------------------------------------------------------------------------
@@ -48,21 +97,49 @@ kcpp.write("""
  * 
  */
  
-#include <map>
-#include <string>
+#include <sedml/SedKisao.h>
 
-std::map<int, std::string> g_kisaomap = {
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+/** @cond doxygenLibsedmlInternal */
+
+constexpr KisaoTerm kisaoTerms[] = {
 """)
 
-with open('KISAO.csv', newline='') as csvfile:
-    reader = csv.reader(csvfile)
-    for row in reader:
-        if "Class ID" in row:
-            continue
-        k_id = int(row[0].split("_")[-1])
-        k_name = row[1]
-        kcpp.write('   {' + str(k_id) + ', "' + k_name + '"},\n')
-        print(k_id, k_name)
-        
-kcpp.write("};\n")
+for k_id in ids:
+    k_ancestors = ancestors(k_id)
+    if len(k_ancestors) > KISAO_MAX_ANCESTORS:
+        raise ValueError("raise KISAO_MAX_ANCESTORS to %d" % len(k_ancestors))
+    words = [0] * KISAO_ANCESTOR_WORDS
+    for a, distance in k_ancestors:
+        words[bits[a] // 64] |= 1 << (bits[a] % 64)
+    kcpp.write('   {' + str(k_id) + ', ' + quote(terms[k_id]) + ', '
+               + str(bits.get(k_id, -1)) + ',\n    {'
+               + ', '.join('0x%xULL' % w for w in words) + '}, '
+               + str(len(k_ancestors)) + ', {'
+               + ', '.join(str(index[a]) for a, distance in k_ancestors)
+               + '}, {'
+               + ', '.join(str(distance) for a, distance in k_ancestors)
+               + '}},\n')
+
+kcpp.write("""};
+
+constexpr unsigned int kisaoNumTerms = """ + str(len(ids)) + """;
+
+constexpr int kisaoMaxID = """ + str(ids[-1]) + """;
+
+constexpr short kisaoTermIndex[] = {""")
+
+for k_id in range(ids[-1] + 1):
+    if k_id % 16 == 0:
+        kcpp.write("\n  ")
+    kcpp.write(" " + str(index.get(k_id, -1)) + ",")
+
+kcpp.write("""
+};
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_END
+""")
 kcpp.close()
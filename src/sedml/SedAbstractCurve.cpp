@@ -66,7 +66,6 @@ SedAbstractCurve::SedAbstractCurve(unsigned int level, unsigned int version)
   , mXDataReference ("")
   , mElementName("abstractCurve")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mNameAllowedPreV4 = true;
   mIdAllowedPreV4 = true;
 }
@@ -133,6 +132,46 @@ SedAbstractCurve::operator=(const SedAbstractCurve& rhs)
 }
 
 
+/*
+ * Move constructor for SedAbstractCurve.
+ */
+SedAbstractCurve::SedAbstractCurve(SedAbstractCurve&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mLogX ( std::move(orig.mLogX) )
+  , mIsSetLogX ( std::move(orig.mIsSetLogX) )
+  , mOrder ( std::move(orig.mOrder) )
+  , mIsSetOrder ( std::move(orig.mIsSetOrder) )
+  , mStyle ( std::move(orig.mStyle) )
+  , mYAxis ( std::move(orig.mYAxis) )
+  , mXDataReference ( std::move(orig.mXDataReference) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedAbstractCurve.
+ */
+SedAbstractCurve&
+SedAbstractCurve::operator=(SedAbstractCurve&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLogX = std::move(rhs.mLogX);
+    mIsSetLogX = std::move(rhs.mIsSetLogX);
+    mOrder = std::move(rhs.mOrder);
+    mIsSetOrder = std::move(rhs.mIsSetOrder);
+    mStyle = std::move(rhs.mStyle);
+    mYAxis = std::move(rhs.mYAxis);
+    mXDataReference = std::move(rhs.mXDataReference);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAbstractCurve object.
  */
@@ -293,6 +332,7 @@ SedAbstractCurve::setStyle(const std::string& style)
   }
   else
   {
+    sIdRefChanged(mStyle, style);
     mStyle = style;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -322,6 +362,7 @@ SedAbstractCurve::setXDataReference(const std::string& xDataReference)
   }
   else
   {
+    sIdRefChanged(mXDataReference, xDataReference);
     mXDataReference = xDataReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -374,6 +415,7 @@ SedAbstractCurve::unsetOrder()
 int
 SedAbstractCurve::unsetStyle()
 {
+  sIdRefChanged(mStyle, std::string());
   mStyle.erase();
 
   if (mStyle.empty() == true)
@@ -412,6 +454,7 @@ SedAbstractCurve::unsetYAxis()
 int
 SedAbstractCurve::unsetXDataReference()
 {
+  sIdRefChanged(mXDataReference, std::string());
   mXDataReference.erase();
 
   if (mXDataReference.empty() == true)
@@ -466,6 +509,24 @@ SedAbstractCurve::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedAbstractCurve to refs.
+ */
+void
+SedAbstractCurve::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetStyle())
+  {
+    refs.push_back(mStyle);
+  }
+
+  if (isSetXDataReference())
+  {
+    refs.push_back(mXDataReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedAbstractCurve object.
  */
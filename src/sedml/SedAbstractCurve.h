@@ -123,6 +123,27 @@ public:
   SedAbstractCurve& operator=(const SedAbstractCurve& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAbstractCurve.
+   *
+   * @param orig the SedAbstractCurve instance to move from; it is left empty.
+   */
+  SedAbstractCurve(SedAbstractCurve&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAbstractCurve.
+   *
+   * @param rhs the SedAbstractCurve object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAbstractCurve& operator=(SedAbstractCurve&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAbstractCurve object.
    *
@@ -378,6 +399,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedAbstractCurve object.
    *
@@ -62,7 +62,6 @@ SedAbstractTask::SedAbstractTask(unsigned int level, unsigned int version)
 {
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -106,6 +105,32 @@ SedAbstractTask::operator=(const SedAbstractTask& rhs)
 }
 
 
+/*
+ * Move constructor for SedAbstractTask.
+ */
+SedAbstractTask::SedAbstractTask(SedAbstractTask&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedAbstractTask.
+ */
+SedAbstractTask&
+SedAbstractTask::operator=(SedAbstractTask&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAbstractTask object.
  */
@@ -117,6 +117,27 @@ public:
   SedAbstractTask& operator=(const SedAbstractTask& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAbstractTask.
+   *
+   * @param orig the SedAbstractTask instance to move from; it is left empty.
+   */
+  SedAbstractTask(SedAbstractTask&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAbstractTask.
+   *
+   * @param rhs the SedAbstractTask object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAbstractTask& operator=(SedAbstractTask&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAbstractTask object.
    *
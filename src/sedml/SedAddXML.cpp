@@ -54,7 +54,6 @@ SedAddXML::SedAddXML(unsigned int level, unsigned int version)
   : SedChange(level, version)
   , mNewXML (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -113,6 +112,38 @@ SedAddXML::operator=(const SedAddXML& rhs)
 }
 
 
+/*
+ * Move constructor for SedAddXML.
+ */
+SedAddXML::SedAddXML(SedAddXML&& orig) noexcept
+  : SedChange( std::move(orig) )
+  , mNewXML ( orig.mNewXML )
+{
+  orig.mNewXML = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedAddXML.
+ */
+SedAddXML&
+SedAddXML::operator=(SedAddXML&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    delete mNewXML;
+    mNewXML = rhs.mNewXML;
+    rhs.mNewXML = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAddXML object.
  */
@@ -112,6 +112,27 @@ public:
   SedAddXML& operator=(const SedAddXML& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAddXML.
+   *
+   * @param orig the SedAddXML instance to move from; it is left empty.
+   */
+  SedAddXML(SedAddXML&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAddXML.
+   *
+   * @param rhs the SedAddXML object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAddXML& operator=(SedAddXML&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAddXML object.
    *
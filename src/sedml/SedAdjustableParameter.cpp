@@ -62,7 +62,6 @@ SedAdjustableParameter::SedAdjustableParameter(unsigned int level,
   , mModelReference ("")
   , mTarget ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -138,6 +137,48 @@ SedAdjustableParameter::operator=(const SedAdjustableParameter& rhs)
 }
 
 
+/*
+ * Move constructor for SedAdjustableParameter.
+ */
+SedAdjustableParameter::SedAdjustableParameter(SedAdjustableParameter&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mInitialValue ( std::move(orig.mInitialValue) )
+  , mIsSetInitialValue ( std::move(orig.mIsSetInitialValue) )
+  , mBounds ( orig.mBounds )
+  , mExperimentReferences ( std::move(orig.mExperimentReferences) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mTarget ( std::move(orig.mTarget) )
+{
+  orig.mBounds = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedAdjustableParameter.
+ */
+SedAdjustableParameter&
+SedAdjustableParameter::operator=(SedAdjustableParameter&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mInitialValue = std::move(rhs.mInitialValue);
+    mIsSetInitialValue = std::move(rhs.mIsSetInitialValue);
+    delete mBounds;
+    mBounds = rhs.mBounds;
+    rhs.mBounds = NULL;
+    mExperimentReferences = std::move(rhs.mExperimentReferences);
+    mModelReference = std::move(rhs.mModelReference);
+    mTarget = std::move(rhs.mTarget);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAdjustableParameter object.
  */
@@ -249,6 +290,7 @@ SedAdjustableParameter::setModelReference(const std::string& modelReference)
   }
   else
   {
+    sIdRefChanged(mModelReference, modelReference);
     mModelReference = modelReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -294,6 +336,7 @@ SedAdjustableParameter::unsetInitialValue()
 int
 SedAdjustableParameter::unsetModelReference()
 {
+  sIdRefChanged(mModelReference, std::string());
   mModelReference.erase();
 
   if (mModelReference.empty() == true)
@@ -578,6 +621,19 @@ SedAdjustableParameter::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedAdjustableParameter to refs.
+ */
+void
+SedAdjustableParameter::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetModelReference())
+  {
+    refs.push_back(mModelReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedAdjustableParameter object.
  */
@@ -1206,6 +1262,25 @@ SedAdjustableParameter::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedAdjustableParameter
+ */
+void
+SedAdjustableParameter::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mBounds != NULL)
+  {
+    visit(mBounds, data);
+  }
+
+  visit(&mExperimentReferences, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
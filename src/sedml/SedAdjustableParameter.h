@@ -120,6 +120,27 @@ public:
   SedAdjustableParameter& operator=(const SedAdjustableParameter& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAdjustableParameter.
+   *
+   * @param orig the SedAdjustableParameter instance to move from; it is left empty.
+   */
+  SedAdjustableParameter(SedAdjustableParameter&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAdjustableParameter.
+   *
+   * @param rhs the SedAdjustableParameter object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAdjustableParameter& operator=(SedAdjustableParameter&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAdjustableParameter object.
    *
@@ -531,6 +552,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedAdjustableParameter object.
    *
@@ -991,6 +1018,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedAdjustableParameter.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -32,10 +32,9 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedAlgorithm.h>
+#include <sedml/SedKisao.h>
 #include <sbml/xml/XMLInputStream.h>
 
-#include <map>
-
 
 using namespace std;
 
@@ -43,9 +42,6 @@ using namespace std;
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
-extern map<int, string> g_kisaomap;
-
-
 
 #ifdef __cplusplus
 
@@ -59,7 +55,6 @@ SedAlgorithm::SedAlgorithm(unsigned int level, unsigned int version)
   , mKisaoID ("")
   , mAlgorithmParameters (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -107,6 +102,36 @@ SedAlgorithm::operator=(const SedAlgorithm& rhs)
 }
 
 
+/*
+ * Move constructor for SedAlgorithm.
+ */
+SedAlgorithm::SedAlgorithm(SedAlgorithm&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mKisaoID ( std::move(orig.mKisaoID) )
+  , mAlgorithmParameters ( std::move(orig.mAlgorithmParameters) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedAlgorithm.
+ */
+SedAlgorithm&
+SedAlgorithm::operator=(SedAlgorithm&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mKisaoID = std::move(rhs.mKisaoID);
+    mAlgorithmParameters = std::move(rhs.mAlgorithmParameters);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAlgorithm object.
  */
@@ -154,9 +179,9 @@ SedAlgorithm::setKisaoID(const std::string& kisaoID)
 {
   mKisaoID = kisaoID;
   if (!isSetName()) {
-      int knum = getKisaoIDasInt();
-      if (g_kisaomap.find(knum) != g_kisaomap.end()) {
-          setName(g_kisaomap[knum]);
+      const char* name = getKisaoName(getKisaoIDasInt());
+      if (name != NULL) {
+          setName(name);
       }
   }
   return LIBSEDML_OPERATION_SUCCESS;
@@ -817,6 +842,20 @@ SedAlgorithm::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedAlgorithm
+ */
+void
+SedAlgorithm::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mAlgorithmParameters, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -985,12 +1024,34 @@ SedAlgorithm::setKisaoID(int kisaoID)
       << std::setw(7)
       << kisaoID; 
   mKisaoID = str.str();
-  if (!isSetName() && g_kisaomap.find(kisaoID) != g_kisaomap.end()) {
-      setName(g_kisaomap[kisaoID]);
+  const char* name = getKisaoName(kisaoID);
+  if (!isSetName() && name != NULL) {
+      setName(name);
   }
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
+
+/*
+ * Returns true if the KiSAO term of this SedAlgorithm is a kind of the given
+ * one
+ */
+bool
+SedAlgorithm::isKisaoIDKindOf(int kisaoID) const
+{
+  return isKisaoKindOf(getKisaoIDasInt(), kisaoID);
+}
+
+
+/*
+ * Returns the supported KiSAO term closest to the one of this SedAlgorithm
+ */
+int
+SedAlgorithm::getKisaoIDSubstitute(const std::vector<int>& supportedIDs) const
+{
+  return getKisaoSubstitute(getKisaoIDasInt(), supportedIDs);
+}
+
 #endif /* __cplusplus */
 
 
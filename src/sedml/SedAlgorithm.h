@@ -48,6 +48,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <sedml/SedBase.h>
@@ -115,6 +116,27 @@ public:
   SedAlgorithm& operator=(const SedAlgorithm& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAlgorithm.
+   *
+   * @param orig the SedAlgorithm instance to move from; it is left empty.
+   */
+  SedAlgorithm(SedAlgorithm&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAlgorithm.
+   *
+   * @param rhs the SedAlgorithm object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAlgorithm& operator=(SedAlgorithm&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAlgorithm object.
    *
@@ -788,6 +810,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedAlgorithm.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -854,6 +886,22 @@ public:
     */ 
    int setKisaoID(int kisaoID);
 
+   /**
+    * @returns @c true if the KiSAO term of this SedAlgorithm is the term
+    * @p kisaoID or a kind of it, @c false otherwise.
+    *
+    * @see isKisaoKindOf(int kisaoID, int ancestorID)
+    */
+   bool isKisaoIDKindOf(int kisaoID) const;
+
+   /**
+    * @returns the term among @p supportedIDs closest to the KiSAO term of
+    * this SedAlgorithm, or -1 if none of them is related to it.
+    *
+    * @see getKisaoSubstitute(int kisaoID, const std::vector<int>& supportedIDs)
+    */
+   int getKisaoIDSubstitute(const std::vector<int>& supportedIDs) const;
+
 };
 
 
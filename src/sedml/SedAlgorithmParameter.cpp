@@ -33,8 +33,8 @@
  */
 #include <sedml/SedAlgorithmParameter.h>
 #include <sedml/SedListOfAlgorithmParameters.h>
+#include <sedml/SedKisao.h>
 #include <sbml/xml/XMLInputStream.h>
-#include <map>
 
 using namespace std;
 
@@ -42,9 +42,6 @@ using namespace std;
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
-extern map<int, string> g_kisaomap;
-
-
 
 #ifdef __cplusplus
 
@@ -60,7 +57,6 @@ SedAlgorithmParameter::SedAlgorithmParameter(unsigned int level,
   , mValue ("")
   , mAlgorithmParameters (new SedListOfAlgorithmParameters (level, version))
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -126,6 +122,42 @@ SedAlgorithmParameter::operator=(const SedAlgorithmParameter& rhs)
 }
 
 
+/*
+ * Move constructor for SedAlgorithmParameter.
+ */
+SedAlgorithmParameter::SedAlgorithmParameter(SedAlgorithmParameter&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mKisaoID ( std::move(orig.mKisaoID) )
+  , mValue ( std::move(orig.mValue) )
+  , mAlgorithmParameters ( orig.mAlgorithmParameters )
+{
+  orig.mAlgorithmParameters = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedAlgorithmParameter.
+ */
+SedAlgorithmParameter&
+SedAlgorithmParameter::operator=(SedAlgorithmParameter&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mKisaoID = std::move(rhs.mKisaoID);
+    mValue = std::move(rhs.mValue);
+    delete mAlgorithmParameters;
+    mAlgorithmParameters = rhs.mAlgorithmParameters;
+    rhs.mAlgorithmParameters = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAlgorithmParameter object.
  */
@@ -196,9 +228,9 @@ SedAlgorithmParameter::setKisaoID(const std::string& kisaoID)
 {
   mKisaoID = kisaoID;
   if (!isSetName()) {
-      int knum = getKisaoIDasInt();
-      if (g_kisaomap.find(knum) != g_kisaomap.end()) {
-          setName(g_kisaomap[knum]);
+      const char* name = getKisaoName(getKisaoIDasInt());
+      if (name != NULL) {
+          setName(name);
       }
   }
   return LIBSEDML_OPERATION_SUCCESS;
@@ -920,6 +952,23 @@ SedAlgorithmParameter::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedAlgorithmParameter
+ */
+void
+SedAlgorithmParameter::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mAlgorithmParameters != NULL)
+  {
+    visit(mAlgorithmParameters, data);
+  }
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -1135,8 +1184,9 @@ SedAlgorithmParameter::setKisaoID(int kisaoID)
       << std::setw(7)
       << kisaoID; 
   mKisaoID = str.str();
-  if (!isSetName() && g_kisaomap.find(kisaoID) != g_kisaomap.end()) {
-      setName(g_kisaomap[kisaoID]);
+  const char* name = getKisaoName(kisaoID);
+  if (!isSetName() && name != NULL) {
+      setName(name);
   }
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -117,6 +117,27 @@ public:
   SedAlgorithmParameter& operator=(const SedAlgorithmParameter& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAlgorithmParameter.
+   *
+   * @param orig the SedAlgorithmParameter instance to move from; it is left empty.
+   */
+  SedAlgorithmParameter(SedAlgorithmParameter&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAlgorithmParameter.
+   *
+   * @param rhs the SedAlgorithmParameter object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAlgorithmParameter& operator=(SedAlgorithmParameter&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAlgorithmParameter object.
    *
@@ -836,6 +857,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedAlgorithmParameter.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
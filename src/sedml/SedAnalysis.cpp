@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedAnalysis::SedAnalysis(unsigned int level, unsigned int version)
   : SedSimulation(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedAnalysis::operator=(const SedAnalysis& rhs)
 }
 
 
+/*
+ * Move constructor for SedAnalysis.
+ */
+SedAnalysis::SedAnalysis(SedAnalysis&& orig) noexcept
+  : SedSimulation( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedAnalysis.
+ */
+SedAnalysis&
+SedAnalysis::operator=(SedAnalysis&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAnalysis object.
  */
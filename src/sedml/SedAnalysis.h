@@ -106,6 +106,27 @@ public:
   SedAnalysis& operator=(const SedAnalysis& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAnalysis.
+   *
+   * @param orig the SedAnalysis instance to move from; it is left empty.
+   */
+  SedAnalysis(SedAnalysis&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAnalysis.
+   *
+   * @param rhs the SedAnalysis object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAnalysis& operator=(SedAnalysis&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAnalysis object.
    *
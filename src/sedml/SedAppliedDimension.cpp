@@ -58,7 +58,6 @@ SedAppliedDimension::SedAppliedDimension(unsigned int level,
   , mTarget ("")
   , mDimensionTarget ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -103,6 +102,34 @@ SedAppliedDimension::operator=(const SedAppliedDimension& rhs)
 }
 
 
+/*
+ * Move constructor for SedAppliedDimension.
+ */
+SedAppliedDimension::SedAppliedDimension(SedAppliedDimension&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mDimensionTarget ( std::move(orig.mDimensionTarget) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedAppliedDimension.
+ */
+SedAppliedDimension&
+SedAppliedDimension::operator=(SedAppliedDimension&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mTarget = std::move(rhs.mTarget);
+    mDimensionTarget = std::move(rhs.mDimensionTarget);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAppliedDimension object.
  */
@@ -176,6 +203,7 @@ SedAppliedDimension::setTarget(const std::string& target)
   }
   else
   {
+    sIdRefChanged(mTarget, target);
     mTarget = target;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -195,6 +223,7 @@ SedAppliedDimension::setDimensionTarget(const std::string& dimensionTarget)
   }
   else
   {
+    sIdRefChanged(mDimensionTarget, dimensionTarget);
     mDimensionTarget = dimensionTarget;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -207,6 +236,7 @@ SedAppliedDimension::setDimensionTarget(const std::string& dimensionTarget)
 int
 SedAppliedDimension::unsetTarget()
 {
+  sIdRefChanged(mTarget, std::string());
   mTarget.erase();
 
   if (mTarget.empty() == true)
@@ -227,6 +257,7 @@ SedAppliedDimension::unsetTarget()
 int
 SedAppliedDimension::unsetDimensionTarget()
 {
+  sIdRefChanged(mDimensionTarget, std::string());
   mDimensionTarget.erase();
 
   if (mDimensionTarget.empty() == true)
@@ -259,6 +290,24 @@ SedAppliedDimension::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedAppliedDimension to refs.
+ */
+void
+SedAppliedDimension::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetTarget())
+  {
+    refs.push_back(mTarget);
+  }
+
+  if (isSetDimensionTarget())
+  {
+    refs.push_back(mDimensionTarget);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedAppliedDimension object.
  */
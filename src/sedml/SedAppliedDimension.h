@@ -114,6 +114,27 @@ public:
   SedAppliedDimension& operator=(const SedAppliedDimension& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAppliedDimension.
+   *
+   * @param orig the SedAppliedDimension instance to move from; it is left empty.
+   */
+  SedAppliedDimension(SedAppliedDimension&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAppliedDimension.
+   *
+   * @param rhs the SedAppliedDimension object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAppliedDimension& operator=(SedAppliedDimension&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAppliedDimension object.
    *
@@ -223,6 +244,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedAppliedDimension object.
    *
@@ -0,0 +1,300 @@
+/**
+ * @file SedArena.cpp
+ * @brief Implementation of the SedArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedArena.h>
+
+#include <map>
+#include <mutex>
+#include <new>
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+static const size_t SEDARENA_ALIGNMENT = alignof(max_align_t);
+
+
+static SedArena*&
+currentArena()
+{
+  static thread_local SedArena* current = NULL;
+  return current;
+}
+
+
+/*
+ * The blocks of all live arenas, by their start address, so that
+ * SedArena::find() can tell arena memory from heap memory.
+ */
+struct SedArenaBlock
+{
+  const char* end;
+  SedArena*   arena;
+};
+
+typedef map<const char*, SedArenaBlock> SedArenaBlockMap;
+
+
+static SedArenaBlockMap&
+arenaBlocks()
+{
+  static SedArenaBlockMap blocks;
+  return blocks;
+}
+
+
+static mutex&
+arenaBlocksMutex()
+{
+  static mutex blocksMutex;
+  return blocksMutex;
+}
+
+
+/*
+ * The number of entries in arenaBlocks(), so that deleting heap objects
+ * need not lock while no arena is in use.
+ */
+static atomic<size_t> numArenaBlocks(0);
+
+/** @endcond */
+
+
+/*
+ * Creates a new SedArena
+ */
+SedArena::SedArena(size_t blockSize)
+  : mBlocks()
+  , mNext(NULL)
+  , mRemaining(0)
+  , mBlockSize(blockSize < SEDARENA_ALIGNMENT ? SEDARENA_ALIGNMENT : blockSize)
+  , mBytesAllocated(0)
+  , mReferences(1)
+{
+}
+
+
+/*
+ * Destructor for SedArena
+ */
+SedArena::~SedArena()
+{
+  if (!mBlocks.empty())
+  {
+    lock_guard<mutex> lock(arenaBlocksMutex());
+    for (vector<char*>::iterator it = mBlocks.begin(); it != mBlocks.end(); ++it)
+    {
+      numArenaBlocks.fetch_sub(arenaBlocks().erase(*it), memory_order_relaxed);
+    }
+  }
+
+  for (vector<char*>::iterator it = mBlocks.begin(); it != mBlocks.end(); ++it)
+  {
+    ::operator delete(*it);
+  }
+}
+
+
+/*
+ * Returns size bytes of memory from this SedArena
+ */
+void*
+SedArena::allocate(size_t size)
+{
+  size = (size + SEDARENA_ALIGNMENT - 1) & ~(SEDARENA_ALIGNMENT - 1);
+  if (size == 0)
+  {
+    size = SEDARENA_ALIGNMENT;
+  }
+
+  if (size > mBlockSize)
+  {
+    // oversized requests get a block of their own, kept ahead of the
+    // current one so that its free space is not lost
+    char* block = allocateBlock(size, true);
+    mBytesAllocated += size;
+    return block;
+  }
+
+  if (size > mRemaining)
+  {
+    mNext = allocateBlock(mBlockSize, false);
+    mRemaining = mBlockSize;
+  }
+
+  void* result = mNext;
+  mNext += size;
+  mRemaining -= size;
+  mBytesAllocated += size;
+  return result;
+}
+
+
+/*
+ * Requests a block from the heap and records it as part of this SedArena
+ */
+char*
+SedArena::allocateBlock(size_t size, bool oversized)
+{
+  char* block = static_cast<char*>(::operator new(size));
+
+  try
+  {
+    mBlocks.insert(oversized && !mBlocks.empty() ? mBlocks.end() - 1
+                                                 : mBlocks.end(), block);
+  }
+  catch (...)
+  {
+    ::operator delete(block);
+    throw;
+  }
+
+  // a block left out of the map is still freed by the destructor
+  SedArenaBlock entry = { block + size, this };
+  lock_guard<mutex> lock(arenaBlocksMutex());
+  arenaBlocks().insert(make_pair(static_cast<const char*>(block), entry));
+  numArenaBlocks.fetch_add(1, memory_order_release);
+
+  return block;
+}
+
+
+/*
+ * Gives up the reference of the owner of this SedArena
+ */
+void
+SedArena::release()
+{
+  if (mReferences.fetch_sub(1) == 1)
+  {
+    delete this;
+  }
+}
+
+
+/*
+ * Adds a reference to this SedArena
+ */
+void
+SedArena::retain()
+{
+  mReferences.fetch_add(1, memory_order_relaxed);
+}
+
+
+/*
+ * Returns the SedArena whose memory ptr points into
+ */
+SedArena*
+SedArena::find(const void* ptr)
+{
+  // an object placed in an arena on another thread was handed over with
+  // synchronization, which makes the blocks of that arena visible here
+  if (ptr == NULL || numArenaBlocks.load(memory_order_acquire) == 0)
+  {
+    return NULL;
+  }
+
+  const char* address = static_cast<const char*>(ptr);
+
+  lock_guard<mutex> lock(arenaBlocksMutex());
+  SedArenaBlockMap::const_iterator it = arenaBlocks().upper_bound(address);
+  if (it == arenaBlocks().begin())
+  {
+    return NULL;
+  }
+
+  --it;
+  return (address < it->second.end) ? it->second.arena : NULL;
+}
+
+
+/*
+ * Returns the number of bytes handed out by this SedArena
+ */
+size_t
+SedArena::getBytesAllocated() const
+{
+  return mBytesAllocated;
+}
+
+
+/*
+ * Returns the number of blocks of this SedArena
+ */
+unsigned int
+SedArena::getNumBlocks() const
+{
+  return (unsigned int)mBlocks.size();
+}
+
+
+/*
+ * Returns the SedArena current on the calling thread
+ */
+SedArena*
+SedArena::getCurrent()
+{
+  return currentArena();
+}
+
+
+/*
+ * Makes arena current for the lifetime of this Scope
+ */
+SedArena::Scope::Scope(SedArena* arena)
+  : mPrevious(currentArena())
+{
+  currentArena() = arena;
+}
+
+
+/*
+ * Restores the previously current SedArena
+ */
+SedArena::Scope::~Scope()
+{
+  currentArena() = mPrevious;
+}
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
@@ -0,0 +1,230 @@
+/**
+ * @file SedArena.h
+ * @brief Definition of the SedArena class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedArena
+ * @sbmlbrief{} Monotonic allocator holding the elements of a SedDocument.
+ *
+ * A SedArena hands out memory from a small number of large blocks and never
+ * releases individual allocations; all of its memory is returned at once
+ * when the arena is destroyed. A SedDocument with an arena enabled (see
+ * SedDocument::enableArena() and SedReader::setUseArena()) places the
+ * SedBase objects created for it in the arena, so that tearing down the
+ * document does not free its elements one by one.
+ *
+ * Objects derived from SedBase are placed in the arena that is current on
+ * the calling thread when they are created, which is set up with a
+ * SedArena::Scope object.
+ *
+ * Each such object holds a reference to its arena until it is deleted, and
+ * the owner of a heap-allocated arena may give up its own reference with
+ * release() rather than deleting it: the arena then deletes itself once
+ * the last object placed in it is deleted.  Elements removed from a
+ * SedDocument thus stay valid after the document is destroyed.  An arena
+ * that is not released is destroyed by its owner as usual, and must then
+ * outlive all objects placed in it.
+ *
+ * Objects on the heap carry no trace of the arenas: when an object is
+ * deleted, the arena it was placed in, if any, is found from its address.
+ */
+
+
+#ifndef SedArena_H__
+#define SedArena_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedArena
+{
+public:
+
+  /**
+   * Creates a new, empty SedArena that allocates memory in blocks of
+   * @p blockSize bytes.
+   *
+   * @param blockSize the size of the blocks requested from the heap;
+   * allocations larger than this get a block of their own.
+   */
+  SedArena(size_t blockSize = 65536);
+
+
+  /**
+   * Destructor for SedArena; releases all memory handed out by it.
+   */
+  ~SedArena();
+
+
+  /**
+   * Returns @p size bytes of memory, suitably aligned for any type.
+   *
+   * The memory remains valid until this SedArena is destroyed.
+   */
+  void* allocate(size_t size);
+
+
+  /**
+   * Gives up the reference of the owner of this SedArena, which must have
+   * been created with @c new.
+   *
+   * The arena deletes itself at once if no object placed in it is left, and
+   * otherwise when the last of them is deleted.
+   */
+  void release();
+
+
+  /**
+   * Returns the number of bytes handed out by this SedArena.
+   */
+  size_t getBytesAllocated() const;
+
+
+  /**
+   * Returns the number of blocks this SedArena has requested from the heap.
+   */
+  unsigned int getNumBlocks() const;
+
+
+  /**
+   * Returns the SedArena new SedBase objects are placed in on the calling
+   * thread, or @c NULL if they are allocated on the heap.
+   */
+  static SedArena* getCurrent();
+
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Adds a reference to this SedArena, held by an object placed in it.
+   */
+  void retain();
+
+
+  /**
+   * Returns the SedArena whose memory @p ptr points into, or @c NULL if
+   * it points into no live arena.
+   *
+   * This takes no lock while no SedArena has memory allocated.
+   */
+  static SedArena* find(const void* ptr);
+
+
+  /**
+   * Deleter releasing a SedArena, for use with @c std::unique_ptr.
+   */
+  struct Release
+  {
+    void operator()(SedArena* arena) const
+    {
+      arena->release();
+    }
+  };
+  /** @endcond */
+
+
+  /**
+   * Makes a SedArena current on the calling thread for the lifetime of the
+   * Scope object, restoring the previously current one afterwards.
+   */
+  class LIBSEDML_EXTERN Scope
+  {
+  public:
+
+    /**
+     * Makes @p arena the current SedArena; @c NULL selects the heap.
+     */
+    explicit Scope(SedArena* arena);
+
+
+    /**
+     * Restores the SedArena that was current when this Scope was created.
+     */
+    ~Scope();
+
+  private:
+    /** @cond doxygenLibsedmlInternal */
+
+    Scope(const Scope&);
+    Scope& operator=(const Scope&);
+
+    SedArena* mPrevious;
+
+    /** @endcond */
+  };
+
+private:
+  /** @cond doxygenLibsedmlInternal */
+
+  SedArena(const SedArena&);
+  SedArena& operator=(const SedArena&);
+
+  /*
+   * Requests a block of size bytes from the heap and records it as part of
+   * this arena; oversized blocks are kept ahead of the current one.
+   */
+  char* allocateBlock(size_t size, bool oversized);
+
+  std::vector<char*> mBlocks;
+  char*  mNext;
+  size_t mRemaining;
+  size_t mBlockSize;
+  size_t mBytesAllocated;
+
+  // the references of the objects placed in this arena, plus one for its
+  // owner until release() is called
+  std::atomic<size_t> mReferences;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedArena_H__ */
+
+
@@ -64,7 +64,6 @@ SedAxis::SedAxis(unsigned int level, unsigned int version)
   , mStyle ("")
   , mElementName("axis")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -135,6 +134,52 @@ SedAxis::operator=(const SedAxis& rhs)
 }
 
 
+/*
+ * Move constructor for SedAxis.
+ */
+SedAxis::SedAxis(SedAxis&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mType ( std::move(orig.mType) )
+  , mMin ( std::move(orig.mMin) )
+  , mIsSetMin ( std::move(orig.mIsSetMin) )
+  , mMax ( std::move(orig.mMax) )
+  , mIsSetMax ( std::move(orig.mIsSetMax) )
+  , mGrid ( std::move(orig.mGrid) )
+  , mIsSetGrid ( std::move(orig.mIsSetGrid) )
+  , mReverse ( std::move(orig.mReverse) )
+  , mIsSetReverse ( std::move(orig.mIsSetReverse) )
+  , mStyle ( std::move(orig.mStyle) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedAxis.
+ */
+SedAxis&
+SedAxis::operator=(SedAxis&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mType = std::move(rhs.mType);
+    mMin = std::move(rhs.mMin);
+    mIsSetMin = std::move(rhs.mIsSetMin);
+    mMax = std::move(rhs.mMax);
+    mIsSetMax = std::move(rhs.mIsSetMax);
+    mGrid = std::move(rhs.mGrid);
+    mIsSetGrid = std::move(rhs.mIsSetGrid);
+    mReverse = std::move(rhs.mReverse);
+    mIsSetReverse = std::move(rhs.mIsSetReverse);
+    mStyle = std::move(rhs.mStyle);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedAxis object.
  */
@@ -380,6 +425,7 @@ SedAxis::setStyle(const std::string& style)
   }
   else
   {
+    sIdRefChanged(mStyle, style);
     mStyle = style;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -483,6 +529,7 @@ SedAxis::unsetReverse()
 int
 SedAxis::unsetStyle()
 {
+  sIdRefChanged(mStyle, std::string());
   mStyle.erase();
 
   if (mStyle.empty() == true)
@@ -509,6 +556,19 @@ SedAxis::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedAxis to refs.
+ */
+void
+SedAxis::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetStyle())
+  {
+    refs.push_back(mStyle);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedAxis object.
  */
@@ -146,6 +146,27 @@ public:
   SedAxis& operator=(const SedAxis& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedAxis.
+   *
+   * @param orig the SedAxis instance to move from; it is left empty.
+   */
+  SedAxis(SedAxis&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedAxis.
+   *
+   * @param rhs the SedAxis object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedAxis& operator=(SedAxis&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedAxis object.
    *
@@ -449,6 +470,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedAxis object.
    *
@@ -49,6 +49,7 @@
 #include <sedml/SedErrorLog.h>
 #include <sedml/SedDocument.h>
 #include <sedml/SedListOf.h>
+#include <sedml/SedArena.h>
 #include <sedml/SedBase.h>
 
 
@@ -101,6 +102,35 @@ SedBase::getAllElements(SedElementFilter* filter)
   return NULL;
 }
 
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Calls visit on each child of this object, the default has none.
+ */
+void
+SedBase::visitChildren(ChildVisitor visit, void* data)
+{
+}
+/** @endcond */
+
+
+/*
+ * Appends the values of the set SIdRef attributes of this object to refs.
+ */
+void
+SedBase::getSIdRefs(std::vector<std::string>& refs) const
+{
+}
+
+
+/*
+ * @copydoc doc_renamesidref_common
+ */
+void
+SedBase::renameSIdRefs(const std::string& oldid, const std::string& newid)
+{
+}
+
 /** @cond doxygenLibsedmlInternal */
 /*
  * Creates a new SedBase object with the given level and version.
@@ -112,8 +142,8 @@ SedBase::SedBase (unsigned int level, unsigned int version)
  , mName("")
  , mIdAllowedPreV4(false)
  , mNameAllowedPreV4(false)
- , mNotes(NULL)
- , mAnnotation( NULL )
+ , mNotes()
+ , mAnnotation()
  , mSed      ( NULL )
  , mSedNamespaces (NULL)
  , mUserData(NULL)
@@ -123,8 +153,16 @@ SedBase::SedBase (unsigned int level, unsigned int version)
   , mHasBeenDeleted(false)
   , mEmptyString("")
  , mURI("")
+ , mSIdIndexDocument (NULL)
+ , mSIdIndexGeneration (0)
 {
-  mSedNamespaces = new SedNamespaces(level, version);
+  // objects created for a supported Level/Version share one SedNamespaces
+  mSedNamespaces = getDefaultSedNamespaces(level, version);
+
+  if (mSedNamespaces != NULL)
+    retainSedNamespaces(mSedNamespaces);
+  else
+    mSedNamespaces = retainSedNamespaces(new SedNamespaces(level, version));
 
   //
   // Sets the XMLNS URI of corresponding SED-ML Level/Version to
@@ -146,8 +184,8 @@ SedBase::SedBase (SedNamespaces *sedmlns)
  , mName("")
  , mIdAllowedPreV4(false)
  , mNameAllowedPreV4(false)
- , mNotes(NULL)
- , mAnnotation(NULL)
+ , mNotes()
+ , mAnnotation()
  , mSed(NULL)
  , mSedNamespaces(NULL)
  , mUserData(NULL)
@@ -157,13 +195,15 @@ SedBase::SedBase (SedNamespaces *sedmlns)
  , mHasBeenDeleted(false)
  , mEmptyString("")
  , mURI("")
+ , mSIdIndexDocument(NULL)
+ , mSIdIndexGeneration(0)
 {
   if (!sedmlns)
   {
     std::string err("SedBase::SedBase(SedNamespaces*) : SedNamespaces is null");
     throw SedConstructorException(err);
   }
-  mSedNamespaces = sedmlns->clone();
+  shareSedNamespaces(sedmlns);
 
   setElementNamespace(static_cast<SedNamespaces>(*mSedNamespaces).getURI());
 }
@@ -180,8 +220,8 @@ SedBase::SedBase(const SedBase& orig)
   , mName(orig.mName)
   , mIdAllowedPreV4(orig.mIdAllowedPreV4)
   , mNameAllowedPreV4(orig.mNameAllowedPreV4)
-  , mNotes (NULL)
-  , mAnnotation (NULL)
+  , mNotes (orig.mNotes)
+  , mAnnotation (orig.mAnnotation)
   , mSed (NULL)
   , mSedNamespaces(NULL)
   , mUserData(orig.mUserData)
@@ -189,22 +229,44 @@ SedBase::SedBase(const SedBase& orig)
   , mColumn(orig.mColumn)
   , mParentSedObject(NULL)
   , mURI(orig.mURI)
+  , mSIdIndexDocument(NULL)
+  , mSIdIndexGeneration(0)
 {
-  if(orig.mNotes != NULL)
-    this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(orig).getNotes());
-  else
-    this->mNotes = NULL;
+  shareSedNamespaces(orig.getSedNamespaces());
 
-  if(orig.mAnnotation != NULL)
-    this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(orig).mAnnotation);
-  else
-    this->mAnnotation = NULL;
+  this->mHasBeenDeleted = false;
+}
 
-  if(orig.getSedNamespaces() != NULL)
-    this->mSedNamespaces =
-    new SedNamespaces(*const_cast<SedBase&>(orig).getSedNamespaces());
-  else
-    this->mSedNamespaces = NULL;
+
+/*
+ * Move constructor
+ */
+SedBase::SedBase(SedBase&& orig) noexcept
+  : mMetaId (std::move(orig.mMetaId))
+  , mId ()
+  , mName(std::move(orig.mName))
+  , mIdAllowedPreV4(orig.mIdAllowedPreV4)
+  , mNameAllowedPreV4(orig.mNameAllowedPreV4)
+  , mNotes (std::move(orig.mNotes))
+  , mAnnotation (std::move(orig.mAnnotation))
+  , mSed (NULL)
+  , mSedNamespaces(NULL)
+  , mUserData(orig.mUserData)
+  , mLine(orig.mLine)
+  , mColumn(orig.mColumn)
+  , mParentSedObject(NULL)
+  , mURI(std::move(orig.mURI))
+  , mSIdIndexDocument(NULL)
+  , mSIdIndexGeneration(0)
+{
+  // the SId index finds elements by their id, so orig and the children
+  // taken from it have to leave it before their ids are taken
+  orig.removeFromSIdIndex();
+
+  mId = std::move(orig.mId);
+  orig.mId.clear();
+
+  shareSedNamespaces(orig.getSedNamespaces());
 
   this->mHasBeenDeleted = false;
 }
@@ -216,11 +278,81 @@ SedBase::SedBase(const SedBase& orig)
  */
 SedBase::~SedBase ()
 {
-  if (mNotes != NULL)       delete mNotes;
-  if (mAnnotation != NULL)  delete mAnnotation;
-  if (mSedNamespaces != NULL)  delete mSedNamespaces;
+  if (mSIdIndexDocument != NULL)
+    mSIdIndexDocument->removeFromSIdIndex(this, false);
+
+  releaseSedNamespaces(mSedNamespaces);
 }
 
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Allocates memory for a SedBase object
+ */
+void*
+SedBase::operator new(size_t size)
+{
+  SedArena* arena = SedArena::getCurrent();
+  if (arena == NULL)
+  {
+    return ::operator new(size);
+  }
+
+  void* memory = arena->allocate(size);
+  arena->retain();
+  return memory;
+}
+
+
+/*
+ * Releases memory obtained from SedBase::operator new
+ */
+void
+SedBase::operator delete(void* ptr)
+{
+  if (ptr == NULL) return;
+
+  SedArena* arena = SedArena::find(ptr);
+  if (arena == NULL)
+  {
+    ::operator delete(ptr);
+  }
+  else
+  {
+    // the memory itself goes with the arena, possibly right now
+    arena->release();
+  }
+}
+
+
+/*
+ * Allocates memory for a SedBase object, returning NULL on failure
+ */
+void*
+SedBase::operator new(size_t size, const std::nothrow_t&) throw()
+{
+  try
+  {
+    return SedBase::operator new(size);
+  }
+  catch (const std::bad_alloc&)
+  {
+    return NULL;
+  }
+}
+
+
+/*
+ * Releases memory obtained from the non-throwing operator new
+ */
+void
+SedBase::operator delete(void* ptr, const std::nothrow_t&) throw()
+{
+  SedBase::operator delete(ptr);
+}
+/** @endcond */
+
+
 /*
  * Assignment operator
  */
@@ -228,25 +360,71 @@ SedBase& SedBase::operator=(const SedBase& rhs)
 {
   if(&rhs!=this)
   {
+    const std::string oldId = this->mId;
+    SedBase* oldParent = this->mParentSedObject;
+
     this->mMetaId = rhs.mMetaId;
     this->mId = rhs.mId;
     this->mName = rhs.mName;
     this->mIdAllowedPreV4 = rhs.mIdAllowedPreV4;
     this->mNameAllowedPreV4 = rhs.mNameAllowedPreV4;
 
-    delete this->mNotes;
+    this->mNotes = rhs.mNotes;
+    this->mAnnotation = rhs.mAnnotation;
 
-    if(rhs.mNotes != NULL)
-      this->mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(rhs).getNotes());
-    else
-      this->mNotes = NULL;
+    this->mSed       = rhs.mSed;
+    this->mLine       = rhs.mLine;
+    this->mColumn     = rhs.mColumn;
+    this->mParentSedObject = rhs.mParentSedObject;
+    this->mUserData   = rhs.mUserData;
 
-    delete this->mAnnotation;
+    shareSedNamespaces(rhs.mSedNamespaces);
 
-    if(rhs.mAnnotation != NULL)
-      this->mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*const_cast<SedBase&>(rhs).mAnnotation);
-    else
-      this->mAnnotation = NULL;
+
+    this->mURI = rhs.mURI;
+
+    idChanged(oldId, oldParent);
+
+    // the SIdRef attributes are copied by the subclasses afterwards
+    if (mSIdIndexDocument != NULL)
+      mSIdIndexDocument->invalidateSIdRefIndex();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move assignment operator
+ */
+SedBase& SedBase::operator=(SedBase&& rhs) noexcept
+{
+  if(&rhs!=this)
+  {
+    SedBase* oldParent = this->mParentSedObject;
+
+    rhs.removeFromSIdIndex();
+
+    // updating the indexes to the new id could allocate, so they are
+    // rebuilt on their next use instead
+    if (this->mId != rhs.mId)
+    {
+      if (mSIdIndexDocument != NULL)
+        mSIdIndexDocument->invalidateSIdIndex();
+
+      if (oldParent != NULL && oldParent->getTypeCode() == SEDML_LIST_OF)
+        static_cast<SedListOf*>(oldParent)->invalidateItemPositions();
+    }
+
+    this->mMetaId = std::move(rhs.mMetaId);
+    this->mId = std::move(rhs.mId);
+    rhs.mId.clear();
+    this->mName = std::move(rhs.mName);
+    this->mIdAllowedPreV4 = rhs.mIdAllowedPreV4;
+    this->mNameAllowedPreV4 = rhs.mNameAllowedPreV4;
+
+    this->mNotes = std::move(rhs.mNotes);
+    this->mAnnotation = std::move(rhs.mAnnotation);
 
     this->mSed       = rhs.mSed;
     this->mLine       = rhs.mLine;
@@ -254,16 +432,14 @@ SedBase& SedBase::operator=(const SedBase& rhs)
     this->mParentSedObject = rhs.mParentSedObject;
     this->mUserData   = rhs.mUserData;
 
-    delete this->mSedNamespaces;
+    shareSedNamespaces(rhs.mSedNamespaces);
 
-    if(rhs.mSedNamespaces != NULL)
-      this->mSedNamespaces =
-      new SedNamespaces(*const_cast<SedBase&>(rhs).mSedNamespaces);
-    else
-      this->mSedNamespaces = NULL;
 
+    this->mURI = std::move(rhs.mURI);
 
-    this->mURI = rhs.mURI;
+    // the SIdRef attributes are moved by the subclasses afterwards
+    if (mSIdIndexDocument != NULL)
+      mSIdIndexDocument->invalidateSIdRefIndex();
   }
 
   return *this;
@@ -316,14 +492,14 @@ const std::string& SedBase::getName() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getNotes()
 {
-  return mNotes;
+  return unshareNotes();
 }
 
 
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getNotes() const
 {
-  return mNotes;
+  return mNotes.get();
 }
 
 
@@ -333,14 +509,14 @@ SedBase::getNotes() const
 std::string
 SedBase::getNotesString()
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mNotes);
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mNotes.get());
 }
 
 
 std::string
 SedBase::getNotesString() const
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mNotes);
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mNotes.get());
 }
 
 
@@ -350,14 +526,14 @@ SedBase::getNotesString() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getAnnotation ()
 {
-  return mAnnotation;
+  return unshareAnnotation();
 }
 
 
 const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
 SedBase::getAnnotation () const
 {
-  return const_cast<SedBase *>(this)->getAnnotation();
+  return mAnnotation.get();
 }
 
 
@@ -367,7 +543,7 @@ SedBase::getAnnotation () const
 std::string
 SedBase::getAnnotationString ()
 {
-  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(getAnnotation());
+  return LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode::convertXMLNodeToString(mAnnotation.get());
 }
 
 
@@ -455,6 +631,10 @@ SedBase::unsetUserData()
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 SedBase::getNamespaces()
 {
+  // the caller may modify the namespaces
+  SedBase* owner = (mSed != NULL) ? static_cast<SedBase*>(mSed) : this;
+  owner->unshareSedNamespaces();
+
   if (mSed != NULL)
     return mSed->getSedNamespaces()->getNamespaces();
   else
@@ -690,8 +870,7 @@ SedBase::setId (const std::string& sid)
 {
   if (sid.empty())
   {
-    mId.erase();
-    return LIBSEDML_OPERATION_SUCCESS;
+    return unsetId();
   }
   else if (!(SyntaxChecker::isValidXMLID(sid)))
   {
@@ -701,7 +880,10 @@ SedBase::setId (const std::string& sid)
   {
       return LIBSEDML_UNEXPECTED_ATTRIBUTE;
   }
+
+  const std::string oldId = mId;
   mId = sid;
+  idChanged(oldId, mParentSedObject);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -729,15 +911,12 @@ SedBase::setAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annotation)
 {
   if (annotation == NULL)
   {
-    delete mAnnotation;
-    mAnnotation = NULL;
+    mAnnotation.reset();
   }
 
-  if (mAnnotation != annotation)
+  if (mAnnotation.get() != annotation)
   {
-    delete mAnnotation;
-
-    mAnnotation = annotation->clone();
+    mAnnotation.reset(annotation->clone());
   }
 
   return LIBSEDML_OPERATION_SUCCESS;
@@ -812,6 +991,8 @@ SedBase::appendAnnotation (const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* annota
 
   if (mAnnotation != NULL)
   {
+    unshareAnnotation();
+
     // if mAnnotation is just <annotation/> need to tell
     // it to no longer be an end
     if (mAnnotation->isEnd())
@@ -953,12 +1134,11 @@ SedBase::removeTopLevelAnnotationElement(const std::string elementName,
     }
 
     // remove the annotation at the index corresponding to the name
-    delete mAnnotation->removeChild(index);
+    delete unshareAnnotation()->removeChild(index);
 
       if (mAnnotation->getNumChildren() == 0)
         {
-          delete mAnnotation;
-          mAnnotation = NULL;
+          mAnnotation.reset();
         }
 
     // check success
@@ -1038,31 +1218,29 @@ SedBase::replaceTopLevelAnnotationElement(const std::string& annotation)
 int
 SedBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
 {
-  if (mNotes == notes)
+  if (mNotes.get() == notes)
   {
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (notes == NULL)
   {
-    delete mNotes;
-    mNotes = NULL;
+    mNotes.reset();
     return LIBSEDML_OPERATION_SUCCESS;
   }
 
-  delete mNotes;
   const string&  name = notes->getName();
 
   /* check for notes tags and add if necessary */
 
   if (name == "notes")
   {
-    mNotes = static_cast<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*>( notes->clone() );
+    mNotes.reset(static_cast<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*>( notes->clone() ));
   }
   else
   {
     LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken notes_t = LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLTriple("notes", "", ""),
                                 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLAttributes());
-    mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(notes_t);
+    mNotes.reset(new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(notes_t));
 
     // The root node of the given XMLNode tree can be an empty XMLNode
     // (i.e. neither start, end, nor text XMLNode) if the given notes was
@@ -1086,10 +1264,9 @@ SedBase::setNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
     }
   }
 
-    if (!SyntaxChecker::hasExpectedXHTMLSyntax(mNotes, NULL))
+    if (!SyntaxChecker::hasExpectedXHTMLSyntax(mNotes.get(), NULL))
     {
-      delete mNotes;
-      mNotes = NULL;
+      mNotes.reset();
       return LIBSEDML_INVALID_OBJECT;
     }
 
@@ -1338,7 +1515,7 @@ SedBase::appendNotes(const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* notes)
     //------------------------------------------------------------
 
     _NotesType curNotesType   = _ANotesAny;
-    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode&  curNotes = *mNotes;
+    LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode&  curNotes = *unshareNotes();
 
     // curNotes.getChild(0) must be "html", "body", or any XHTML
     // element that would be permitted within a "body" element .
@@ -1568,6 +1745,11 @@ SedBase::connectToParent (SedBase* parent)
          << " " << parent->getSedDocument() << endl;
 #endif
     setSedDocument(mParentSedObject->getSedDocument());
+
+    // if the new parent is already listed in the document's SId index,
+    // this object (and its children) need to be listed as well
+    if (mSed != NULL)
+      mSed->addToSIdIndex(this);
   }
   else
   {
@@ -1589,6 +1771,31 @@ void
 SedBase::connectToChild()
 {
 }
+
+
+/*
+ * Removes this object and all of its children from the SId index of the
+ * SedDocument they are listed in.
+ */
+void
+SedBase::removeFromSIdIndex()
+{
+  if (mSIdIndexDocument != NULL)
+  {
+    mSIdIndexDocument->removeFromSIdIndex(this);
+    return;
+  }
+
+  // lists are not listed themselves, but their items may be
+  if (getTypeCode() == SEDML_LIST_OF)
+  {
+    SedListOf* list = static_cast<SedListOf*>(this);
+    for (unsigned int i = 0; i < list->size(); ++i)
+    {
+      list->get(i)->removeFromSIdIndex();
+    }
+  }
+}
 /** @endcond */
 
 SedBase*
@@ -1657,6 +1864,22 @@ SedBase::setNamespaces(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces* xmlns)
 {
   if (xmlns == NULL)
   {
+    if (mSedNamespaces->getNamespaces() == NULL)
+    {
+      return LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    // reading calls this for every element without xmlns attributes; they
+    // all share the same SedNamespaces rather than each getting a copy
+    SedNamespaces* undeclared = getUndeclaredSedNamespaces(
+      mSedNamespaces->getLevel(), mSedNamespaces->getVersion());
+    if (undeclared != NULL)
+    {
+      shareSedNamespaces(undeclared);
+      return LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    unshareSedNamespaces();
     mSedNamespaces->setNamespaces(NULL);
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -1686,7 +1909,9 @@ SedBase::unsetMetaId ()
 int
 SedBase::unsetId ()
 {
+  const std::string oldId = mId;
   mId.erase();
+  idChanged(oldId, mParentSedObject);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -1703,8 +1928,7 @@ int SedBase::unsetName()
 int
 SedBase::unsetNotes ()
 {
-  delete mNotes;
-  mNotes = NULL;
+  mNotes.reset();
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -1773,7 +1997,10 @@ bool
 SedBase::hasValidLevelVersionNamespaceCombination()
 {
   int typecode = getTypeCode();
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns = getNamespaces();
+
+  // only inspects the namespaces, so there is no need to unshare them
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns =
+    static_cast<const SedBase*>(this)->getNamespaces();
 
   return hasValidLevelVersionNamespaceCombination(typecode, xmlns);
 }
@@ -1871,7 +2098,7 @@ SedBase::matchesCoreSedNamespace(const SedBase * sb) const
 
 
 bool
-SedBase::hasValidLevelVersionNamespaceCombination(int typecode, LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns)
+SedBase::hasValidLevelVersionNamespaceCombination(int typecode, const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns)
 {
 
 
@@ -1921,8 +2148,8 @@ SedBase::setSedNamespaces(SedNamespaces * sedmlns)
   if (sedmlns == NULL)
     return LIBSEDML_INVALID_OBJECT;
 
-  SedNamespaces* sedmlnsClone = (sedmlns) ? sedmlns->clone() : 0;
-  setSedNamespacesAndOwn(sedmlnsClone);
+  shareSedNamespaces(sedmlns);
+  setElementNamespace(mSedNamespaces->getURI());
 
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -1934,14 +2161,152 @@ SedBase::setSedNamespaces(SedNamespaces * sedmlns)
 void
 SedBase::setSedNamespacesAndOwn(SedNamespaces * sedmlns)
 {
-  delete mSedNamespaces;
-  mSedNamespaces = sedmlns;
+  SedNamespaces* old = mSedNamespaces;
+  mSedNamespaces = (sedmlns != NULL) ? retainSedNamespaces(sedmlns) : NULL;
+  releaseSedNamespaces(old);
 
   if(sedmlns != NULL)
     setElementNamespace(sedmlns->getURI());
 }
 
 
+/*
+ * Shares the given SedNamespaces with the other objects referring to it, or
+ * refers to a copy if it is not owned by any object.
+ */
+void
+SedBase::shareSedNamespaces(SedNamespaces * sedmlns)
+{
+  SedNamespaces* old = mSedNamespaces;
+
+  if (sedmlns == NULL)
+    mSedNamespaces = NULL;
+  else if (sedmlns->mRefCount > 0)
+    mSedNamespaces = retainSedNamespaces(sedmlns);
+  else
+    mSedNamespaces = retainSedNamespaces(sedmlns->clone());
+
+  releaseSedNamespaces(old);
+}
+
+
+/*
+ * Gives this object its own copy of a shared SedNamespaces.
+ */
+void
+SedBase::unshareSedNamespaces()
+{
+  if (mSedNamespaces == NULL || mSedNamespaces->mRefCount <= 1)
+    return;
+
+  SedNamespaces* copy = retainSedNamespaces(mSedNamespaces->clone());
+  releaseSedNamespaces(mSedNamespaces);
+  mSedNamespaces = copy;
+}
+
+
+/*
+ * Returns the SedNamespaces shared by all objects created for the given
+ * Level and Version.
+ */
+SedNamespaces*
+SedBase::getDefaultSedNamespaces(unsigned int level, unsigned int version)
+{
+  // created once and never released, so they live as long as any object
+  static SedNamespaces* const defaults[] =
+  {
+    retainSedNamespaces(new SedNamespaces(1, 1)),
+    retainSedNamespaces(new SedNamespaces(1, 2)),
+    retainSedNamespaces(new SedNamespaces(1, 3)),
+    retainSedNamespaces(new SedNamespaces(1, 4))
+  };
+
+  if (level != 1 || version < 1 || version > 4)
+    return NULL;
+
+  return defaults[version - 1];
+}
+
+
+/*
+ * Returns the SedNamespaces without XML namespaces shared by all objects of
+ * the given Level and Version declaring none themselves.
+ */
+SedNamespaces*
+SedBase::getUndeclaredSedNamespaces(unsigned int level, unsigned int version)
+{
+  struct Undeclared
+  {
+    static SedNamespaces* create(unsigned int version)
+    {
+      SedNamespaces* sedmlns = new SedNamespaces(1, version);
+      sedmlns->setNamespaces(NULL);
+      return retainSedNamespaces(sedmlns);
+    }
+  };
+
+  // created once and never released, so they live as long as any object
+  static SedNamespaces* const undeclared[] =
+  {
+    Undeclared::create(1),
+    Undeclared::create(2),
+    Undeclared::create(3),
+    Undeclared::create(4)
+  };
+
+  if (level != 1 || version < 1 || version > 4)
+    return NULL;
+
+  return undeclared[version - 1];
+}
+
+
+/*
+ * Adds a reference to the given SedNamespaces.
+ */
+SedNamespaces*
+SedBase::retainSedNamespaces(SedNamespaces* sedmlns)
+{
+  ++sedmlns->mRefCount;
+  return sedmlns;
+}
+
+
+/*
+ * Drops one reference to the given SedNamespaces.
+ */
+void
+SedBase::releaseSedNamespaces(SedNamespaces* sedmlns)
+{
+  if (sedmlns != NULL && --sedmlns->mRefCount == 0)
+    delete sedmlns;
+}
+
+
+/*
+ * Gives this object its own copy of its notes
+ */
+LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
+SedBase::unshareNotes()
+{
+  if (mNotes.use_count() > 1)
+    mNotes.reset(new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*mNotes));
+  return mNotes.get();
+}
+
+
+/*
+ * Gives this object its own copy of its annotation
+ */
+LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
+SedBase::unshareAnnotation()
+{
+  if (mAnnotation.use_count() > 1)
+    mAnnotation.reset(new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(*mAnnotation));
+  return mAnnotation.get();
+}
+
+
 /* gets the Sednamespaces - internal use only*/
 SedNamespaces *
 SedBase::getSedNamespaces() const
@@ -1951,7 +2316,8 @@ SedBase::getSedNamespaces() const
   
   // initialize SED-ML namespace if need be
   if (mSedNamespaces == NULL)
-    const_cast<SedBase*>(this)->mSedNamespaces = new SedNamespaces(getLevel(), getVersion());
+    const_cast<SedBase*>(this)->mSedNamespaces =
+      retainSedNamespaces(new SedNamespaces(getLevel(), getVersion()));
   return mSedNamespaces;  
 }
 /** @endcond */
@@ -2286,6 +2652,8 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
 
   while ( stream.isGood() )
   {
+    if (mSed != NULL && mSed->isReadingStopped()) break;
+
     // this used to skip the text
     //    stream.skipText();
     // instead, read text and store in variable
@@ -2322,6 +2690,9 @@ SedBase::read (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
 
         if ( !stream.isGood() ) break;
 
+        // when streaming, top-level elements are handed over and deleted
+        if (mSed != NULL && mSed->streamElement(object)) continue;
+
         checkSedListOfPopulated(object);
       }
       else if ( !( readOtherXML(stream)
@@ -2436,8 +2807,7 @@ SedBase::readAnnotation (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
       logError(SedMultipleAnnotations, getLevel(), getVersion(), msg);
     }
 
-    delete mAnnotation;
-    mAnnotation = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
+    mAnnotation.reset(new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream));
     checkAnnotation();
     return true;
   }
@@ -2467,8 +2837,7 @@ SedBase::readNotes (LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
       logError(SedOnlyOneNotesElementAllowed, getLevel(), getVersion());
     }
 
-    delete mNotes;
-    mNotes = new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
+    mNotes.reset(new LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream));
 
     //
     // checks if the given default namespace (if any) is a valid
@@ -2822,6 +3191,43 @@ SedBase::getRootElement()
 }
 
 
+/*
+ * Tells the SId index of the SedDocument and the id table of a parent
+ * SedListOf that the id of this object changed.
+ */
+void
+SedBase::idChanged(const std::string& oldId, SedBase* parent)
+{
+  if (oldId == mId)
+  {
+    return;
+  }
+
+  if (mSIdIndexDocument != NULL)
+  {
+    mSIdIndexDocument->updateSIdIndex(this, oldId);
+  }
+
+  if (parent != NULL && parent->getTypeCode() == SEDML_LIST_OF)
+  {
+    static_cast<SedListOf*>(parent)->updateItemId(this, oldId);
+  }
+}
+
+
+/*
+ * Tells the SedDocument that a SIdRef attribute of this object changes.
+ */
+void
+SedBase::sIdRefChanged(const std::string& oldRef, const std::string& newRef)
+{
+  if (mSIdIndexDocument != NULL && oldRef != newRef)
+  {
+    mSIdIndexDocument->updateSIdRefIndex(this, oldRef, newRef);
+  }
+}
+
+
 /*
  * Subclasses should override this method to write their XML attributes
  * to the XMLOutputStream.  Be sure to call your parents implementation
@@ -57,7 +57,10 @@
 
 
 #include <string>
+#include <vector>
+#include <memory>
 #include <stdexcept>
+#include <new>
 #include <algorithm>
 
 #include <sedml/SedErrorLog.h>
@@ -101,6 +104,53 @@ public:
   SedBase& operator=(const SedBase& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move assignment operator for SedBase.
+   *
+   * @param rhs The object whose values are moved into this one; it is left
+   * without id, name, notes or annotation.
+   */
+  SedBase& operator=(SedBase&& rhs) noexcept;
+
+
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Allocates memory for a SedBase object, placing it in the current
+   * SedArena (see SedArena::Scope) if there is one, and on the heap
+   * otherwise.  Heap objects get exactly what @c ::operator new returns.
+   */
+  static void* operator new(size_t size);
+
+
+  /**
+   * Releases memory obtained from SedBase::operator new().
+   *
+   * Memory placed in a SedArena is only returned when the arena itself is
+   * destroyed, but the object gives up its reference to the arena (see
+   * SedArena::release()).  The arena is looked up by address with
+   * SedArena::find().
+   */
+  static void operator delete(void* ptr);
+
+
+  /**
+   * Non-throwing variant of SedBase::operator new(), returning @c NULL
+   * when out of memory.
+   */
+  static void* operator new(size_t size, const std::nothrow_t&) throw();
+
+
+  /**
+   * Releases memory obtained from the non-throwing SedBase::operator new().
+   */
+  static void operator delete(void* ptr, const std::nothrow_t&) throw();
+  /** @endcond */
+
+#endif /* !SWIG */
+
+
   /** @cond doxygenLibsedmlInternal */
   /**
    * Accepts the given SedVisitor for this SedBase object.
@@ -176,6 +226,48 @@ public:
   virtual List* getAllElements(SedElementFilter* filter = NULL);
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * The function called by visitChildren() for each child, with the
+   * @p data passed to visitChildren().
+   */
+  typedef void (*ChildVisitor)(SedBase* child, void* data);
+
+
+  /**
+   * Calls @p visit on each child of this object, that is on each SedListOf
+   * and each single element it contains directly.
+   *
+   * Unlike getAllElements() this allocates nothing, so that it can be used
+   * while moving objects.  The default implementation does nothing.
+   *
+   * @param visit the function to call for each child.
+   * @param data passed on to @p visit.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+  /** @endcond */
+
+
+  /**
+   * Appends the values of all set SIdRef attributes of this object (such
+   * as "taskReference" or "style") to @p refs.
+   *
+   * Identifiers used inside MathML are not included.
+   *
+   * @param refs the vector the referenced identifiers are appended to.
+   *
+   * @see SedDocument::getReferencingElements(const std::string& id)
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
+  /**
+   * @copydoc doc_renamesidref_common
+   */
+  virtual void renameSIdRefs(const std::string& oldid,
+                             const std::string& newid);
+
+
   /**
    * Returns the value of the "metaid" attribute of this object.
    *
@@ -1292,6 +1384,19 @@ public:
    */
   virtual void connectToChild ();
 
+
+  /**
+   * Removes this SED-ML object and all of its children from the SId index
+   * of the SedDocument they are currently listed in (if any).
+   *
+   * This function is called when an object is detached from its parent
+   * (e.g. by SedListOf::remove()) without being deleted, or when its
+   * contents are moved to another object.
+   *
+   * @see SedDocument::getElementBySId()
+   */
+  void removeFromSIdIndex ();
+
   /** @endcond */
 
 
@@ -1677,6 +1782,14 @@ public:
 
   /* sets the SedNamaepaces and owns the given object - internal use only */
   void setSedNamespacesAndOwn(SedNamespaces * disownedNs);
+
+  /* shares the given SedNamespaces with the other objects referring to it,
+   * or refers to a copy if it is not owned by any object - internal use only */
+  void shareSedNamespaces(SedNamespaces * sedmlns);
+
+  /* gives this object its own copy of a shared SedNamespaces, needs to be
+   * called before the SedNamespaces is modified - internal use only */
+  void unshareSedNamespaces();
   /** @endcond */
 
 
@@ -1852,6 +1965,19 @@ protected:
   SedBase(const SedBase& orig);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor. Takes over the values of another SedBase object,
+   * which is left without id, name, notes or annotation.
+   *
+   * @param orig the object to move from.
+   */
+  SedBase(SedBase&& orig) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Subclasses should override this method to create, store, and then
    * return an SED-ML object corresponding to the next XMLToken in the
@@ -1877,7 +2003,7 @@ protected:
    * @return @c true if the level, version and namespace values of this 
    * SED-ML object correspond to a valid set of values, @c false otherwise.
    */
-  bool hasValidLevelVersionNamespaceCombination(int typecode, LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns);
+  bool hasValidLevelVersionNamespaceCombination(int typecode, const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *xmlns);
 
 
   /**
@@ -2068,6 +2194,70 @@ protected:
   SedBase* getRootElement();
 
 
+  /**
+   * Tells the lookup tables this object may be listed in (the SId index of
+   * its SedDocument and the id table of a parent SedListOf) that its "id"
+   * changed from @p oldId.
+   *
+   * @param oldId the previous value of the "id" attribute.
+   * @param parent the parent the object had when the id was changed.
+   */
+  void idChanged(const std::string& oldId, SedBase* parent);
+
+
+  /**
+   * Tells the SedDocument this object is listed in that one of its SIdRef
+   * attributes is about to change from @p oldRef to @p newRef.
+   *
+   * Setters of SIdRef attributes call this before storing the new value.
+   */
+  void sIdRefChanged(const std::string& oldRef, const std::string& newRef);
+
+
+  /**
+   * Returns the SedNamespaces shared by all objects created for the given
+   * SED-ML @p level and @p version, or @c NULL if there is none.
+   */
+  static SedNamespaces* getDefaultSedNamespaces(unsigned int level,
+                                                unsigned int version);
+
+
+  /**
+   * Returns the SedNamespaces without any XML namespaces shared by all
+   * objects of the given SED-ML @p level and @p version that declare none
+   * themselves, as most elements read from a document, or @c NULL if there
+   * is none.
+   */
+  static SedNamespaces* getUndeclaredSedNamespaces(unsigned int level,
+                                                   unsigned int version);
+
+
+  /**
+   * Adds a reference to @p sedmlns and returns it.
+   */
+  static SedNamespaces* retainSedNamespaces(SedNamespaces* sedmlns);
+
+
+  /**
+   * Drops one reference to @p sedmlns, deleting it with the last one.
+   */
+  static void releaseSedNamespaces(SedNamespaces* sedmlns);
+
+
+  /**
+   * Gives this object its own copy of its notes, if they are shared with
+   * another object, and returns them.
+   */
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* unshareNotes();
+
+
+  /**
+   * Gives this object its own copy of its annotation, if it is shared with
+   * another object, and returns it.
+   */
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* unshareAnnotation();
+
+
   // ------------------------------------------------------------------
 
 
@@ -2076,8 +2266,9 @@ protected:
   std::string     mName;
   bool            mIdAllowedPreV4;
   bool            mNameAllowedPreV4;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mNotes;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*        mAnnotation;
+  // notes and annotation are shared between copies until either is modified
+  std::shared_ptr<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode> mNotes;
+  std::shared_ptr<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode> mAnnotation;
   SedDocument*   mSed;
   SedNamespaces* mSedNamespaces;
   void*          mUserData;
@@ -2109,6 +2300,16 @@ protected:
   //
   std::string mURI;
 
+  //
+  // the SedDocument whose SId index currently lists this object, and the
+  // generation of that index at the time this object was added to it.
+  // Both are maintained by SedDocument only (see SedDocument::getElementBySId).
+  //
+  SedDocument*  mSIdIndexDocument;
+  unsigned int  mSIdIndexGeneration;
+
+  friend class SedDocument;
+
   
   /** @endcond */
 
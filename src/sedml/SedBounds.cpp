@@ -58,7 +58,6 @@ SedBounds::SedBounds(unsigned int level, unsigned int version)
   , mIsSetUpperBound (false)
   , mScale (SEDML_SCALETYPE_INVALID)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -111,6 +110,40 @@ SedBounds::operator=(const SedBounds& rhs)
 }
 
 
+/*
+ * Move constructor for SedBounds.
+ */
+SedBounds::SedBounds(SedBounds&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mLowerBound ( std::move(orig.mLowerBound) )
+  , mIsSetLowerBound ( std::move(orig.mIsSetLowerBound) )
+  , mUpperBound ( std::move(orig.mUpperBound) )
+  , mIsSetUpperBound ( std::move(orig.mIsSetUpperBound) )
+  , mScale ( std::move(orig.mScale) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedBounds.
+ */
+SedBounds&
+SedBounds::operator=(SedBounds&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLowerBound = std::move(rhs.mLowerBound);
+    mIsSetLowerBound = std::move(rhs.mIsSetLowerBound);
+    mUpperBound = std::move(rhs.mUpperBound);
+    mIsSetUpperBound = std::move(rhs.mIsSetUpperBound);
+    mScale = std::move(rhs.mScale);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedBounds object.
  */
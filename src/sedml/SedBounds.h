@@ -143,6 +143,27 @@ public:
   SedBounds& operator=(const SedBounds& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedBounds.
+   *
+   * @param orig the SedBounds instance to move from; it is left empty.
+   */
+  SedBounds(SedBounds&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedBounds.
+   *
+   * @param rhs the SedBounds object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedBounds& operator=(SedBounds&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedBounds object.
    *
@@ -62,7 +62,6 @@ SedChange::SedChange(unsigned int level, unsigned int version)
   , mTarget ("")
   , mElementName("change")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -106,6 +105,34 @@ SedChange::operator=(const SedChange& rhs)
 }
 
 
+/*
+ * Move constructor for SedChange.
+ */
+SedChange::SedChange(SedChange&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedChange.
+ */
+SedChange&
+SedChange::operator=(SedChange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mTarget = std::move(rhs.mTarget);
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedChange object.
  */
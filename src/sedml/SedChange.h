@@ -118,6 +118,27 @@ public:
   SedChange& operator=(const SedChange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedChange.
+   *
+   * @param orig the SedChange instance to move from; it is left empty.
+   */
+  SedChange(SedChange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedChange.
+   *
+   * @param rhs the SedChange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedChange& operator=(SedChange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedChange object.
    *
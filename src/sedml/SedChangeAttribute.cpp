@@ -56,7 +56,6 @@ SedChangeAttribute::SedChangeAttribute(unsigned int level,
   : SedChange(level, version)
   , mNewValue ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -98,6 +97,32 @@ SedChangeAttribute::operator=(const SedChangeAttribute& rhs)
 }
 
 
+/*
+ * Move constructor for SedChangeAttribute.
+ */
+SedChangeAttribute::SedChangeAttribute(SedChangeAttribute&& orig) noexcept
+  : SedChange( std::move(orig) )
+  , mNewValue ( std::move(orig.mNewValue) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedChangeAttribute.
+ */
+SedChangeAttribute&
+SedChangeAttribute::operator=(SedChangeAttribute&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    mNewValue = std::move(rhs.mNewValue);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedChangeAttribute object.
  */
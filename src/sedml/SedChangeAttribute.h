@@ -113,6 +113,27 @@ public:
   SedChangeAttribute& operator=(const SedChangeAttribute& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedChangeAttribute.
+   *
+   * @param orig the SedChangeAttribute instance to move from; it is left empty.
+   */
+  SedChangeAttribute(SedChangeAttribute&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedChangeAttribute.
+   *
+   * @param rhs the SedChangeAttribute object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedChangeAttribute& operator=(SedChangeAttribute&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedChangeAttribute object.
    *
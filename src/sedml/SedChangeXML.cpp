@@ -55,7 +55,6 @@ SedChangeXML::SedChangeXML(unsigned int level, unsigned int version)
   : SedChange(level, version)
   , mNewXML (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -114,6 +113,38 @@ SedChangeXML::operator=(const SedChangeXML& rhs)
 }
 
 
+/*
+ * Move constructor for SedChangeXML.
+ */
+SedChangeXML::SedChangeXML(SedChangeXML&& orig) noexcept
+  : SedChange( std::move(orig) )
+  , mNewXML ( orig.mNewXML )
+{
+  orig.mNewXML = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedChangeXML.
+ */
+SedChangeXML&
+SedChangeXML::operator=(SedChangeXML&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    delete mNewXML;
+    mNewXML = rhs.mNewXML;
+    rhs.mNewXML = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedChangeXML object.
  */
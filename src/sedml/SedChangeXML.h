@@ -114,6 +114,27 @@ public:
   SedChangeXML& operator=(const SedChangeXML& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedChangeXML.
+   *
+   * @param orig the SedChangeXML instance to move from; it is left empty.
+   */
+  SedChangeXML(SedChangeXML&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedChangeXML.
+   *
+   * @param rhs the SedChangeXML object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedChangeXML& operator=(SedChangeXML&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedChangeXML object.
    *
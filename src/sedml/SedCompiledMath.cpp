@@ -0,0 +1,989 @@
+/**
+ * @file SedCompiledMath.cpp
+ * @brief Implementation of the SedCompiledMath class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedCompiledMath.h>
+#include <sedml/SedFunctionalRange.h>
+#include <sedml/SedSetValue.h>
+#include <sedml/SedComputeChange.h>
+#include <sedml/SedDataGenerator.h>
+#include <sedml/common/SedOperationReturnValues.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/*
+ * Creates a new SedCompiledMath.
+ */
+SedCompiledMath::SedCompiledMath()
+  : mCode ()
+  , mConstants ()
+  , mAggregates ()
+  , mSlotNames ()
+  , mMaxDepth (0)
+  , mCompiled (false)
+{
+}
+
+
+/*
+ * Compiles the given math.
+ */
+int
+SedCompiledMath::compile(const ASTNode* math,
+                         const std::vector<std::string>& slotNames,
+                         const SedListOfParameters* parameters)
+{
+  mCode.clear();
+  mConstants.clear();
+  mAggregates.clear();
+  mSlotNames = slotNames;
+  mMaxDepth = 0;
+  mCompiled = false;
+
+  if (math == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  int result = emit(math, parameters, 0);
+  if (result != LIBSEDML_OPERATION_SUCCESS)
+  {
+    mCode.clear();
+    mConstants.clear();
+  mAggregates.clear();
+    return result;
+  }
+
+  mCompiled = true;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Compiles the given math with the given variables bound to the first slots.
+ */
+int
+SedCompiledMath::compile(const ASTNode* math,
+                         const SedListOfVariables* variables,
+                         const SedListOfParameters* parameters,
+                         const std::vector<std::string>& names)
+{
+  std::vector<std::string> slotNames;
+  unsigned int numVariables = (variables != NULL) ? variables->size() : 0;
+  slotNames.reserve(numVariables + names.size());
+
+  for (unsigned int i = 0; i < numVariables; ++i)
+  {
+    slotNames.push_back(variables->get(i)->getId());
+  }
+  slotNames.insert(slotNames.end(), names.begin(), names.end());
+
+  return compile(math, slotNames, parameters);
+}
+
+
+/*
+ * Compiles the math of the given SedFunctionalRange.
+ */
+int
+SedCompiledMath::compile(const SedFunctionalRange& range,
+                         const std::vector<std::string>& names)
+{
+  return compile(range.getMath(), range.getListOfVariables(),
+                 range.getListOfParameters(), names);
+}
+
+
+/*
+ * Compiles the math of the given SedSetValue.
+ */
+int
+SedCompiledMath::compile(const SedSetValue& setValue,
+                         const std::vector<std::string>& names)
+{
+  return compile(setValue.getMath(), setValue.getListOfVariables(),
+                 setValue.getListOfParameters(), names);
+}
+
+
+/*
+ * Compiles the math of the given SedComputeChange.
+ */
+int
+SedCompiledMath::compile(const SedComputeChange& change,
+                         const std::vector<std::string>& names)
+{
+  return compile(change.getMath(), change.getListOfVariables(),
+                 change.getListOfParameters(), names);
+}
+
+
+/*
+ * Compiles the math of the given SedDataGenerator.
+ */
+int
+SedCompiledMath::compile(const SedDataGenerator& dataGenerator)
+{
+  return compile(dataGenerator.getMath(), dataGenerator.getListOfVariables(),
+                 dataGenerator.getListOfParameters(),
+                 std::vector<std::string>());
+}
+
+
+/*
+ * Returns true if math has been compiled successfully.
+ */
+bool
+SedCompiledMath::isCompiled() const
+{
+  return mCompiled;
+}
+
+
+/*
+ * Returns the number of slots of the compiled math.
+ */
+unsigned int
+SedCompiledMath::getNumSlots() const
+{
+  return (unsigned int)(mSlotNames.size());
+}
+
+
+/*
+ * Returns the slot bound to the given name.
+ */
+int
+SedCompiledMath::getSlot(const std::string& name) const
+{
+  std::vector<std::string>::const_iterator it =
+    find(mSlotNames.begin(), mSlotNames.end(), name);
+
+  return (it != mSlotNames.end()) ? (int)(it - mSlotNames.begin()) : -1;
+}
+
+
+/*
+ * Evaluates the compiled math.
+ */
+double
+SedCompiledMath::evaluate(const double* slots) const
+{
+  if (!mCompiled)
+  {
+    return numeric_limits<double>::quiet_NaN();
+  }
+
+  return run(mCode, slots);
+}
+
+
+/*
+ * Evaluates the compiled math for many rows at once.
+ */
+void
+SedCompiledMath::evaluate(const double* const* slotColumns, size_t numRows,
+                          double* results) const
+{
+  if (!mCompiled)
+  {
+    fill(results, results + numRows, numeric_limits<double>::quiet_NaN());
+    return;
+  }
+
+  // aggregates come before those containing them, and reduce the rows in
+  // one lane per row of a block, so that the loops vectorize as well
+  std::vector<double> aggregates(mAggregates.size());
+  double block[BLOCK_SIZE];
+  double lanes[BLOCK_SIZE];
+
+  for (size_t n = 0; n < mAggregates.size(); ++n)
+  {
+    const Opcode op = mAggregates[n].op;
+    fill(lanes, lanes + BLOCK_SIZE,
+         (op == OP_MIN) ? numeric_limits<double>::infinity() :
+         (op == OP_MAX) ? -numeric_limits<double>::infinity() : 0.0);
+
+    for (size_t first = 0; first < numRows; first += BLOCK_SIZE)
+    {
+      const size_t count = min<size_t>(BLOCK_SIZE, numRows - first);
+      runBlock(mAggregates[n].code, slotColumns, first, count,
+               aggregates.data(), block);
+
+      switch (op)
+      {
+      case OP_MIN:
+        // NaN sticks once it reaches a lane
+        for (size_t i = 0; i < count; ++i)
+        {
+          lanes[i] = (block[i] < lanes[i] || block[i] != block[i])
+                     ? block[i] : lanes[i];
+        }
+        break;
+
+      case OP_MAX:
+        for (size_t i = 0; i < count; ++i)
+        {
+          lanes[i] = (block[i] > lanes[i] || block[i] != block[i])
+                     ? block[i] : lanes[i];
+        }
+        break;
+
+      default:
+        for (size_t i = 0; i < count; ++i) lanes[i] += block[i];
+        break;
+      }
+    }
+
+    double value = (numRows == 0 && op != OP_SUM)
+                   ? numeric_limits<double>::quiet_NaN() : lanes[0];
+    for (size_t i = 1; i < BLOCK_SIZE && i < numRows; ++i)
+    {
+      const double lane = lanes[i];
+      value = (op == OP_MIN) ? ((lane < value || lane != lane) ? lane : value)
+            : (op == OP_MAX) ? ((lane > value || lane != lane) ? lane : value)
+            : value + lane;
+    }
+    aggregates[n] = (op == OP_MEAN) ? value / numRows : value;
+  }
+
+  for (size_t first = 0; first < numRows; first += BLOCK_SIZE)
+  {
+    const size_t count = min<size_t>(BLOCK_SIZE, numRows - first);
+    runBlock(mCode, slotColumns, first, count, aggregates.data(),
+             results + first);
+  }
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Appends an instruction.
+ */
+void
+SedCompiledMath::emitOp(Opcode op, unsigned int operand)
+{
+  Instruction instruction = { op, operand };
+  mCode.push_back(instruction);
+}
+
+
+/*
+ * Appends an instruction pushing the given value.
+ */
+void
+SedCompiledMath::emitConst(double value)
+{
+  emitOp(OP_CONST, (unsigned int)(mConstants.size()));
+  mConstants.push_back(value);
+}
+
+
+/*
+ * Appends the instructions computing the given math; depth is the number of
+ * values on the stack before they run.
+ */
+int
+SedCompiledMath::emit(const ASTNode* node,
+                      const SedListOfParameters* parameters,
+                      unsigned int depth)
+{
+  if (node == NULL)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  if (depth >= MAX_DEPTH)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  mMaxDepth = max(mMaxDepth, depth + 1);
+
+  const unsigned int numChildren = node->getNumChildren();
+  const int type = node->getType();
+  Opcode op = OP_CONST;
+  int result = LIBSEDML_OPERATION_SUCCESS;
+
+  switch (type)
+  {
+  case AST_INTEGER:
+  case AST_REAL:
+  case AST_REAL_E:
+  case AST_RATIONAL:
+    emitConst(node->getValue());
+    return LIBSEDML_OPERATION_SUCCESS;
+
+  case AST_CONSTANT_E:
+    emitConst(2.71828182845904523536);
+    return LIBSEDML_OPERATION_SUCCESS;
+
+  case AST_CONSTANT_PI:
+    emitConst(3.14159265358979323846);
+    return LIBSEDML_OPERATION_SUCCESS;
+
+  case AST_CONSTANT_TRUE:
+    emitConst(1.0);
+    return LIBSEDML_OPERATION_SUCCESS;
+
+  case AST_CONSTANT_FALSE:
+    emitConst(0.0);
+    return LIBSEDML_OPERATION_SUCCESS;
+
+  case AST_NAME:
+  {
+    if (node->getName() == NULL)
+    {
+      return LIBSEDML_INVALID_OBJECT;
+    }
+
+    const std::string name = node->getName();
+    const SedParameter* parameter =
+      (parameters != NULL) ? parameters->get(name) : NULL;
+    if (parameter != NULL)
+    {
+      emitConst(parameter->getValue());
+      return LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    int slot = getSlot(name);
+    if (slot < 0)
+    {
+      return LIBSEDML_INVALID_OBJECT;
+    }
+
+    emitOp(OP_SLOT, (unsigned int)slot);
+    return LIBSEDML_OPERATION_SUCCESS;
+  }
+
+  case AST_FUNCTION_PIECEWISE:
+    return emitPiecewise(node, 0, parameters, depth);
+
+  // n-ary operators fold their arguments onto the neutral element
+  case AST_PLUS:
+  case AST_TIMES:
+  case AST_LOGICAL_AND:
+  case AST_LOGICAL_OR:
+  case AST_LOGICAL_XOR:
+  {
+    op = (type == AST_PLUS) ? OP_ADD : (type == AST_TIMES) ? OP_MUL :
+         (type == AST_LOGICAL_AND) ? OP_AND :
+         (type == AST_LOGICAL_OR) ? OP_OR : OP_XOR;
+
+    unsigned int i = 0;
+    if (numChildren == 0 || op == OP_AND || op == OP_OR || op == OP_XOR)
+    {
+      // logical operators turn a single argument into a boolean as well
+      emitConst((op == OP_MUL || op == OP_AND) ? 1.0 : 0.0);
+    }
+    else
+    {
+      result = emit(node->getChild(i++), parameters, depth);
+    }
+
+    for (; i < numChildren && result == LIBSEDML_OPERATION_SUCCESS; ++i)
+    {
+      result = emit(node->getChild(i), parameters, depth + 1);
+      emitOp(op);
+    }
+    return result;
+  }
+
+  // the aggregate functions of SED-ML take a single argument, and are
+  // parsed as calls to user functions unless they coincide with builtins
+  case AST_FUNCTION:
+  {
+    const std::string name =
+      (node->getName() != NULL) ? node->getName() : "";
+    op = (name == "min") ? OP_MIN : (name == "max") ? OP_MAX :
+         (name == "sum") ? OP_SUM : (name == "mean") ? OP_MEAN : OP_CONST;
+    if (op == OP_CONST || numChildren != 1)
+    {
+      return LIBSEDML_INVALID_OBJECT;
+    }
+    return emitAggregate(op, node->getChild(0), parameters);
+  }
+
+  case AST_FUNCTION_MAX:
+  case AST_FUNCTION_MIN:
+  {
+    op = (type == AST_FUNCTION_MAX) ? OP_MAX : OP_MIN;
+
+    if (numChildren == 0)
+    {
+      emitConst(numeric_limits<double>::quiet_NaN());
+      return LIBSEDML_OPERATION_SUCCESS;
+    }
+    if (numChildren == 1)
+    {
+      return emitAggregate(op, node->getChild(0), parameters);
+    }
+
+    result = emit(node->getChild(0), parameters, depth);
+    for (unsigned int i = 1;
+         i < numChildren && result == LIBSEDML_OPERATION_SUCCESS; ++i)
+    {
+      result = emit(node->getChild(i), parameters, depth + 1);
+      emitOp(op);
+    }
+    return result;
+  }
+
+  // relations with more than two arguments hold pairwise, in order
+  case AST_RELATIONAL_EQ:
+  case AST_RELATIONAL_NEQ:
+  case AST_RELATIONAL_GT:
+  case AST_RELATIONAL_GEQ:
+  case AST_RELATIONAL_LT:
+  case AST_RELATIONAL_LEQ:
+  {
+    op = (type == AST_RELATIONAL_EQ) ? OP_EQ :
+         (type == AST_RELATIONAL_NEQ) ? OP_NEQ :
+         (type == AST_RELATIONAL_GT) ? OP_GT :
+         (type == AST_RELATIONAL_GEQ) ? OP_GEQ :
+         (type == AST_RELATIONAL_LT) ? OP_LT : OP_LEQ;
+
+    if (numChildren < 2)
+    {
+      emitConst(1.0);
+      return LIBSEDML_OPERATION_SUCCESS;
+    }
+
+    for (unsigned int i = 1;
+         i < numChildren && result == LIBSEDML_OPERATION_SUCCESS; ++i)
+    {
+      unsigned int base = (i == 1) ? depth : depth + 1;
+      result = emit(node->getChild(i - 1), parameters, base);
+      if (result == LIBSEDML_OPERATION_SUCCESS)
+      {
+        result = emit(node->getChild(i), parameters, base + 1);
+      }
+      emitOp(op);
+      if (i > 1)
+      {
+        emitOp(OP_AND);
+      }
+    }
+    return result;
+  }
+
+  case AST_MINUS:
+    if (numChildren == 1)
+    {
+      result = emit(node->getChild(0), parameters, depth);
+      emitOp(OP_NEG);
+      return result;
+    }
+    op = OP_SUB;
+    break;
+
+  case AST_FUNCTION_ROOT:
+    if (numChildren == 1)
+    {
+      result = emit(node->getChild(0), parameters, depth);
+      emitOp(OP_SQRT);
+      return result;
+    }
+    op = OP_ROOT;
+    break;
+
+  case AST_FUNCTION_LOG:
+    if (numChildren == 1)
+    {
+      result = emit(node->getChild(0), parameters, depth);
+      emitOp(OP_LOG10);
+      return result;
+    }
+    op = OP_LOG;
+    break;
+
+  case AST_DIVIDE:              op = OP_DIV; break;
+  case AST_POWER:
+  case AST_FUNCTION_POWER:      op = OP_POW; break;
+  case AST_FUNCTION_QUOTIENT:   op = OP_QUOTIENT; break;
+  case AST_FUNCTION_REM:        op = OP_REM; break;
+  case AST_LOGICAL_IMPLIES:     op = OP_IMPLIES; break;
+
+  case AST_LOGICAL_NOT:         op = OP_NOT; break;
+  case AST_FUNCTION_ABS:        op = OP_ABS; break;
+  case AST_FUNCTION_EXP:        op = OP_EXP; break;
+  case AST_FUNCTION_LN:         op = OP_LN; break;
+  case AST_FUNCTION_FLOOR:      op = OP_FLOOR; break;
+  case AST_FUNCTION_CEILING:    op = OP_CEIL; break;
+  case AST_FUNCTION_FACTORIAL:  op = OP_FACTORIAL; break;
+  case AST_FUNCTION_SIN:        op = OP_SIN; break;
+  case AST_FUNCTION_COS:        op = OP_COS; break;
+  case AST_FUNCTION_TAN:        op = OP_TAN; break;
+  case AST_FUNCTION_SEC:        op = OP_SEC; break;
+  case AST_FUNCTION_CSC:        op = OP_CSC; break;
+  case AST_FUNCTION_COT:        op = OP_COT; break;
+  case AST_FUNCTION_SINH:       op = OP_SINH; break;
+  case AST_FUNCTION_COSH:       op = OP_COSH; break;
+  case AST_FUNCTION_TANH:       op = OP_TANH; break;
+  case AST_FUNCTION_SECH:       op = OP_SECH; break;
+  case AST_FUNCTION_CSCH:       op = OP_CSCH; break;
+  case AST_FUNCTION_COTH:       op = OP_COTH; break;
+  case AST_FUNCTION_ARCSIN:     op = OP_ASIN; break;
+  case AST_FUNCTION_ARCCOS:     op = OP_ACOS; break;
+  case AST_FUNCTION_ARCTAN:     op = OP_ATAN; break;
+  case AST_FUNCTION_ARCSEC:     op = OP_ASEC; break;
+  case AST_FUNCTION_ARCCSC:     op = OP_ACSC; break;
+  case AST_FUNCTION_ARCCOT:     op = OP_ACOT; break;
+  case AST_FUNCTION_ARCSINH:    op = OP_ASINH; break;
+  case AST_FUNCTION_ARCCOSH:    op = OP_ACOSH; break;
+  case AST_FUNCTION_ARCTANH:    op = OP_ATANH; break;
+  case AST_FUNCTION_ARCSECH:    op = OP_ASECH; break;
+  case AST_FUNCTION_ARCCSCH:    op = OP_ACSCH; break;
+  case AST_FUNCTION_ARCCOTH:    op = OP_ACOTH; break;
+
+  default:
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  // the remaining operators take a fixed number of arguments
+  const unsigned int arity =
+    (op == OP_SUB || op == OP_DIV || op == OP_POW || op == OP_ROOT ||
+     op == OP_LOG || op == OP_QUOTIENT || op == OP_REM ||
+     op == OP_IMPLIES) ? 2 : 1;
+
+  if (numChildren != arity)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  for (unsigned int i = 0;
+       i < arity && result == LIBSEDML_OPERATION_SUCCESS; ++i)
+  {
+    result = emit(node->getChild(i), parameters, depth + i);
+  }
+  emitOp(op);
+  return result;
+}
+
+
+/*
+ * Appends an instruction pushing the value of the given aggregate function
+ * over its argument, whose code goes to a new aggregate.
+ */
+int
+SedCompiledMath::emitAggregate(Opcode op, const ASTNode* argument,
+                               const SedListOfParameters* parameters)
+{
+  std::vector<Instruction> code;
+  code.swap(mCode);
+  int result = emit(argument, parameters, 0);
+
+  // aggregates within the argument come first, so that they can be reduced
+  // in order
+  Aggregate aggregate;
+  aggregate.op = op;
+  aggregate.code.swap(mCode);
+  mCode.swap(code);
+  mAggregates.push_back(aggregate);
+
+  emitOp(OP_AGGREGATE, (unsigned int)(mAggregates.size() - 1));
+  return result;
+}
+
+
+/*
+ * Appends the instructions computing the pieces of a piecewise function
+ * from the given child on, as nested selections.
+ */
+int
+SedCompiledMath::emitPiecewise(const ASTNode* node, unsigned int first,
+                               const SedListOfParameters* parameters,
+                               unsigned int depth)
+{
+  const unsigned int numChildren = node->getNumChildren();
+
+  if (first + 1 < numChildren)
+  {
+    if (depth + 2 >= MAX_DEPTH)
+    {
+      return LIBSEDML_OPERATION_FAILED;
+    }
+
+    int result = emit(node->getChild(first), parameters, depth);
+    if (result == LIBSEDML_OPERATION_SUCCESS)
+    {
+      result = emit(node->getChild(first + 1), parameters, depth + 1);
+    }
+    if (result == LIBSEDML_OPERATION_SUCCESS)
+    {
+      result = emitPiecewise(node, first + 2, parameters, depth + 2);
+    }
+    emitOp(OP_SELECT);
+    return result;
+  }
+
+  if (first < numChildren)
+  {
+    return emit(node->getChild(first), parameters, depth);
+  }
+
+  // without an otherwise, a piecewise function is undefined where none of
+  // its conditions hold
+  emitConst(numeric_limits<double>::quiet_NaN());
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Runs the given code on one row of slot values.
+ */
+double
+SedCompiledMath::run(const std::vector<Instruction>& code,
+                     const double* slots) const
+{
+  double stack[MAX_DEPTH];
+  double* top = stack - 1;
+
+  for (std::vector<Instruction>::const_iterator it = code.begin();
+       it != code.end(); ++it)
+  {
+    switch (it->op)
+    {
+    case OP_CONST:
+      *++top = mConstants[it->operand];
+      break;
+
+    case OP_SLOT:
+      *++top = slots[it->operand];
+      break;
+
+    case OP_AGGREGATE:
+      // a single row aggregates to its own value
+      *++top = run(mAggregates[it->operand].code, slots);
+      break;
+
+    case OP_SELECT:
+      top -= 2;
+      top[0] = (top[1] != 0.0) ? top[0] : top[2];
+      break;
+
+    case OP_NEG:
+    case OP_NOT:
+    case OP_ABS:
+    case OP_EXP:
+    case OP_LN:
+    case OP_LOG10:
+    case OP_SQRT:
+    case OP_FLOOR:
+    case OP_CEIL:
+    case OP_FACTORIAL:
+    case OP_SIN:
+    case OP_COS:
+    case OP_TAN:
+    case OP_SEC:
+    case OP_CSC:
+    case OP_COT:
+    case OP_SINH:
+    case OP_COSH:
+    case OP_TANH:
+    case OP_SECH:
+    case OP_CSCH:
+    case OP_COTH:
+    case OP_ASIN:
+    case OP_ACOS:
+    case OP_ATAN:
+    case OP_ASEC:
+    case OP_ACSC:
+    case OP_ACOT:
+    case OP_ASINH:
+    case OP_ACOSH:
+    case OP_ATANH:
+    case OP_ASECH:
+    case OP_ACSCH:
+    case OP_ACOTH:
+      top[0] = apply(it->op, top[0]);
+      break;
+
+    default:
+      --top;
+      top[0] = apply(it->op, top[0], top[1]);
+      break;
+    }
+  }
+
+  return stack[0];
+}
+
+
+/*
+ * Runs the given code on count rows of slot values from the given one on,
+ * one instruction over all the rows at a time, in loops the compiler can
+ * vectorize for the arithmetic.
+ */
+void
+SedCompiledMath::runBlock(const std::vector<Instruction>& code,
+                          const double* const* slotColumns, size_t first,
+                          size_t count, const double* aggregates,
+                          double* results) const
+{
+  double stack[MAX_DEPTH][BLOCK_SIZE];
+  int top = -1;
+
+  for (std::vector<Instruction>::const_iterator it = code.begin();
+       it != code.end(); ++it)
+  {
+    switch (it->op)
+    {
+    case OP_CONST:
+    {
+      double* result = stack[++top];
+      const double value = mConstants[it->operand];
+      for (size_t i = 0; i < count; ++i) result[i] = value;
+      break;
+    }
+
+    case OP_SLOT:
+    {
+      double* result = stack[++top];
+      const double* values = slotColumns[it->operand] + first;
+      for (size_t i = 0; i < count; ++i) result[i] = values[i];
+      break;
+    }
+
+    case OP_AGGREGATE:
+    {
+      double* result = stack[++top];
+      const double value = aggregates[it->operand];
+      for (size_t i = 0; i < count; ++i) result[i] = value;
+      break;
+    }
+
+    case OP_ADD:
+    {
+      double* left = stack[--top];
+      const double* right = stack[top + 1];
+      for (size_t i = 0; i < count; ++i) left[i] += right[i];
+      break;
+    }
+
+    case OP_SUB:
+    {
+      double* left = stack[--top];
+      const double* right = stack[top + 1];
+      for (size_t i = 0; i < count; ++i) left[i] -= right[i];
+      break;
+    }
+
+    case OP_MUL:
+    {
+      double* left = stack[--top];
+      const double* right = stack[top + 1];
+      for (size_t i = 0; i < count; ++i) left[i] *= right[i];
+      break;
+    }
+
+    case OP_DIV:
+    {
+      double* left = stack[--top];
+      const double* right = stack[top + 1];
+      for (size_t i = 0; i < count; ++i) left[i] /= right[i];
+      break;
+    }
+
+    case OP_NEG:
+    {
+      double* value = stack[top];
+      for (size_t i = 0; i < count; ++i) value[i] = -value[i];
+      break;
+    }
+
+    case OP_SELECT:
+    {
+      top -= 2;
+      double* value = stack[top];
+      const double* condition = stack[top + 1];
+      const double* otherwise = stack[top + 2];
+      for (size_t i = 0; i < count; ++i)
+      {
+        value[i] = (condition[i] != 0.0) ? value[i] : otherwise[i];
+      }
+      break;
+    }
+
+    case OP_NOT:
+    case OP_ABS:
+    case OP_EXP:
+    case OP_LN:
+    case OP_LOG10:
+    case OP_SQRT:
+    case OP_FLOOR:
+    case OP_CEIL:
+    case OP_FACTORIAL:
+    case OP_SIN:
+    case OP_COS:
+    case OP_TAN:
+    case OP_SEC:
+    case OP_CSC:
+    case OP_COT:
+    case OP_SINH:
+    case OP_COSH:
+    case OP_TANH:
+    case OP_SECH:
+    case OP_CSCH:
+    case OP_COTH:
+    case OP_ASIN:
+    case OP_ACOS:
+    case OP_ATAN:
+    case OP_ASEC:
+    case OP_ACSC:
+    case OP_ACOT:
+    case OP_ASINH:
+    case OP_ACOSH:
+    case OP_ATANH:
+    case OP_ASECH:
+    case OP_ACSCH:
+    case OP_ACOTH:
+    {
+      double* value = stack[top];
+      for (size_t i = 0; i < count; ++i) value[i] = apply(it->op, value[i]);
+      break;
+    }
+
+    default:
+    {
+      double* left = stack[--top];
+      const double* right = stack[top + 1];
+      for (size_t i = 0; i < count; ++i)
+      {
+        left[i] = apply(it->op, left[i], right[i]);
+      }
+      break;
+    }
+    }
+  }
+
+  copy(stack[0], stack[0] + count, results);
+}
+
+
+/*
+ * Applies a unary operator.
+ */
+double
+SedCompiledMath::apply(Opcode op, double value)
+{
+  switch (op)
+  {
+  case OP_NEG:        return -value;
+  case OP_NOT:        return (value == 0.0) ? 1.0 : 0.0;
+  case OP_ABS:        return fabs(value);
+  case OP_EXP:        return exp(value);
+  case OP_LN:         return log(value);
+  case OP_LOG10:      return log10(value);
+  case OP_SQRT:       return sqrt(value);
+  case OP_FLOOR:      return floor(value);
+  case OP_CEIL:       return ceil(value);
+  case OP_FACTORIAL:  return tgamma(value + 1.0);
+  case OP_SIN:        return sin(value);
+  case OP_COS:        return cos(value);
+  case OP_TAN:        return tan(value);
+  case OP_SEC:        return 1.0 / cos(value);
+  case OP_CSC:        return 1.0 / sin(value);
+  case OP_COT:        return 1.0 / tan(value);
+  case OP_SINH:       return sinh(value);
+  case OP_COSH:       return cosh(value);
+  case OP_TANH:       return tanh(value);
+  case OP_SECH:       return 1.0 / cosh(value);
+  case OP_CSCH:       return 1.0 / sinh(value);
+  case OP_COTH:       return 1.0 / tanh(value);
+  case OP_ASIN:       return asin(value);
+  case OP_ACOS:       return acos(value);
+  case OP_ATAN:       return atan(value);
+  case OP_ASEC:       return acos(1.0 / value);
+  case OP_ACSC:       return asin(1.0 / value);
+  case OP_ACOT:       return atan(1.0 / value);
+  case OP_ASINH:      return asinh(value);
+  case OP_ACOSH:      return acosh(value);
+  case OP_ATANH:      return atanh(value);
+  case OP_ASECH:      return acosh(1.0 / value);
+  case OP_ACSCH:      return asinh(1.0 / value);
+  case OP_ACOTH:      return atanh(1.0 / value);
+  default:            return numeric_limits<double>::quiet_NaN();
+  }
+}
+
+
+/*
+ * Applies a binary operator.
+ */
+double
+SedCompiledMath::apply(Opcode op, double left, double right)
+{
+  switch (op)
+  {
+  case OP_ADD:        return left + right;
+  case OP_SUB:        return left - right;
+  case OP_MUL:        return left * right;
+  case OP_DIV:        return left / right;
+  case OP_POW:        return pow(left, right);
+  case OP_ROOT:       return pow(right, 1.0 / left);
+  case OP_LOG:        return log(right) / log(left);
+  case OP_QUOTIENT:   return trunc(left / right);
+  case OP_REM:        return fmod(left, right);
+  case OP_MIN:        return min(left, right);
+  case OP_MAX:        return max(left, right);
+  case OP_EQ:         return (left == right) ? 1.0 : 0.0;
+  case OP_NEQ:        return (left != right) ? 1.0 : 0.0;
+  case OP_GT:         return (left > right) ? 1.0 : 0.0;
+  case OP_GEQ:        return (left >= right) ? 1.0 : 0.0;
+  case OP_LT:         return (left < right) ? 1.0 : 0.0;
+  case OP_LEQ:        return (left <= right) ? 1.0 : 0.0;
+  case OP_AND:        return (left != 0.0 && right != 0.0) ? 1.0 : 0.0;
+  case OP_OR:         return (left != 0.0 || right != 0.0) ? 1.0 : 0.0;
+  case OP_XOR:        return ((left != 0.0) != (right != 0.0)) ? 1.0 : 0.0;
+  case OP_IMPLIES:    return (left == 0.0 || right != 0.0) ? 1.0 : 0.0;
+  default:            return numeric_limits<double>::quiet_NaN();
+  }
+}
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
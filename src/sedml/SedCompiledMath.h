@@ -0,0 +1,296 @@
+/**
+ * @file SedCompiledMath.h
+ * @brief Definition of the SedCompiledMath class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedCompiledMath
+ * @sbmlbrief{sedml} Math compiled for repeated evaluation.
+ *
+ * SedFunctionalRange, SedSetValue and SedComputeChange hold math over
+ * variables and parameters that is evaluated once per iteration of a
+ * repeated task.  A SedCompiledMath translates such math once into a
+ * compact sequence of instructions: parameters are replaced by their
+ * values, and every other name is bound to a slot, that is, an index into
+ * the array of values passed to evaluate().  Evaluation then neither walks
+ * the math nor allocates memory, and the batch form of evaluate() runs
+ * each instruction over many rows at once.
+ *
+ * The math of a SedDataGenerator may also use the aggregate functions
+ * min, max, sum and mean with a single argument.  The batch form of
+ * evaluate() reduces such an argument over all the rows, as over the
+ * values of a variable in a time course, before evaluating the rest of the
+ * math on each row; a single row aggregates to its own value.
+ *
+ * The math is evaluated with the values of the parameters at the time it
+ * is compiled; it needs to be compiled again if they change.
+ */
+
+
+#ifndef SedCompiledMath_H__
+#define SedCompiledMath_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sedml/SedListOfParameters.h>
+#include <sedml/SedListOfVariables.h>
+#include <sbml/common/libsbml-namespace.h>
+#include <sbml/math/ASTNode.h>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedCompiledMath
+{
+public:
+
+  /**
+   * Creates a new SedCompiledMath that has not been compiled yet.
+   */
+  SedCompiledMath();
+
+
+  /**
+   * Compiles the given math.
+   *
+   * @param math the math to compile.
+   *
+   * @param slotNames the names bound to the slots, in slot order.
+   *
+   * @param parameters the parameters whose values replace their ids in
+   * @p math, or @c NULL; parameters take precedence over slots of the same
+   * name.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * if @p math is @c NULL, refers to an unknown name or uses a construct
+   * that cannot be evaluated, such as a function definition or a csymbol.
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if @p math is nested too deeply.
+   */
+  int compile(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math,
+              const std::vector<std::string>& slotNames,
+              const SedListOfParameters* parameters = NULL);
+
+
+  /**
+   * Compiles the given math, binding the ids of the given variables to the
+   * first slots, in list order, and @p names to the slots after them.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * @see compile(const ASTNode* math, const std::vector<std::string>& slotNames, const SedListOfParameters* parameters)
+   */
+  int compile(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math,
+              const SedListOfVariables* variables,
+              const SedListOfParameters* parameters,
+              const std::vector<std::string>& names);
+
+
+  /**
+   * Compiles the math of the given SedFunctionalRange, binding its
+   * variables to the first slots and @p names, such as the ids of ranges,
+   * to the slots after them.
+   */
+  int compile(const SedFunctionalRange& range,
+              const std::vector<std::string>& names);
+
+
+  /**
+   * Compiles the math of the given SedSetValue, binding its variables to
+   * the first slots and @p names, such as the id of its range, to the slots
+   * after them.
+   */
+  int compile(const SedSetValue& setValue,
+              const std::vector<std::string>& names);
+
+
+  /**
+   * Compiles the math of the given SedComputeChange, binding its variables
+   * to the first slots and @p names to the slots after them.
+   */
+  int compile(const SedComputeChange& change,
+              const std::vector<std::string>& names);
+
+
+  /**
+   * Compiles the math of the given SedDataGenerator, binding its variables
+   * to the slots, in list order.
+   */
+  int compile(const SedDataGenerator& dataGenerator);
+
+
+  /**
+   * Returns @c true if math has been compiled successfully.
+   */
+  bool isCompiled() const;
+
+
+  /**
+   * Returns the number of slots of the compiled math.
+   */
+  unsigned int getNumSlots() const;
+
+
+  /**
+   * Returns the slot bound to the given name, or @c -1 if there is none.
+   */
+  int getSlot(const std::string& name) const;
+
+
+  /**
+   * Evaluates the compiled math.
+   *
+   * @param slots the values of the slots, at least getNumSlots() of them.
+   *
+   * @return the value of the math, or NaN if it has not been compiled.
+   */
+  double evaluate(const double* slots) const;
+
+
+  /**
+   * Evaluates the compiled math for many rows of slot values at once.
+   *
+   * @param slotColumns for each slot, a pointer to its values in the
+   * @p numRows rows.
+   *
+   * @param numRows the number of rows.
+   *
+   * @param results where the @p numRows values of the math are stored;
+   * NaN if it has not been compiled.
+   *
+   * Aggregate functions in the math reduce their argument over all the
+   * rows; all the other operators and functions apply to each row.
+   */
+  void evaluate(const double* const* slotColumns, size_t numRows,
+                double* results) const;
+
+
+  /** @cond doxygenLibsedmlInternal */
+
+  // the deepest stack the math can use, and the number of rows evaluated
+  // together by the batch form of evaluate()
+  static const unsigned int MAX_DEPTH = 64;
+  static const unsigned int BLOCK_SIZE = 32;
+
+  /** @endcond */
+
+
+private:
+
+  /** @cond doxygenLibsedmlInternal */
+
+  enum Opcode
+  {
+    OP_CONST, OP_SLOT, OP_AGGREGATE, OP_SUM, OP_MEAN,
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_NEG, OP_POW, OP_ROOT, OP_LOG,
+    OP_QUOTIENT, OP_REM, OP_MIN, OP_MAX,
+    OP_EQ, OP_NEQ, OP_GT, OP_GEQ, OP_LT, OP_LEQ,
+    OP_AND, OP_OR, OP_XOR, OP_IMPLIES, OP_NOT, OP_SELECT,
+    OP_ABS, OP_EXP, OP_LN, OP_LOG10, OP_SQRT, OP_FLOOR, OP_CEIL,
+    OP_FACTORIAL,
+    OP_SIN, OP_COS, OP_TAN, OP_SEC, OP_CSC, OP_COT,
+    OP_SINH, OP_COSH, OP_TANH, OP_SECH, OP_CSCH, OP_COTH,
+    OP_ASIN, OP_ACOS, OP_ATAN, OP_ASEC, OP_ACSC, OP_ACOT,
+    OP_ASINH, OP_ACOSH, OP_ATANH, OP_ASECH, OP_ACSCH, OP_ACOTH
+  };
+
+  struct Instruction
+  {
+    Opcode op;
+    unsigned int operand;
+  };
+
+  // an aggregate function (OP_MIN, OP_MAX, OP_SUM or OP_MEAN) with the code
+  // of its argument
+  struct Aggregate
+  {
+    Opcode op;
+    std::vector<Instruction> code;
+  };
+
+  double run(const std::vector<Instruction>& code, const double* slots) const;
+
+  void runBlock(const std::vector<Instruction>& code,
+                const double* const* slotColumns, size_t first, size_t count,
+                const double* aggregates, double* results) const;
+
+  int emit(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+           const SedListOfParameters* parameters, unsigned int depth);
+
+  int emitPiecewise(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+                    unsigned int first, const SedListOfParameters* parameters,
+                    unsigned int depth);
+
+  int emitAggregate(Opcode op,
+                    const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* argument,
+                    const SedListOfParameters* parameters);
+
+  void emitOp(Opcode op, unsigned int operand = 0);
+
+  void emitConst(double value);
+
+  static double apply(Opcode op, double value);
+
+  static double apply(Opcode op, double left, double right);
+
+  std::vector<Instruction> mCode;
+  std::vector<double> mConstants;
+  std::vector<Aggregate> mAggregates;
+  std::vector<std::string> mSlotNames;
+  unsigned int mMaxDepth;
+  bool mCompiled;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedCompiledMath_H__ */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedComputeChange.h>
+#include <sedml/SedDocument.h>
 #include <sedml/SedVariable.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/math/MathML.h>
@@ -55,12 +56,11 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  */
 SedComputeChange::SedComputeChange(unsigned int level, unsigned int version)
   : SedChange(level, version)
-  , mMath (NULL)
+  , mMath ()
   , mVariables (level, version)
   , mParameters (level, version)
   , mSymbol ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -71,7 +71,7 @@ SedComputeChange::SedComputeChange(unsigned int level, unsigned int version)
  */
 SedComputeChange::SedComputeChange(SedNamespaces *sedmlns)
   : SedChange(sedmlns)
-  , mMath (NULL)
+  , mMath ()
   , mVariables (sedmlns)
   , mParameters (sedmlns)
   , mSymbol ("")
@@ -86,16 +86,11 @@ SedComputeChange::SedComputeChange(SedNamespaces *sedmlns)
  */
 SedComputeChange::SedComputeChange(const SedComputeChange& orig)
   : SedChange( orig )
-  , mMath ( NULL )
+  , mMath ( orig.mMath )
   , mVariables ( orig.mVariables )
   , mParameters ( orig.mParameters )
   , mSymbol (orig.mSymbol)
 {
-  if (orig.mMath != NULL)
-  {
-    mMath = orig.mMath->deepCopy();
-  }
-
   connectToChild();
 }
 
@@ -112,15 +107,7 @@ SedComputeChange::operator=(const SedComputeChange& rhs)
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
     mSymbol = rhs.mSymbol;
-    delete mMath;
-    if (rhs.mMath != NULL)
-    {
-      mMath = rhs.mMath->deepCopy();
-    }
-    else
-    {
-      mMath = NULL;
-    }
+    mMath = rhs.mMath;
 
     connectToChild();
   }
@@ -129,6 +116,40 @@ SedComputeChange::operator=(const SedComputeChange& rhs)
 }
 
 
+/*
+ * Move constructor for SedComputeChange.
+ */
+SedComputeChange::SedComputeChange(SedComputeChange&& orig) noexcept
+  : SedChange( std::move(orig) )
+  , mMath ( std::move(orig.mMath) )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+  , mSymbol ( std::move(orig.mSymbol) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedComputeChange.
+ */
+SedComputeChange&
+SedComputeChange::operator=(SedComputeChange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+    mMath = std::move(rhs.mMath);
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    mSymbol = std::move(rhs.mSymbol);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedComputeChange object.
  */
@@ -144,8 +165,6 @@ SedComputeChange::clone() const
  */
 SedComputeChange::~SedComputeChange()
 {
-  delete mMath;
-  mMath = NULL;
 }
 
 
@@ -215,7 +234,7 @@ SedComputeChange::unsetSymbol()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedComputeChange::getMath() const
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -225,7 +244,7 @@ SedComputeChange::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedComputeChange::getMath()
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -236,7 +255,7 @@ SedComputeChange::getMath()
 bool
 SedComputeChange::isSetMath() const
 {
-  return (mMath != NULL);
+  return mMath.isSet();
 }
 
 
@@ -246,14 +265,13 @@ SedComputeChange::isSetMath() const
 int
 SedComputeChange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 {
-  if (mMath == math)
+  if (mMath.owns(math))
   {
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (math == NULL)
   {
-    delete mMath;
-    mMath = NULL;
+    mMath.set(NULL);
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!(math->isWellFormedASTNode()))
@@ -262,8 +280,7 @@ SedComputeChange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   }
   else
   {
-    delete mMath;
-    mMath = (math != NULL) ? math->deepCopy() : NULL;
+    mMath.set(math->deepCopy());
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -275,8 +292,7 @@ SedComputeChange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 int
 SedComputeChange::unsetMath()
 {
-  delete mMath;
-  mMath = NULL;
+  mMath.set(NULL);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -645,9 +661,12 @@ void
 SedComputeChange::renameSIdRefs(const std::string& oldid,
                                 const std::string& newid)
 {
-  if (isSetMath())
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math = getMath();
+
+  // math that fails to parse has no references to rename
+  if (math != NULL)
   {
-    mMath->renameSIdRefs(oldid, newid);
+    math->renameSIdRefs(oldid, newid);
   }
 }
 
@@ -711,10 +730,8 @@ SedComputeChange::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER
 {
   SedChange::writeElements(stream);
 
-  if (isSetMath() == true)
-  {
-    writeMathML(getMath(), stream, NULL);
-  }
+  // math that does not parse is still written back as it was read
+  mMath.write(stream);
 
   if (getNumVariables() > 0)
   {
@@ -1201,6 +1218,22 @@ SedComputeChange::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedComputeChange
+ */
+void
+SedComputeChange::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mVariables, data);
+
+  visit(&mParameters, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -1334,8 +1367,7 @@ SedComputeChange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
   {
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
-    delete mMath;
-    mMath = readMathML(stream, prefix);
+    mMath.read(stream, prefix);
     read = true;
   }
 
@@ -52,6 +52,7 @@
 
 #include <sedml/SedChange.h>
 #include <sbml/math/ASTNode.h>
+#include <sedml/SedLazyMath.h>
 #include <sedml/SedListOfVariables.h>
 #include <sedml/SedListOfParameters.h>
 #include <sbml/common/libsbml-namespace.h>
@@ -66,7 +67,7 @@ protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* mMath;
+  SedLazyMath mMath;
   SedListOfVariables mVariables;
   SedListOfParameters mParameters;
   std::string mSymbol;
@@ -119,6 +120,27 @@ public:
   SedComputeChange& operator=(const SedComputeChange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedComputeChange.
+   *
+   * @param orig the SedComputeChange instance to move from; it is left empty.
+   */
+  SedComputeChange(SedComputeChange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedComputeChange.
+   *
+   * @param rhs the SedComputeChange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedComputeChange& operator=(SedComputeChange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedComputeChange object.
    *
@@ -1190,6 +1212,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedComputeChange.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
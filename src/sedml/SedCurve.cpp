@@ -61,7 +61,6 @@ SedCurve::SedCurve(unsigned int level, unsigned int version)
   , mYErrorUpper ("")
   , mYErrorLower ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -123,6 +122,46 @@ SedCurve::operator=(const SedCurve& rhs)
 }
 
 
+/*
+ * Move constructor for SedCurve.
+ */
+SedCurve::SedCurve(SedCurve&& orig) noexcept
+  : SedAbstractCurve( std::move(orig) )
+  , mLogY ( std::move(orig.mLogY) )
+  , mIsSetLogY ( std::move(orig.mIsSetLogY) )
+  , mYDataReference ( std::move(orig.mYDataReference) )
+  , mType ( std::move(orig.mType) )
+  , mXErrorUpper ( std::move(orig.mXErrorUpper) )
+  , mXErrorLower ( std::move(orig.mXErrorLower) )
+  , mYErrorUpper ( std::move(orig.mYErrorUpper) )
+  , mYErrorLower ( std::move(orig.mYErrorLower) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedCurve.
+ */
+SedCurve&
+SedCurve::operator=(SedCurve&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedAbstractCurve::operator=(std::move(rhs));
+    mLogY = std::move(rhs.mLogY);
+    mIsSetLogY = std::move(rhs.mIsSetLogY);
+    mYDataReference = std::move(rhs.mYDataReference);
+    mType = std::move(rhs.mType);
+    mXErrorUpper = std::move(rhs.mXErrorUpper);
+    mXErrorLower = std::move(rhs.mXErrorLower);
+    mYErrorUpper = std::move(rhs.mYErrorUpper);
+    mYErrorLower = std::move(rhs.mYErrorLower);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedCurve object.
  */
@@ -321,6 +360,7 @@ SedCurve::setYDataReference(const std::string& yDataReference)
   }
   else
   {
+    sIdRefChanged(mYDataReference, yDataReference);
     mYDataReference = yDataReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -375,6 +415,7 @@ SedCurve::setXErrorUpper(const std::string& xErrorUpper)
   }
   else
   {
+    sIdRefChanged(mXErrorUpper, xErrorUpper);
     mXErrorUpper = xErrorUpper;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -393,6 +434,7 @@ SedCurve::setXErrorLower(const std::string& xErrorLower)
   }
   else
   {
+    sIdRefChanged(mXErrorLower, xErrorLower);
     mXErrorLower = xErrorLower;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -411,6 +453,7 @@ SedCurve::setYErrorUpper(const std::string& yErrorUpper)
   }
   else
   {
+    sIdRefChanged(mYErrorUpper, yErrorUpper);
     mYErrorUpper = yErrorUpper;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -429,6 +472,7 @@ SedCurve::setYErrorLower(const std::string& yErrorLower)
   }
   else
   {
+    sIdRefChanged(mYErrorLower, yErrorLower);
     mYErrorLower = yErrorLower;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -461,6 +505,7 @@ SedCurve::unsetLogY()
 int
 SedCurve::unsetYDataReference()
 {
+  sIdRefChanged(mYDataReference, std::string());
   mYDataReference.erase();
 
   if (mYDataReference.empty() == true)
@@ -491,6 +536,7 @@ SedCurve::unsetType()
 int
 SedCurve::unsetXErrorUpper()
 {
+  sIdRefChanged(mXErrorUpper, std::string());
   mXErrorUpper.erase();
 
   if (mXErrorUpper.empty() == true)
@@ -510,6 +556,7 @@ SedCurve::unsetXErrorUpper()
 int
 SedCurve::unsetXErrorLower()
 {
+  sIdRefChanged(mXErrorLower, std::string());
   mXErrorLower.erase();
 
   if (mXErrorLower.empty() == true)
@@ -529,6 +576,7 @@ SedCurve::unsetXErrorLower()
 int
 SedCurve::unsetYErrorUpper()
 {
+  sIdRefChanged(mYErrorUpper, std::string());
   mYErrorUpper.erase();
 
   if (mYErrorUpper.empty() == true)
@@ -548,6 +596,7 @@ SedCurve::unsetYErrorUpper()
 int
 SedCurve::unsetYErrorLower()
 {
+  sIdRefChanged(mYErrorLower, std::string());
   mYErrorLower.erase();
 
   if (mYErrorLower.empty() == true)
@@ -567,6 +616,8 @@ SedCurve::unsetYErrorLower()
 void
 SedCurve::renameSIdRefs(const std::string& oldid, const std::string& newid)
 {
+  SedAbstractCurve::renameSIdRefs(oldid, newid);
+
   if (isSetYDataReference() && mYDataReference == oldid)
   {
     setYDataReference(newid);
@@ -594,6 +645,41 @@ SedCurve::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedCurve to refs.
+ */
+void
+SedCurve::getSIdRefs(std::vector<std::string>& refs) const
+{
+  SedAbstractCurve::getSIdRefs(refs);
+
+  if (isSetYDataReference())
+  {
+    refs.push_back(mYDataReference);
+  }
+
+  if (isSetXErrorUpper())
+  {
+    refs.push_back(mXErrorUpper);
+  }
+
+  if (isSetXErrorLower())
+  {
+    refs.push_back(mXErrorLower);
+  }
+
+  if (isSetYErrorUpper())
+  {
+    refs.push_back(mYErrorUpper);
+  }
+
+  if (isSetYErrorLower())
+  {
+    refs.push_back(mYErrorLower);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedCurve object.
  */
@@ -149,6 +149,27 @@ public:
   SedCurve& operator=(const SedCurve& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedCurve.
+   *
+   * @param orig the SedCurve instance to move from; it is left empty.
+   */
+  SedCurve(SedCurve&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedCurve.
+   *
+   * @param rhs the SedCurve object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedCurve& operator=(SedCurve&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedCurve object.
    *
@@ -514,6 +535,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedCurve object.
    *
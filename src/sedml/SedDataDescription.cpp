@@ -60,7 +60,6 @@ SedDataDescription::SedDataDescription(unsigned int level,
   , mDimensionDescription (NULL)
   , mDataSources (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -133,6 +132,44 @@ SedDataDescription::operator=(const SedDataDescription& rhs)
 }
 
 
+/*
+ * Move constructor for SedDataDescription.
+ */
+SedDataDescription::SedDataDescription(SedDataDescription&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mFormat ( std::move(orig.mFormat) )
+  , mSource ( std::move(orig.mSource) )
+  , mDimensionDescription ( orig.mDimensionDescription )
+  , mDataSources ( std::move(orig.mDataSources) )
+{
+  orig.mDimensionDescription = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedDataDescription.
+ */
+SedDataDescription&
+SedDataDescription::operator=(SedDataDescription&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mFormat = std::move(rhs.mFormat);
+    mSource = std::move(rhs.mSource);
+    delete mDimensionDescription;
+    mDimensionDescription = rhs.mDimensionDescription;
+    rhs.mDimensionDescription = NULL;
+    mDataSources = std::move(rhs.mDataSources);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataDescription object.
  */
@@ -1087,6 +1124,20 @@ SedDataDescription::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedDataDescription
+ */
+void
+SedDataDescription::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mDataSources, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -119,6 +119,27 @@ public:
   SedDataDescription& operator=(const SedDataDescription& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedDataDescription.
+   *
+   * @param orig the SedDataDescription instance to move from; it is left empty.
+   */
+  SedDataDescription(SedDataDescription&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedDataDescription.
+   *
+   * @param rhs the SedDataDescription object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedDataDescription& operator=(SedDataDescription&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataDescription object.
    *
@@ -990,6 +1011,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedDataDescription.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedDataGenerator.h>
+#include <sedml/SedDocument.h>
 #include <sedml/SedVariable.h>
 #include <sedml/SedListOfDataGenerators.h>
 #include <sbml/xml/XMLInputStream.h>
@@ -58,9 +59,8 @@ SedDataGenerator::SedDataGenerator(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mVariables (level, version)
   , mParameters (level, version)
-  , mMath (NULL)
+  , mMath ()
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -75,7 +75,7 @@ SedDataGenerator::SedDataGenerator(SedNamespaces *sedmlns)
   : SedBase(sedmlns)
   , mVariables (sedmlns)
   , mParameters (sedmlns)
-  , mMath (NULL)
+  , mMath ()
 {
   setElementNamespace(sedmlns->getURI());
   connectToChild();
@@ -91,12 +91,8 @@ SedDataGenerator::SedDataGenerator(const SedDataGenerator& orig)
   : SedBase( orig )
   , mVariables ( orig.mVariables )
   , mParameters ( orig.mParameters )
-  , mMath ( NULL )
+  , mMath ( orig.mMath )
 {
-  if (orig.mMath != NULL)
-  {
-    mMath = orig.mMath->deepCopy();
-  }
 
   connectToChild();
 }
@@ -113,15 +109,7 @@ SedDataGenerator::operator=(const SedDataGenerator& rhs)
     SedBase::operator=(rhs);
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
-    delete mMath;
-    if (rhs.mMath != NULL)
-    {
-      mMath = rhs.mMath->deepCopy();
-    }
-    else
-    {
-      mMath = NULL;
-    }
+    mMath = rhs.mMath;
 
     connectToChild();
   }
@@ -130,6 +118,38 @@ SedDataGenerator::operator=(const SedDataGenerator& rhs)
 }
 
 
+/*
+ * Move constructor for SedDataGenerator.
+ */
+SedDataGenerator::SedDataGenerator(SedDataGenerator&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+  , mMath ( std::move(orig.mMath) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedDataGenerator.
+ */
+SedDataGenerator&
+SedDataGenerator::operator=(SedDataGenerator&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    mMath = std::move(rhs.mMath);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataGenerator object.
  */
@@ -145,8 +165,6 @@ SedDataGenerator::clone() const
  */
 SedDataGenerator::~SedDataGenerator()
 {
-  delete mMath;
-  mMath = NULL;
 }
 
 
@@ -156,7 +174,7 @@ SedDataGenerator::~SedDataGenerator()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedDataGenerator::getMath() const
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -166,7 +184,7 @@ SedDataGenerator::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedDataGenerator::getMath()
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -177,7 +195,7 @@ SedDataGenerator::getMath()
 bool
 SedDataGenerator::isSetMath() const
 {
-  return (mMath != NULL);
+  return mMath.isSet();
 }
 
 
@@ -187,14 +205,13 @@ SedDataGenerator::isSetMath() const
 int
 SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 {
-  if (mMath == math)
+  if (mMath.owns(math))
   {
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (math == NULL)
   {
-    delete mMath;
-    mMath = NULL;
+    mMath.set(NULL);
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!(math->isWellFormedASTNode()))
@@ -203,8 +220,7 @@ SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   }
   else
   {
-    delete mMath;
-    mMath = (math != NULL) ? math->deepCopy() : NULL;
+    mMath.set(math->deepCopy());
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -216,8 +232,7 @@ SedDataGenerator::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 int
 SedDataGenerator::unsetMath()
 {
-  delete mMath;
-  mMath = NULL;
+  mMath.set(NULL);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -586,9 +601,12 @@ void
 SedDataGenerator::renameSIdRefs(const std::string& oldid,
                                 const std::string& newid)
 {
-  if (isSetMath())
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math = getMath();
+
+  // math that fails to parse has no references to rename
+  if (math != NULL)
   {
-    mMath->renameSIdRefs(oldid, newid);
+    math->renameSIdRefs(oldid, newid);
   }
 }
 
@@ -644,10 +662,8 @@ SedDataGenerator::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER
 {
   SedBase::writeElements(stream);
 
-  if (isSetMath() == true)
-  {
-    writeMathML(getMath(), stream, NULL);
-  }
+  // math that does not parse is still written back as it was read
+  mMath.write(stream);
 
   if (getNumVariables() > 0)
   {
@@ -1114,6 +1130,22 @@ SedDataGenerator::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedDataGenerator
+ */
+void
+SedDataGenerator::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mVariables, data);
+
+  visit(&mParameters, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -1259,8 +1291,7 @@ SedDataGenerator::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
   {
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
-    delete mMath;
-    mMath = readMathML(stream, prefix);
+    mMath.read(stream, prefix);
     read = true;
   }
 
@@ -52,6 +52,7 @@
 
 #include <sedml/SedBase.h>
 #include <sbml/math/ASTNode.h>
+#include <sedml/SedLazyMath.h>
 #include <sedml/SedListOfVariables.h>
 #include <sedml/SedListOfParameters.h>
 #include <sbml/common/libsbml-namespace.h>
@@ -68,7 +69,7 @@ protected:
 
   SedListOfVariables mVariables;
   SedListOfParameters mParameters;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* mMath;
+  SedLazyMath mMath;
 
   /** @endcond */
 
@@ -118,6 +119,27 @@ public:
   SedDataGenerator& operator=(const SedDataGenerator& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedDataGenerator.
+   *
+   * @param orig the SedDataGenerator instance to move from; it is left empty.
+   */
+  SedDataGenerator(SedDataGenerator&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedDataGenerator.
+   *
+   * @param rhs the SedDataGenerator object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedDataGenerator& operator=(SedDataGenerator&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataGenerator object.
    *
@@ -1162,6 +1184,16 @@ protected:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedDataGenerator.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 
   /** @cond doxygenLibSEDMLInternal */
 
@@ -55,7 +55,6 @@ SedDataRange::SedDataRange(unsigned int level, unsigned int version)
   : SedRange(level, version)
   , mSourceReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -96,6 +95,32 @@ SedDataRange::operator=(const SedDataRange& rhs)
 }
 
 
+/*
+ * Move constructor for SedDataRange.
+ */
+SedDataRange::SedDataRange(SedDataRange&& orig) noexcept
+  : SedRange( std::move(orig) )
+  , mSourceReference ( std::move(orig.mSourceReference) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedDataRange.
+ */
+SedDataRange&
+SedDataRange::operator=(SedDataRange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mSourceReference = std::move(rhs.mSourceReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataRange object.
  */
@@ -147,6 +172,7 @@ SedDataRange::setSourceReference(const std::string& sourceReference)
   }
   else
   {
+    sIdRefChanged(mSourceReference, sourceReference);
     mSourceReference = sourceReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -159,6 +185,7 @@ SedDataRange::setSourceReference(const std::string& sourceReference)
 int
 SedDataRange::unsetSourceReference()
 {
+  sIdRefChanged(mSourceReference, std::string());
   mSourceReference.erase();
 
   if (mSourceReference.empty() == true)
@@ -186,6 +213,19 @@ SedDataRange::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedDataRange to refs.
+ */
+void
+SedDataRange::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetSourceReference())
+  {
+    refs.push_back(mSourceReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedDataRange object.
  */
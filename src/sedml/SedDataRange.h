@@ -113,6 +113,27 @@ public:
   SedDataRange& operator=(const SedDataRange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedDataRange.
+   *
+   * @param orig the SedDataRange instance to move from; it is left empty.
+   */
+  SedDataRange(SedDataRange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedDataRange.
+   *
+   * @param rhs the SedDataRange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedDataRange& operator=(SedDataRange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataRange object.
    *
@@ -177,6 +198,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedDataRange object.
    *
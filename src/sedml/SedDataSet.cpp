@@ -56,7 +56,6 @@ SedDataSet::SedDataSet(unsigned int level, unsigned int version)
   , mLabel ("")
   , mDataReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mNameAllowedPreV4 = true;
   mIdAllowedPreV4 = true;
 }
@@ -104,6 +103,34 @@ SedDataSet::operator=(const SedDataSet& rhs)
 }
 
 
+/*
+ * Move constructor for SedDataSet.
+ */
+SedDataSet::SedDataSet(SedDataSet&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mLabel ( std::move(orig.mLabel) )
+  , mDataReference ( std::move(orig.mDataReference) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedDataSet.
+ */
+SedDataSet&
+SedDataSet::operator=(SedDataSet&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLabel = std::move(rhs.mLabel);
+    mDataReference = std::move(rhs.mDataReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataSet object.
  */
@@ -186,6 +213,7 @@ SedDataSet::setDataReference(const std::string& dataReference)
   }
   else
   {
+    sIdRefChanged(mDataReference, dataReference);
     mDataReference = dataReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -217,6 +245,7 @@ SedDataSet::unsetLabel()
 int
 SedDataSet::unsetDataReference()
 {
+  sIdRefChanged(mDataReference, std::string());
   mDataReference.erase();
 
   if (mDataReference.empty() == true)
@@ -243,6 +272,19 @@ SedDataSet::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedDataSet to refs.
+ */
+void
+SedDataSet::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetDataReference())
+  {
+    refs.push_back(mDataReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedDataSet object.
  */
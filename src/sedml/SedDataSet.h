@@ -113,6 +113,27 @@ public:
   SedDataSet& operator=(const SedDataSet& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedDataSet.
+   *
+   * @param orig the SedDataSet instance to move from; it is left empty.
+   */
+  SedDataSet(SedDataSet&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedDataSet.
+   *
+   * @param rhs the SedDataSet object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedDataSet& operator=(SedDataSet&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataSet object.
    *
@@ -218,6 +239,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedDataSet object.
    *
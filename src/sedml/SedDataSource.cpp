@@ -57,7 +57,6 @@ SedDataSource::SedDataSource(unsigned int level, unsigned int version)
   , mIndexSet ("")
   , mSlices (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -109,6 +108,36 @@ SedDataSource::operator=(const SedDataSource& rhs)
 }
 
 
+/*
+ * Move constructor for SedDataSource.
+ */
+SedDataSource::SedDataSource(SedDataSource&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mIndexSet ( std::move(orig.mIndexSet) )
+  , mSlices ( std::move(orig.mSlices) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedDataSource.
+ */
+SedDataSource&
+SedDataSource::operator=(SedDataSource&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mIndexSet = std::move(rhs.mIndexSet);
+    mSlices = std::move(rhs.mSlices);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedDataSource object.
  */
@@ -160,6 +189,7 @@ SedDataSource::setIndexSet(const std::string& indexSet)
   }
   else
   {
+    sIdRefChanged(mIndexSet, indexSet);
     mIndexSet = indexSet;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -172,6 +202,7 @@ SedDataSource::setIndexSet(const std::string& indexSet)
 int
 SedDataSource::unsetIndexSet()
 {
+  sIdRefChanged(mIndexSet, std::string());
   mIndexSet.erase();
 
   if (mIndexSet.empty() == true)
@@ -362,6 +393,19 @@ SedDataSource::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedDataSource to refs.
+ */
+void
+SedDataSource::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetIndexSet())
+  {
+    refs.push_back(mIndexSet);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedDataSource object.
  */
@@ -865,6 +909,20 @@ SedDataSource::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedDataSource
+ */
+void
+SedDataSource::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mSlices, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -115,6 +115,27 @@ public:
   SedDataSource& operator=(const SedDataSource& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedDataSource.
+   *
+   * @param orig the SedDataSource instance to move from; it is left empty.
+   */
+  SedDataSource(SedDataSource&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedDataSource.
+   *
+   * @param rhs the SedDataSource object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedDataSource& operator=(SedDataSource&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDataSource object.
    *
@@ -395,6 +416,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedDataSource object.
    *
@@ -832,6 +859,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedDataSource.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -46,6 +46,14 @@
 #include <sedml/SedPlot3D.h>
 #include <sedml/SedFigure.h>
 #include <sedml/SedParameterEstimationResultPlot.h>
+#include <sedml/SedComputeChange.h>
+#include <sedml/SedFunctionalRange.h>
+#include <sedml/SedSetValue.h>
+#include <sedml/SedSubTask.h>
+
+#include <sstream>
+#include <type_traits>
+#include <unordered_set>
 
 
 using namespace std;
@@ -70,6 +78,13 @@ SedDocument::SedDocument(unsigned int level, unsigned int version)
   , mIsSetLevel (false)
   , mVersion (SEDML_INT_MAX)
   , mIsSetVersion (false)
+  , mArena ()
+  , mSIdIndex ()
+  , mSIdIndexValid (false)
+  , mSIdIndexHasDuplicates (false)
+  , mSIdIndexGeneration (0)
+  , mSIdRefIndex ()
+  , mSIdRefIndexValid (false)
   , mAlgorithmParameters (level, version)
   , mDataDescriptions (level, version)
   , mModels (level, version)
@@ -78,8 +93,21 @@ SedDocument::SedDocument(unsigned int level, unsigned int version)
   , mDataGenerators (level, version)
   , mOutputs (level, version)
   , mStyles (level, version)
+  , mStreamHandler (NULL)
+  , mStreamStopped (false)
+  , mNumStreamedInList (0)
+  , mListsToRead (NULL)
+  , mKeepSkippedLists (false)
+  , mSkippedLists ()
+  , mMaxErrors (0)
+  , mFailFastSeverity (LIBSEDML_SEV_NOT_APPLICABLE)
+  , mLocationURI ()
+  , mSharedBase ()
+  , mSharedLists (0)
+  , mResolvedStyles ()
+  , mRetiredStyles ()
+  , mResolvedStylesMutex ()
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   setLevel(level);
   setVersion(version);
   setSedDocument(this);
@@ -96,6 +124,13 @@ SedDocument::SedDocument(SedNamespaces *sedmlns)
   , mIsSetLevel (false)
   , mVersion (SEDML_INT_MAX)
   , mIsSetVersion (false)
+  , mArena ()
+  , mSIdIndex ()
+  , mSIdIndexValid (false)
+  , mSIdIndexHasDuplicates (false)
+  , mSIdIndexGeneration (0)
+  , mSIdRefIndex ()
+  , mSIdRefIndexValid (false)
   , mAlgorithmParameters (sedmlns)
   , mDataDescriptions (sedmlns)
   , mModels (sedmlns)
@@ -104,6 +139,20 @@ SedDocument::SedDocument(SedNamespaces *sedmlns)
   , mDataGenerators (sedmlns)
   , mOutputs (sedmlns)
   , mStyles (sedmlns)
+  , mStreamHandler (NULL)
+  , mStreamStopped (false)
+  , mNumStreamedInList (0)
+  , mListsToRead (NULL)
+  , mKeepSkippedLists (false)
+  , mSkippedLists ()
+  , mMaxErrors (0)
+  , mFailFastSeverity (LIBSEDML_SEV_NOT_APPLICABLE)
+  , mLocationURI ()
+  , mSharedBase ()
+  , mSharedLists (0)
+  , mResolvedStyles ()
+  , mRetiredStyles ()
+  , mResolvedStylesMutex ()
 {
   setElementNamespace(sedmlns->getURI());
   setLevel(sedmlns->getLevel());
@@ -122,6 +171,13 @@ SedDocument::SedDocument(const SedDocument& orig)
   , mIsSetLevel ( orig.mIsSetLevel )
   , mVersion ( orig.mVersion )
   , mIsSetVersion ( orig.mIsSetVersion )
+  , mArena ()
+  , mSIdIndex ()
+  , mSIdIndexValid (false)
+  , mSIdIndexHasDuplicates (false)
+  , mSIdIndexGeneration (0)
+  , mSIdRefIndex ()
+  , mSIdRefIndexValid (false)
   , mAlgorithmParameters (orig.mAlgorithmParameters)
   , mDataDescriptions ( orig.mDataDescriptions )
   , mModels ( orig.mModels )
@@ -130,6 +186,20 @@ SedDocument::SedDocument(const SedDocument& orig)
   , mDataGenerators ( orig.mDataGenerators )
   , mOutputs ( orig.mOutputs )
   , mStyles ( orig.mStyles )
+  , mStreamHandler (NULL)
+  , mStreamStopped (false)
+  , mNumStreamedInList (0)
+  , mListsToRead (NULL)
+  , mKeepSkippedLists (false)
+  , mSkippedLists ( orig.mSkippedLists )
+  , mMaxErrors (0)
+  , mFailFastSeverity (LIBSEDML_SEV_NOT_APPLICABLE)
+  , mLocationURI ( orig.mLocationURI )
+  , mSharedBase ( orig.mSharedBase )
+  , mSharedLists ( orig.mSharedLists )
+  , mResolvedStyles ()
+  , mRetiredStyles ()
+  , mResolvedStylesMutex ()
 {
   setSedDocument(this);
 
@@ -145,6 +215,9 @@ SedDocument::operator=(const SedDocument& rhs)
 {
   if (&rhs != this)
   {
+    invalidateSIdIndex();
+    mResolvedStyles.reset();
+    mRetiredStyles.clear();
     SedBase::operator=(rhs);
     mLevel = rhs.mLevel;
     mIsSetLevel = rhs.mIsSetLevel;
@@ -158,6 +231,99 @@ SedDocument::operator=(const SedDocument& rhs)
     mDataGenerators = rhs.mDataGenerators;
     mOutputs = rhs.mOutputs;
     mStyles = rhs.mStyles;
+    mSkippedLists = rhs.mSkippedLists;
+    mLocationURI = rhs.mLocationURI;
+    mSharedBase = rhs.mSharedBase;
+    mSharedLists = rhs.mSharedLists;
+    connectToChild();
+    setSedDocument(this);
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move constructor for SedDocument.
+ */
+SedDocument::SedDocument(SedDocument&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mLevel ( orig.mLevel )
+  , mIsSetLevel ( orig.mIsSetLevel )
+  , mVersion ( orig.mVersion )
+  , mIsSetVersion ( orig.mIsSetVersion )
+  , mArena ( std::move(orig.mArena) )
+  , mSIdIndex ()
+  , mSIdIndexValid (false)
+  , mSIdIndexHasDuplicates (false)
+  , mSIdIndexGeneration (0)
+  , mSIdRefIndex ()
+  , mSIdRefIndexValid (false)
+  , mAlgorithmParameters ( std::move(orig.mAlgorithmParameters) )
+  , mDataDescriptions ( std::move(orig.mDataDescriptions) )
+  , mModels ( std::move(orig.mModels) )
+  , mSimulations ( std::move(orig.mSimulations) )
+  , mAbstractTasks ( std::move(orig.mAbstractTasks) )
+  , mDataGenerators ( std::move(orig.mDataGenerators) )
+  , mOutputs ( std::move(orig.mOutputs) )
+  , mStyles ( std::move(orig.mStyles) )
+  , mStreamHandler (NULL)
+  , mStreamStopped (false)
+  , mNumStreamedInList (0)
+  , mListsToRead (NULL)
+  , mKeepSkippedLists (false)
+  , mSkippedLists ( std::move(orig.mSkippedLists) )
+  , mMaxErrors (0)
+  , mFailFastSeverity (LIBSEDML_SEV_NOT_APPLICABLE)
+  , mLocationURI ( std::move(orig.mLocationURI) )
+  , mSharedBase ( std::move(orig.mSharedBase) )
+  , mSharedLists ( orig.mSharedLists )
+  , mResolvedStyles ()
+  , mRetiredStyles ()
+  , mResolvedStylesMutex ()
+{
+  // only the elements of the lists owned by orig have moved here
+  unindexElementsOf(orig);
+  orig.mSharedLists = 0;
+
+  setSedDocument(this);
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedDocument.
+ */
+SedDocument&
+SedDocument::operator=(SedDocument&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    invalidateSIdIndex();
+    mResolvedStyles.reset();
+    mRetiredStyles.clear();
+    SedBase::operator=(std::move(rhs));
+    mLevel = rhs.mLevel;
+    mIsSetLevel = rhs.mIsSetLevel;
+    mVersion = rhs.mVersion;
+    mIsSetVersion = rhs.mIsSetVersion;
+    mAlgorithmParameters = std::move(rhs.mAlgorithmParameters);
+    mDataDescriptions = std::move(rhs.mDataDescriptions);
+    mModels = std::move(rhs.mModels);
+    mSimulations = std::move(rhs.mSimulations);
+    mAbstractTasks = std::move(rhs.mAbstractTasks);
+    mDataGenerators = std::move(rhs.mDataGenerators);
+    mOutputs = std::move(rhs.mOutputs);
+    mStyles = std::move(rhs.mStyles);
+    // only now that the previous elements are gone can their arena go
+    mArena = std::move(rhs.mArena);
+    mSkippedLists = std::move(rhs.mSkippedLists);
+    mLocationURI = std::move(rhs.mLocationURI);
+    mSharedBase = std::move(rhs.mSharedBase);
+    mSharedLists = rhs.mSharedLists;
+    unindexElementsOf(rhs);
+    rhs.mSharedLists = 0;
     connectToChild();
     setSedDocument(this);
   }
@@ -166,6 +332,20 @@ SedDocument::operator=(const SedDocument& rhs)
 }
 
 
+// the SId index is left without allocating, so moving never throws
+static_assert(std::is_nothrow_move_constructible<SedDocument>::value &&
+              std::is_nothrow_move_assignable<SedDocument>::value &&
+              std::is_nothrow_move_constructible<SedModel>::value &&
+              std::is_nothrow_move_assignable<SedModel>::value &&
+              std::is_nothrow_move_constructible<SedTask>::value &&
+              std::is_nothrow_move_assignable<SedTask>::value &&
+              std::is_nothrow_move_constructible<SedPlot2D>::value &&
+              std::is_nothrow_move_assignable<SedPlot2D>::value &&
+              std::is_nothrow_move_constructible<SedListOfModels>::value &&
+              std::is_nothrow_move_assignable<SedListOfModels>::value,
+              "SED-ML objects must be nothrow movable");
+
+
 /*
  * Creates and returns a deep copy of this SedDocument object.
  */
@@ -176,11 +356,43 @@ SedDocument::clone() const
 }
 
 
+/*
+ * Creates a copy-on-write clone of the given SedDocument.
+ */
+SedDocument*
+SedDocument::cloneOnWrite(const std::shared_ptr<const SedDocument>& base)
+{
+  if (base.get() == NULL)
+  {
+    return NULL;
+  }
+
+  SedDocument* doc = new SedDocument(base->getLevel(), base->getVersion());
+
+  static_cast<SedBase&>(*doc) = *base;
+  doc->mLevel = base->mLevel;
+  doc->mIsSetLevel = base->mIsSetLevel;
+  doc->mVersion = base->mVersion;
+  doc->mIsSetVersion = base->mIsSetVersion;
+  doc->mSkippedLists = base->mSkippedLists;
+  doc->mLocationURI = base->mLocationURI;
+  doc->mSharedBase = base;
+  doc->mSharedLists = (1u << 8) - 1;
+  doc->setSedDocument(doc);
+  doc->connectToChild();
+
+  return doc;
+}
+
+
 /*
  * Destructor for SedDocument.
  */
 SedDocument::~SedDocument()
 {
+  // the items are about to be deleted, no need to keep the indexes current
+  mSIdIndexValid = false;
+  mSIdRefIndexValid = false;
 }
 
 
@@ -307,7 +519,7 @@ SedDocument::unsetVersion()
 const SedListOfAlgorithmParameters*
 SedDocument::getListOfAlgorithmParameters() const
 {
-    return &mAlgorithmParameters;
+    return &readList(&SedDocument::mAlgorithmParameters);
 }
 
 
@@ -317,7 +529,7 @@ SedDocument::getListOfAlgorithmParameters() const
 SedListOfAlgorithmParameters*
 SedDocument::getListOfAlgorithmParameters()
 {
-    return &mAlgorithmParameters;
+    return &writeList(&SedDocument::mAlgorithmParameters);
 }
 
 
@@ -327,7 +539,7 @@ SedDocument::getListOfAlgorithmParameters()
 SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(unsigned int n)
 {
-    return mAlgorithmParameters.get(n);
+    return writeList(&SedDocument::mAlgorithmParameters).get(n);
 }
 
 
@@ -337,7 +549,7 @@ SedDocument::getAlgorithmParameter(unsigned int n)
 const SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(unsigned int n) const
 {
-    return mAlgorithmParameters.get(n);
+    return readList(&SedDocument::mAlgorithmParameters).get(n);
 }
 
 
@@ -347,7 +559,7 @@ SedDocument::getAlgorithmParameter(unsigned int n) const
 SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(const string& id)
 {
-    return mAlgorithmParameters.get(id);
+    return writeList(&SedDocument::mAlgorithmParameters).get(id);
 }
 
 
@@ -357,7 +569,7 @@ SedDocument::getAlgorithmParameter(const string& id)
 const SedAlgorithmParameter*
 SedDocument::getAlgorithmParameter(const string& id) const
 {
-    return mAlgorithmParameters.get(id);
+    return readList(&SedDocument::mAlgorithmParameters).get(id);
 }
 
 
@@ -394,7 +606,7 @@ SedDocument::addAlgorithmParameter(const SedAlgorithmParameter* sap)
     }
     else
     {
-        return mAlgorithmParameters.append(sap);
+        return writeList(&SedDocument::mAlgorithmParameters).append(sap);
     }
 }
 
@@ -405,7 +617,7 @@ SedDocument::addAlgorithmParameter(const SedAlgorithmParameter* sap)
 unsigned int
 SedDocument::getNumAlgorithmParameters() const
 {
-    return mAlgorithmParameters.size();
+    return readList(&SedDocument::mAlgorithmParameters).size();
 }
 
 
@@ -432,7 +644,7 @@ SedDocument::createAlgorithmParameter()
 
     if (sap != NULL)
     {
-        mAlgorithmParameters.appendAndOwn(sap);
+        writeList(&SedDocument::mAlgorithmParameters).appendAndOwn(sap);
     }
 
     return sap;
@@ -446,7 +658,7 @@ SedDocument::createAlgorithmParameter()
 SedAlgorithmParameter*
 SedDocument::removeAlgorithmParameter(unsigned int n)
 {
-    return mAlgorithmParameters.remove(n);
+    return writeList(&SedDocument::mAlgorithmParameters).remove(n);
 }
 
 
@@ -457,7 +669,7 @@ SedDocument::removeAlgorithmParameter(unsigned int n)
 SedAlgorithmParameter*
 SedDocument::removeAlgorithmParameter(const string& id)
 {
-    return mAlgorithmParameters.remove(id);
+    return writeList(&SedDocument::mAlgorithmParameters).remove(id);
 }
 
 
@@ -467,7 +679,7 @@ SedDocument::removeAlgorithmParameter(const string& id)
 const SedListOfDataDescriptions*
 SedDocument::getListOfDataDescriptions() const
 {
-  return &mDataDescriptions;
+  return &readList(&SedDocument::mDataDescriptions);
 }
 
 
@@ -477,7 +689,7 @@ SedDocument::getListOfDataDescriptions() const
 SedListOfDataDescriptions*
 SedDocument::getListOfDataDescriptions()
 {
-  return &mDataDescriptions;
+  return &writeList(&SedDocument::mDataDescriptions);
 }
 
 
@@ -487,7 +699,7 @@ SedDocument::getListOfDataDescriptions()
 SedDataDescription*
 SedDocument::getDataDescription(unsigned int n)
 {
-  return mDataDescriptions.get(n);
+  return writeList(&SedDocument::mDataDescriptions).get(n);
 }
 
 
@@ -497,7 +709,7 @@ SedDocument::getDataDescription(unsigned int n)
 const SedDataDescription*
 SedDocument::getDataDescription(unsigned int n) const
 {
-  return mDataDescriptions.get(n);
+  return readList(&SedDocument::mDataDescriptions).get(n);
 }
 
 
@@ -507,7 +719,7 @@ SedDocument::getDataDescription(unsigned int n) const
 SedDataDescription*
 SedDocument::getDataDescription(const std::string& sid)
 {
-  return mDataDescriptions.get(sid);
+  return writeList(&SedDocument::mDataDescriptions).get(sid);
 }
 
 
@@ -517,7 +729,7 @@ SedDocument::getDataDescription(const std::string& sid)
 const SedDataDescription*
 SedDocument::getDataDescription(const std::string& sid) const
 {
-  return mDataDescriptions.get(sid);
+  return readList(&SedDocument::mDataDescriptions).get(sid);
 }
 
 
@@ -548,13 +760,13 @@ SedDocument::addDataDescription(const SedDataDescription* sdd)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sdd->isSetId() && (mDataDescriptions.get(sdd->getId())) != NULL)
+  else if (sdd->isSetId() && (writeList(&SedDocument::mDataDescriptions).get(sdd->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mDataDescriptions.append(sdd);
+    return writeList(&SedDocument::mDataDescriptions).append(sdd);
   }
 }
 
@@ -565,7 +777,7 @@ SedDocument::addDataDescription(const SedDataDescription* sdd)
 unsigned int
 SedDocument::getNumDataDescriptions() const
 {
-  return mDataDescriptions.size();
+  return readList(&SedDocument::mDataDescriptions).size();
 }
 
 
@@ -588,7 +800,7 @@ SedDocument::createDataDescription()
 
   if (sdd != NULL)
   {
-    mDataDescriptions.appendAndOwn(sdd);
+    writeList(&SedDocument::mDataDescriptions).appendAndOwn(sdd);
   }
 
   return sdd;
@@ -602,7 +814,7 @@ SedDocument::createDataDescription()
 SedDataDescription*
 SedDocument::removeDataDescription(unsigned int n)
 {
-  return mDataDescriptions.remove(n);
+  return writeList(&SedDocument::mDataDescriptions).remove(n);
 }
 
 
@@ -613,7 +825,7 @@ SedDocument::removeDataDescription(unsigned int n)
 SedDataDescription*
 SedDocument::removeDataDescription(const std::string& sid)
 {
-  return mDataDescriptions.remove(sid);
+  return writeList(&SedDocument::mDataDescriptions).remove(sid);
 }
 
 
@@ -623,7 +835,7 @@ SedDocument::removeDataDescription(const std::string& sid)
 const SedListOfModels*
 SedDocument::getListOfModels() const
 {
-  return &mModels;
+  return &readList(&SedDocument::mModels);
 }
 
 
@@ -633,7 +845,7 @@ SedDocument::getListOfModels() const
 SedListOfModels*
 SedDocument::getListOfModels()
 {
-  return &mModels;
+  return &writeList(&SedDocument::mModels);
 }
 
 
@@ -643,7 +855,7 @@ SedDocument::getListOfModels()
 SedModel*
 SedDocument::getModel(unsigned int n)
 {
-  return mModels.get(n);
+  return writeList(&SedDocument::mModels).get(n);
 }
 
 
@@ -653,7 +865,7 @@ SedDocument::getModel(unsigned int n)
 const SedModel*
 SedDocument::getModel(unsigned int n) const
 {
-  return mModels.get(n);
+  return readList(&SedDocument::mModels).get(n);
 }
 
 
@@ -663,7 +875,7 @@ SedDocument::getModel(unsigned int n) const
 SedModel*
 SedDocument::getModel(const std::string& sid)
 {
-  return mModels.get(sid);
+  return writeList(&SedDocument::mModels).get(sid);
 }
 
 
@@ -673,7 +885,7 @@ SedDocument::getModel(const std::string& sid)
 const SedModel*
 SedDocument::getModel(const std::string& sid) const
 {
-  return mModels.get(sid);
+  return readList(&SedDocument::mModels).get(sid);
 }
 
 
@@ -704,13 +916,13 @@ SedDocument::addModel(const SedModel* sm)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sm->isSetId() && (mModels.get(sm->getId())) != NULL)
+  else if (sm->isSetId() && (writeList(&SedDocument::mModels).get(sm->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mModels.append(sm);
+    return writeList(&SedDocument::mModels).append(sm);
   }
 }
 
@@ -721,7 +933,7 @@ SedDocument::addModel(const SedModel* sm)
 unsigned int
 SedDocument::getNumModels() const
 {
-  return mModels.size();
+  return readList(&SedDocument::mModels).size();
 }
 
 
@@ -744,7 +956,7 @@ SedDocument::createModel()
 
   if (sm != NULL)
   {
-    mModels.appendAndOwn(sm);
+    writeList(&SedDocument::mModels).appendAndOwn(sm);
   }
 
   return sm;
@@ -757,7 +969,7 @@ SedDocument::createModel()
 SedModel*
 SedDocument::removeModel(unsigned int n)
 {
-  return mModels.remove(n);
+  return writeList(&SedDocument::mModels).remove(n);
 }
 
 
@@ -768,7 +980,7 @@ SedDocument::removeModel(unsigned int n)
 SedModel*
 SedDocument::removeModel(const std::string& sid)
 {
-  return mModels.remove(sid);
+  return writeList(&SedDocument::mModels).remove(sid);
 }
 
 
@@ -778,7 +990,7 @@ SedDocument::removeModel(const std::string& sid)
 const SedListOfSimulations*
 SedDocument::getListOfSimulations() const
 {
-  return &mSimulations;
+  return &readList(&SedDocument::mSimulations);
 }
 
 
@@ -788,7 +1000,7 @@ SedDocument::getListOfSimulations() const
 SedListOfSimulations*
 SedDocument::getListOfSimulations()
 {
-  return &mSimulations;
+  return &writeList(&SedDocument::mSimulations);
 }
 
 
@@ -798,7 +1010,7 @@ SedDocument::getListOfSimulations()
 SedSimulation*
 SedDocument::getSimulation(unsigned int n)
 {
-  return mSimulations.get(n);
+  return writeList(&SedDocument::mSimulations).get(n);
 }
 
 
@@ -808,7 +1020,7 @@ SedDocument::getSimulation(unsigned int n)
 const SedSimulation*
 SedDocument::getSimulation(unsigned int n) const
 {
-  return mSimulations.get(n);
+  return readList(&SedDocument::mSimulations).get(n);
 }
 
 
@@ -818,7 +1030,7 @@ SedDocument::getSimulation(unsigned int n) const
 SedSimulation*
 SedDocument::getSimulation(const std::string& sid)
 {
-  return mSimulations.get(sid);
+  return writeList(&SedDocument::mSimulations).get(sid);
 }
 
 
@@ -828,7 +1040,7 @@ SedDocument::getSimulation(const std::string& sid)
 const SedSimulation*
 SedDocument::getSimulation(const std::string& sid) const
 {
-  return mSimulations.get(sid);
+  return readList(&SedDocument::mSimulations).get(sid);
 }
 
 
@@ -863,13 +1075,13 @@ SedDocument::addSimulation(const SedSimulation* ss)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (ss->isSetId() && (mSimulations.get(ss->getId())) != NULL)
+  else if (ss->isSetId() && (writeList(&SedDocument::mSimulations).get(ss->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mSimulations.append(ss);
+    return writeList(&SedDocument::mSimulations).append(ss);
   }
 }
 
@@ -880,7 +1092,7 @@ SedDocument::addSimulation(const SedSimulation* ss)
 unsigned int
 SedDocument::getNumSimulations() const
 {
-  return mSimulations.size();
+  return readList(&SedDocument::mSimulations).size();
 }
 
 
@@ -903,7 +1115,7 @@ SedDocument::createUniformTimeCourse()
 
   if (sutc != NULL)
   {
-    mSimulations.appendAndOwn(sutc);
+    writeList(&SedDocument::mSimulations).appendAndOwn(sutc);
   }
 
   return sutc;
@@ -929,7 +1141,7 @@ SedDocument::createOneStep()
 
   if (sos != NULL)
   {
-    mSimulations.appendAndOwn(sos);
+    writeList(&SedDocument::mSimulations).appendAndOwn(sos);
   }
 
   return sos;
@@ -955,7 +1167,7 @@ SedDocument::createSteadyState()
 
   if (sss != NULL)
   {
-    mSimulations.appendAndOwn(sss);
+    writeList(&SedDocument::mSimulations).appendAndOwn(sss);
   }
 
   return sss;
@@ -981,7 +1193,7 @@ SedDocument::createAnalysis()
 
     if (sss != NULL)
     {
-        mSimulations.appendAndOwn(sss);
+        writeList(&SedDocument::mSimulations).appendAndOwn(sss);
     }
 
     return sss;
@@ -995,7 +1207,7 @@ SedDocument::createAnalysis()
 SedSimulation*
 SedDocument::removeSimulation(unsigned int n)
 {
-  return mSimulations.remove(n);
+  return writeList(&SedDocument::mSimulations).remove(n);
 }
 
 
@@ -1006,7 +1218,7 @@ SedDocument::removeSimulation(unsigned int n)
 SedSimulation*
 SedDocument::removeSimulation(const std::string& sid)
 {
-  return mSimulations.remove(sid);
+  return writeList(&SedDocument::mSimulations).remove(sid);
 }
 
 
@@ -1016,7 +1228,7 @@ SedDocument::removeSimulation(const std::string& sid)
 const SedListOfTasks*
 SedDocument::getListOfTasks() const
 {
-  return &mAbstractTasks;
+  return &readList(&SedDocument::mAbstractTasks);
 }
 
 
@@ -1026,7 +1238,7 @@ SedDocument::getListOfTasks() const
 SedListOfTasks*
 SedDocument::getListOfTasks()
 {
-  return &mAbstractTasks;
+  return &writeList(&SedDocument::mAbstractTasks);
 }
 
 
@@ -1036,7 +1248,7 @@ SedDocument::getListOfTasks()
 SedAbstractTask*
 SedDocument::getTask(unsigned int n)
 {
-  return mAbstractTasks.get(n);
+  return writeList(&SedDocument::mAbstractTasks).get(n);
 }
 
 
@@ -1046,7 +1258,7 @@ SedDocument::getTask(unsigned int n)
 const SedAbstractTask*
 SedDocument::getTask(unsigned int n) const
 {
-  return mAbstractTasks.get(n);
+  return readList(&SedDocument::mAbstractTasks).get(n);
 }
 
 
@@ -1056,7 +1268,7 @@ SedDocument::getTask(unsigned int n) const
 SedAbstractTask*
 SedDocument::getTask(const std::string& sid)
 {
-  return mAbstractTasks.get(sid);
+  return writeList(&SedDocument::mAbstractTasks).get(sid);
 }
 
 
@@ -1066,7 +1278,7 @@ SedDocument::getTask(const std::string& sid)
 const SedAbstractTask*
 SedDocument::getTask(const std::string& sid) const
 {
-  return mAbstractTasks.get(sid);
+  return readList(&SedDocument::mAbstractTasks).get(sid);
 }
 
 
@@ -1097,13 +1309,13 @@ SedDocument::addTask(const SedAbstractTask* sat)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sat->isSetId() && (mAbstractTasks.get(sat->getId())) != NULL)
+  else if (sat->isSetId() && (writeList(&SedDocument::mAbstractTasks).get(sat->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mAbstractTasks.append(sat);
+    return writeList(&SedDocument::mAbstractTasks).append(sat);
   }
 }
 
@@ -1114,7 +1326,7 @@ SedDocument::addTask(const SedAbstractTask* sat)
 unsigned int
 SedDocument::getNumTasks() const
 {
-  return mAbstractTasks.size();
+  return readList(&SedDocument::mAbstractTasks).size();
 }
 
 
@@ -1137,7 +1349,7 @@ SedDocument::createTask()
 
   if (st != NULL)
   {
-    mAbstractTasks.appendAndOwn(st);
+    writeList(&SedDocument::mAbstractTasks).appendAndOwn(st);
   }
 
   return st;
@@ -1163,7 +1375,7 @@ SedDocument::createRepeatedTask()
 
   if (srt != NULL)
   {
-    mAbstractTasks.appendAndOwn(srt);
+    writeList(&SedDocument::mAbstractTasks).appendAndOwn(srt);
   }
 
   return srt;
@@ -1189,7 +1401,7 @@ SedDocument::createParameterEstimationTask()
 
   if (spet != NULL)
   {
-    mAbstractTasks.appendAndOwn(spet);
+    writeList(&SedDocument::mAbstractTasks).appendAndOwn(spet);
   }
 
   return spet;
@@ -1203,7 +1415,7 @@ SedDocument::createParameterEstimationTask()
 SedAbstractTask*
 SedDocument::removeTask(unsigned int n)
 {
-  return mAbstractTasks.remove(n);
+  return writeList(&SedDocument::mAbstractTasks).remove(n);
 }
 
 
@@ -1214,7 +1426,7 @@ SedDocument::removeTask(unsigned int n)
 SedAbstractTask*
 SedDocument::removeTask(const std::string& sid)
 {
-  return mAbstractTasks.remove(sid);
+  return writeList(&SedDocument::mAbstractTasks).remove(sid);
 }
 
 
@@ -1224,7 +1436,7 @@ SedDocument::removeTask(const std::string& sid)
 const SedListOfDataGenerators*
 SedDocument::getListOfDataGenerators() const
 {
-  return &mDataGenerators;
+  return &readList(&SedDocument::mDataGenerators);
 }
 
 
@@ -1234,7 +1446,7 @@ SedDocument::getListOfDataGenerators() const
 SedListOfDataGenerators*
 SedDocument::getListOfDataGenerators()
 {
-  return &mDataGenerators;
+  return &writeList(&SedDocument::mDataGenerators);
 }
 
 
@@ -1244,7 +1456,7 @@ SedDocument::getListOfDataGenerators()
 SedDataGenerator*
 SedDocument::getDataGenerator(unsigned int n)
 {
-  return mDataGenerators.get(n);
+  return writeList(&SedDocument::mDataGenerators).get(n);
 }
 
 
@@ -1254,7 +1466,7 @@ SedDocument::getDataGenerator(unsigned int n)
 const SedDataGenerator*
 SedDocument::getDataGenerator(unsigned int n) const
 {
-  return mDataGenerators.get(n);
+  return readList(&SedDocument::mDataGenerators).get(n);
 }
 
 
@@ -1264,7 +1476,7 @@ SedDocument::getDataGenerator(unsigned int n) const
 SedDataGenerator*
 SedDocument::getDataGenerator(const std::string& sid)
 {
-  return mDataGenerators.get(sid);
+  return writeList(&SedDocument::mDataGenerators).get(sid);
 }
 
 
@@ -1274,7 +1486,7 @@ SedDocument::getDataGenerator(const std::string& sid)
 const SedDataGenerator*
 SedDocument::getDataGenerator(const std::string& sid) const
 {
-  return mDataGenerators.get(sid);
+  return readList(&SedDocument::mDataGenerators).get(sid);
 }
 
 
@@ -1309,13 +1521,13 @@ SedDocument::addDataGenerator(const SedDataGenerator* sdg)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (sdg->isSetId() && (mDataGenerators.get(sdg->getId())) != NULL)
+  else if (sdg->isSetId() && (writeList(&SedDocument::mDataGenerators).get(sdg->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mDataGenerators.append(sdg);
+    return writeList(&SedDocument::mDataGenerators).append(sdg);
   }
 }
 
@@ -1326,7 +1538,7 @@ SedDocument::addDataGenerator(const SedDataGenerator* sdg)
 unsigned int
 SedDocument::getNumDataGenerators() const
 {
-  return mDataGenerators.size();
+  return readList(&SedDocument::mDataGenerators).size();
 }
 
 
@@ -1349,7 +1561,7 @@ SedDocument::createDataGenerator()
 
   if (sdg != NULL)
   {
-    mDataGenerators.appendAndOwn(sdg);
+    writeList(&SedDocument::mDataGenerators).appendAndOwn(sdg);
   }
 
   return sdg;
@@ -1363,7 +1575,7 @@ SedDocument::createDataGenerator()
 SedDataGenerator*
 SedDocument::removeDataGenerator(unsigned int n)
 {
-  return mDataGenerators.remove(n);
+  return writeList(&SedDocument::mDataGenerators).remove(n);
 }
 
 
@@ -1374,7 +1586,7 @@ SedDocument::removeDataGenerator(unsigned int n)
 SedDataGenerator*
 SedDocument::removeDataGenerator(const std::string& sid)
 {
-  return mDataGenerators.remove(sid);
+  return writeList(&SedDocument::mDataGenerators).remove(sid);
 }
 
 
@@ -1384,7 +1596,7 @@ SedDocument::removeDataGenerator(const std::string& sid)
 const SedListOfOutputs*
 SedDocument::getListOfOutputs() const
 {
-  return &mOutputs;
+  return &readList(&SedDocument::mOutputs);
 }
 
 
@@ -1394,7 +1606,7 @@ SedDocument::getListOfOutputs() const
 SedListOfOutputs*
 SedDocument::getListOfOutputs()
 {
-  return &mOutputs;
+  return &writeList(&SedDocument::mOutputs);
 }
 
 
@@ -1404,7 +1616,7 @@ SedDocument::getListOfOutputs()
 SedOutput*
 SedDocument::getOutput(unsigned int n)
 {
-  return mOutputs.get(n);
+  return writeList(&SedDocument::mOutputs).get(n);
 }
 
 
@@ -1414,7 +1626,7 @@ SedDocument::getOutput(unsigned int n)
 const SedOutput*
 SedDocument::getOutput(unsigned int n) const
 {
-  return mOutputs.get(n);
+  return readList(&SedDocument::mOutputs).get(n);
 }
 
 
@@ -1424,7 +1636,7 @@ SedDocument::getOutput(unsigned int n) const
 SedOutput*
 SedDocument::getOutput(const std::string& sid)
 {
-  return mOutputs.get(sid);
+  return writeList(&SedDocument::mOutputs).get(sid);
 }
 
 
@@ -1434,7 +1646,7 @@ SedDocument::getOutput(const std::string& sid)
 const SedOutput*
 SedDocument::getOutput(const std::string& sid) const
 {
-  return mOutputs.get(sid);
+  return readList(&SedDocument::mOutputs).get(sid);
 }
 
 
@@ -1465,13 +1677,13 @@ SedDocument::addOutput(const SedOutput* so)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (so->isSetId() && (mOutputs.get(so->getId())) != NULL)
+  else if (so->isSetId() && (writeList(&SedDocument::mOutputs).get(so->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mOutputs.append(so);
+    return writeList(&SedDocument::mOutputs).append(so);
   }
 }
 
@@ -1482,7 +1694,7 @@ SedDocument::addOutput(const SedOutput* so)
 unsigned int
 SedDocument::getNumOutputs() const
 {
-  return mOutputs.size();
+  return readList(&SedDocument::mOutputs).size();
 }
 
 
@@ -1505,7 +1717,7 @@ SedDocument::createReport()
 
   if (sr != NULL)
   {
-    mOutputs.appendAndOwn(sr);
+    writeList(&SedDocument::mOutputs).appendAndOwn(sr);
   }
 
   return sr;
@@ -1531,7 +1743,7 @@ SedDocument::createPlot2D()
 
   if (spd != NULL)
   {
-    mOutputs.appendAndOwn(spd);
+    writeList(&SedDocument::mOutputs).appendAndOwn(spd);
   }
 
   return spd;
@@ -1557,7 +1769,7 @@ SedDocument::createPlot3D()
 
   if (spd != NULL)
   {
-    mOutputs.appendAndOwn(spd);
+    writeList(&SedDocument::mOutputs).appendAndOwn(spd);
   }
 
   return spd;
@@ -1583,7 +1795,7 @@ SedDocument::createFigure()
 
   if (sf != NULL)
   {
-    mOutputs.appendAndOwn(sf);
+    writeList(&SedDocument::mOutputs).appendAndOwn(sf);
   }
 
   return sf;
@@ -1610,7 +1822,7 @@ SedDocument::createParameterEstimationResultPlot()
 
   if (sperp != NULL)
   {
-    mOutputs.appendAndOwn(sperp);
+    writeList(&SedDocument::mOutputs).appendAndOwn(sperp);
   }
 
   return sperp;
@@ -1623,7 +1835,7 @@ SedDocument::createParameterEstimationResultPlot()
 SedOutput*
 SedDocument::removeOutput(unsigned int n)
 {
-  return mOutputs.remove(n);
+  return writeList(&SedDocument::mOutputs).remove(n);
 }
 
 
@@ -1634,7 +1846,7 @@ SedDocument::removeOutput(unsigned int n)
 SedOutput*
 SedDocument::removeOutput(const std::string& sid)
 {
-  return mOutputs.remove(sid);
+  return writeList(&SedDocument::mOutputs).remove(sid);
 }
 
 
@@ -1644,7 +1856,7 @@ SedDocument::removeOutput(const std::string& sid)
 const SedListOfStyles*
 SedDocument::getListOfStyles() const
 {
-  return &mStyles;
+  return &readList(&SedDocument::mStyles);
 }
 
 
@@ -1654,7 +1866,7 @@ SedDocument::getListOfStyles() const
 SedListOfStyles*
 SedDocument::getListOfStyles()
 {
-  return &mStyles;
+  return &writeList(&SedDocument::mStyles);
 }
 
 
@@ -1664,7 +1876,7 @@ SedDocument::getListOfStyles()
 SedStyle*
 SedDocument::getStyle(unsigned int n)
 {
-  return mStyles.get(n);
+  return writeList(&SedDocument::mStyles).get(n);
 }
 
 
@@ -1674,7 +1886,7 @@ SedDocument::getStyle(unsigned int n)
 const SedStyle*
 SedDocument::getStyle(unsigned int n) const
 {
-  return mStyles.get(n);
+  return readList(&SedDocument::mStyles).get(n);
 }
 
 
@@ -1684,7 +1896,7 @@ SedDocument::getStyle(unsigned int n) const
 SedStyle*
 SedDocument::getStyle(const std::string& sid)
 {
-  return mStyles.get(sid);
+  return writeList(&SedDocument::mStyles).get(sid);
 }
 
 
@@ -1694,119 +1906,297 @@ SedDocument::getStyle(const std::string& sid)
 const SedStyle*
 SedDocument::getStyle(const std::string& sid) const
 {
-  return mStyles.get(sid);
+  return readList(&SedDocument::mStyles).get(sid);
 }
 
 
 /*
- * Get a SedStyle from the SedDocument based on its identifier.
+ * Applies top on resolved, the effective style of its base style.
+ */
+static void
+mergeStyle(SedStyle& resolved, const SedStyle& top)
+{
+  resolved.setId(top.getId());
+  resolved.setName(top.getName());
+  resolved.unsetBaseStyle();
+
+  if (top.isSetLineStyle())
+  {
+    if (resolved.isSetLineStyle())
+    {
+      const SedLine* topline = top.getLineStyle();
+      SedLine* baseline = resolved.getLineStyle();
+
+      if (topline->isSetColor())
+      {
+        baseline->setColor(topline->getColor());
+      }
+
+      if (topline->isSetType())
+      {
+        baseline->setType(topline->getType());
+      }
+
+      if (topline->isSetThickness())
+      {
+        baseline->setThickness(topline->getThickness());
+      }
+    }
+    else
+    {
+      resolved.setLineStyle(top.getLineStyle());
+    }
+  }
+
+  if (top.isSetMarkerStyle())
+  {
+    if (resolved.isSetMarkerStyle())
+    {
+      const SedMarker* topmarker = top.getMarkerStyle();
+      SedMarker* basemarker = resolved.getMarkerStyle();
+
+      if (topmarker->isSetType())
+      {
+        basemarker->setType(topmarker->getType());
+      }
+
+      if (topmarker->isSetSize())
+      {
+        basemarker->setSize(topmarker->getSize());
+      }
+
+      if (topmarker->isSetFill())
+      {
+        basemarker->setFill(topmarker->getFill());
+      }
+
+      if (topmarker->isSetLineColor())
+      {
+        basemarker->setLineColor(topmarker->getLineColor());
+      }
+
+      if (topmarker->isSetLineThickness())
+      {
+        basemarker->setLineThickness(topmarker->getLineThickness());
+      }
+    }
+    else
+    {
+      resolved.setMarkerStyle(top.getMarkerStyle());
+    }
+  }
+
+  if (top.isSetFillStyle())
+  {
+    if (resolved.isSetFillStyle())
+    {
+      const SedFill* topfill = top.getFillStyle();
+      SedFill* basefill = resolved.getFillStyle();
+
+      if (topfill->isSetColor())
+      {
+        basefill->setColor(topfill->getColor());
+      }
+
+      //if (topfill->isSetSecondColor())
+      //{
+      //    basefill->setSecondColor(topfill->getSecondColor());
+      //}
+    }
+    else
+    {
+      resolved.setFillStyle(top.getFillStyle());
+    }
+  }
+}
+
+
+/*
+ * Get the effective SedStyle from the SedDocument based on its identifier.
  */
 SedStyle
 SedDocument::getEffectiveStyle(const std::string& sid) const
 {
-    const SedStyle* top =  mStyles.get(sid);
-    if (top == NULL)
+  const SedStyle* resolved = getResolvedStyle(sid);
+
+  if (resolved == NULL)
+  {
+    return SedStyle(mLevel, mVersion);
+  }
+
+  return SedStyle(*resolved);
+}
+
+
+/*
+ * Get the effective SedStyle from the SedDocument based on its identifier,
+ * from the cache of resolved styles.
+ */
+const SedStyle*
+SedDocument::getResolvedStyle(const std::string& sid) const
+{
+  if (readList(&SedDocument::mStyles).get(sid) == NULL)
+  {
+    return NULL;
+  }
+
+  // renderers may call this from several threads, styles resolved before
+  // are found without locking
+  std::shared_ptr<const ResolvedStyleMap> cache =
+    std::atomic_load(&mResolvedStyles);
+
+  if (cache != NULL)
+  {
+    ResolvedStyleMap::const_iterator it = cache->find(sid);
+
+    if (it != cache->end() && isResolvedStyleCurrent(*it->second))
+    {
+      return it->second->style.get();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mResolvedStylesMutex);
+  return resolveStyle(sid);
+}
+
+
+/*
+ * Resolves the given style and publishes it in the cache of resolved styles
+ */
+const SedStyle*
+SedDocument::resolveStyle(const std::string& sid) const
+{
+  const SedListOfStyles& styles = readList(&SedDocument::mStyles);
+  const SedStyle* top = styles.get(sid);
+
+  // entries are only added to a copy of the cache, which replaces it once
+  // complete; another thread may have resolved the style meanwhile
+  std::shared_ptr<const ResolvedStyleMap> cache =
+    std::atomic_load(&mResolvedStyles);
+  std::shared_ptr<ResolvedStyleMap> updated((cache != NULL)
+    ? new ResolvedStyleMap(*cache) : new ResolvedStyleMap());
+
+  ResolvedStyleMap::const_iterator it = updated->find(sid);
+
+  if (it != updated->end() && isResolvedStyleCurrent(*it->second))
+  {
+    return it->second->style.get();
+  }
+
+  // walk up the baseStyle chain, collecting the styles to apply, until it
+  // ends, reaches a style resolved before or runs into a cycle
+  std::vector<StyleLink> chain;
+  StyleLink link = { sid, top, top->getRevision() };
+  chain.push_back(link);
+
+  const ResolvedStyle* resolvedBase = NULL;
+  bool cyclic = false;
+
+  while (chain.back().style != NULL && chain.back().style->isSetBaseStyle())
+  {
+    const std::string& baseId = chain.back().style->getBaseStyle();
+    const SedStyle* base = styles.get(baseId);
+
+    for (size_t i = 0; i < chain.size() && !cyclic; ++i)
     {
-        return SedStyle(mLevel, mVersion);
+      cyclic = (chain[i].style == base);
     }
-    if (!top->isSetBaseStyle())
+
+    if (cyclic)
     {
-        return SedStyle(*top);
+      // the chain is cut where it would run into itself
+      break;
     }
-    SedStyle base = getEffectiveStyle(top->getBaseStyle());
-    base.setId(top->getId());
-    base.setName(top->getName());
-    base.unsetBaseStyle();
 
-    if (top->isSetLineStyle())
+    it = (base != NULL) ? updated->find(baseId) : updated->end();
+
+    if (it != updated->end() && isResolvedStyleCurrent(*it->second))
     {
-        if (base.isSetLineStyle())
-        {
-            const SedLine* topline = top->getLineStyle();
-            SedLine* baseline = base.getLineStyle();
-
-            if (topline->isSetColor())
-            {
-                baseline->setColor(topline->getColor());
-            }
-
-            if (topline->isSetType())
-            {
-                baseline->setType(topline->getType());
-            }
-
-            if (topline->isSetThickness())
-            {
-                baseline->setThickness(topline->getThickness());
-            }
-        }
-        else
+      // unless its chain runs into the styles collected so far, the base
+      // style resolves the same however it is reached
+      bool overlaps = false;
+
+      for (size_t i = 0; i < it->second->chain.size() && !overlaps; ++i)
+      {
+        for (size_t j = 0; j < chain.size() && !overlaps; ++j)
         {
-            base.setLineStyle(top->getLineStyle());
+          overlaps = (it->second->chain[i].style == chain[j].style);
         }
+      }
+
+      if (!overlaps)
+      {
+        resolvedBase = it->second.get();
+        break;
+      }
     }
 
-    if (top->isSetMarkerStyle())
+    link.id = baseId;
+    link.style = base;
+    link.revision = (base != NULL) ? base->getRevision() : 0;
+    chain.push_back(link);
+  }
+
+  // apply the collected styles from the base down, remembering the
+  // effective style of each along the way
+  size_t n = chain.size();
+
+  if (chain.back().style == NULL)
+  {
+    --n;
+  }
+
+  const SedStyle& root = (resolvedBase != NULL) ? *resolvedBase->style
+    : *chain[--n].style;
+  SedStyle resolved(root);
+
+  std::vector<StyleLink> resolvedChain;
+
+  if (resolvedBase != NULL)
+  {
+    resolvedChain = resolvedBase->chain;
+    mergeStyle(resolved, *chain[--n].style);
+  }
+  else
+  {
+    resolved.unsetBaseStyle();
+  }
+
+  resolvedChain.insert(resolvedChain.begin(), chain.begin() + n, chain.end());
+
+  while (true)
+  {
+    // in a cycle, what a style resolves to depends on where the chain was
+    // entered, so only the style asked for can be kept
+    if (!cyclic || n == 0)
     {
-        if (base.isSetMarkerStyle())
-        {
-            const SedMarker* topmarker = top->getMarkerStyle();
-            SedMarker* basemarker = base.getMarkerStyle();
-
-            if (topmarker->isSetType())
-            {
-                basemarker->setType(topmarker->getType());
-            }
-
-            if (topmarker->isSetSize())
-            {
-                basemarker->setSize(topmarker->getSize());
-            }
-
-            if (topmarker->isSetFill())
-            {
-                basemarker->setFill(topmarker->getFill());
-            }
-
-            if (topmarker->isSetLineColor())
-            {
-                basemarker->setLineColor(topmarker->getLineColor());
-            }
-
-            if (topmarker->isSetLineThickness())
-            {
-                basemarker->setLineThickness(topmarker->getLineThickness());
-            }
-        }
-        else
-        {
-            base.setMarkerStyle(top->getMarkerStyle());
-        }
+      ResolvedStyle* entry = new ResolvedStyle();
+      entry->style.reset(new SedStyle(resolved));
+      entry->chain = resolvedChain;
+
+      std::shared_ptr<const ResolvedStyle>& slot = (*updated)[chain[n].id];
+
+      if (slot != NULL)
+      {
+        mRetiredStyles.push_back(slot);
+      }
+
+      slot.reset(entry);
     }
 
-    if (top->isSetFillStyle())
+    if (n == 0)
     {
-        if (base.isSetFillStyle())
-        {
-            const SedFill* topfill = top->getFillStyle();
-            SedFill* basefill = base.getFillStyle();
-
-            if (topfill->isSetColor())
-            {
-                basefill->setColor(topfill->getColor());
-            }
-
-            //if (topfill->isSetSecondColor())
-            //{
-            //    basefill->setSecondColor(topfill->getSecondColor());
-            //}
-        }
-        else
-        {
-            base.setFillStyle(top->getFillStyle());
-        }
+      break;
     }
-    return base;
+
+    mergeStyle(resolved, *chain[--n].style);
+    resolvedChain.insert(resolvedChain.begin(), chain[n]);
+  }
+
+  std::atomic_store(&mResolvedStyles,
+    std::shared_ptr<const ResolvedStyleMap>(updated));
+
+  return updated->find(sid)->second->style.get();
 }
 
 
@@ -1817,7 +2207,7 @@ SedDocument::getEffectiveStyle(const std::string& sid) const
 const SedStyle*
 SedDocument::getStyleByBaseStyle(const std::string& sid) const
 {
-  return mStyles.getByBaseStyle(sid);
+  return readList(&SedDocument::mStyles).getByBaseStyle(sid);
 }
 
 
@@ -1828,7 +2218,7 @@ SedDocument::getStyleByBaseStyle(const std::string& sid) const
 SedStyle*
 SedDocument::getStyleByBaseStyle(const std::string& sid)
 {
-  return mStyles.getByBaseStyle(sid);
+  return writeList(&SedDocument::mStyles).getByBaseStyle(sid);
 }
 
 
@@ -1859,13 +2249,13 @@ SedDocument::addStyle(const SedStyle* ss)
   {
     return LIBSEDML_NAMESPACES_MISMATCH;
   }
-  else if (ss->isSetId() && (mStyles.get(ss->getId())) != NULL)
+  else if (ss->isSetId() && (writeList(&SedDocument::mStyles).get(ss->getId())) != NULL)
   {
     return LIBSEDML_DUPLICATE_OBJECT_ID;
   }
   else
   {
-    return mStyles.append(ss);
+    return writeList(&SedDocument::mStyles).append(ss);
   }
 }
 
@@ -1876,7 +2266,7 @@ SedDocument::addStyle(const SedStyle* ss)
 unsigned int
 SedDocument::getNumStyles() const
 {
-  return mStyles.size();
+  return readList(&SedDocument::mStyles).size();
 }
 
 
@@ -1899,7 +2289,7 @@ SedDocument::createStyle()
 
   if (ss != NULL)
   {
-    mStyles.appendAndOwn(ss);
+    writeList(&SedDocument::mStyles).appendAndOwn(ss);
   }
 
   return ss;
@@ -1912,7 +2302,7 @@ SedDocument::createStyle()
 SedStyle*
 SedDocument::removeStyle(unsigned int n)
 {
-  return mStyles.remove(n);
+  return writeList(&SedDocument::mStyles).remove(n);
 }
 
 
@@ -1923,7 +2313,7 @@ SedDocument::removeStyle(unsigned int n)
 SedStyle*
 SedDocument::removeStyle(const std::string& sid)
 {
-  return mStyles.remove(sid);
+  return writeList(&SedDocument::mStyles).remove(sid);
 }
 
 
@@ -1985,42 +2375,74 @@ SedDocument::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
   if (getNumAlgorithmParameters() > 0 && (getLevel() > 1 || getVersion() >= 4))
   {
-    mAlgorithmParameters.write(stream);
+    readList(&SedDocument::mAlgorithmParameters).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfAlgorithmParameters");
   }
 
   if (getNumDataDescriptions() > 0)
   {
-    mDataDescriptions.write(stream);
+    readList(&SedDocument::mDataDescriptions).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfDataDescriptions");
   }
 
   if (getNumModels() > 0)
   {
-    mModels.write(stream);
+    readList(&SedDocument::mModels).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfModels");
   }
 
   if (getNumSimulations() > 0)
   {
-    mSimulations.write(stream);
+    readList(&SedDocument::mSimulations).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfSimulations");
   }
 
   if (getNumTasks() > 0)
   {
-    mAbstractTasks.write(stream);
+    readList(&SedDocument::mAbstractTasks).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfTasks");
   }
 
   if (getNumDataGenerators() > 0)
   {
-    mDataGenerators.write(stream);
+    readList(&SedDocument::mDataGenerators).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfDataGenerators");
   }
 
   if (getNumOutputs() > 0)
   {
-    mOutputs.write(stream);
+    readList(&SedDocument::mOutputs).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfOutputs");
   }
 
   if (getNumStyles() > 0)
   {
-    mStyles.write(stream);
+    readList(&SedDocument::mStyles).write(stream);
+  }
+  else
+  {
+    writeSkippedList(stream, "listOfStyles");
   }
 }
 
@@ -2740,91 +3162,1264 @@ SedDocument::getElementBySId(const std::string& id)
     return NULL;
   }
 
-  SedBase* obj = NULL;
-
-  obj = mAlgorithmParameters.getElementBySId(id);
-
-  if (obj != NULL)
+  if (!mSIdIndexValid)
   {
-      return obj;
+    buildSIdIndex();
   }
 
-  obj = mDataDescriptions.getElementBySId(id);
+  std::unordered_map<std::string, SedBase*>::const_iterator it =
+    mSIdIndex.find(id);
 
-  if (obj != NULL)
+  if (it != mSIdIndex.end() || mSharedLists == 0)
   {
-    return obj;
+    return (it == mSIdIndex.end()) ? NULL : it->second;
   }
 
-  obj = mModels.getElementBySId(id);
+  // the lists still shared with the base of a copy-on-write clone are not
+  // indexed; only the one holding the element is copied to hand it out
+  SedBase* element =
+    unshareElementBySId(&SedDocument::mAlgorithmParameters, id);
 
-  if (obj != NULL)
-  {
-    return obj;
-  }
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mDataDescriptions, id);
 
-  obj = mSimulations.getElementBySId(id);
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mModels, id);
+
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mSimulations, id);
+
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mAbstractTasks, id);
+
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mDataGenerators, id);
+
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mOutputs, id);
+
+  if (element == NULL)
+    element = unshareElementBySId(&SedDocument::mStyles, id);
+
+  return element;
+}
 
-  if (obj != NULL)
-  {
-    return obj;
-  }
 
-  obj = mAbstractTasks.getElementBySId(id);
+/*
+ * Returns a List of all elements in this SedDocument with a SIdRef attribute
+ * referring to the given id.
+ */
+List*
+SedDocument::getReferencingElements(const std::string& id)
+{
+  List* ret = new List();
 
-  if (obj != NULL)
+  if (id.empty())
   {
-    return obj;
+    return ret;
   }
 
-  obj = mDataGenerators.getElementBySId(id);
-
-  if (obj != NULL)
+  if (!mSIdRefIndexValid)
   {
-    return obj;
+    buildSIdRefIndex();
   }
 
-  obj = mOutputs.getElementBySId(id);
+  SIdRefIndex::const_iterator it = mSIdRefIndex.find(id);
 
-  if (obj != NULL)
+  if (it == mSIdRefIndex.end())
   {
-    return obj;
+    return ret;
   }
 
-  obj = mStyles.getElementBySId(id);
+  // an element referring to the id through several attributes is listed
+  // several times in the index, but only once in the result
+  const std::vector<SedBase*>& referers = it->second;
+  std::unordered_set<SedBase*> seen;
 
-  if (obj != NULL)
+  for (std::vector<SedBase*>::const_iterator el = referers.begin();
+       el != referers.end(); ++el)
   {
-    return obj;
+    if (seen.insert(*el).second)
+    {
+      ret->add(*el);
+    }
   }
 
-  return obj;
+  return ret;
 }
 
 
+typedef std::map<std::string, std::string> RenameMap;
+typedef std::vector<SedBase*> MathOwnerVector;
+
+
 /*
- * Returns a List of all child SedBase objects, including those nested to an
- * arbitrary depth.
+ * Adds the set values in the given list to owners.
  */
-List*
-SedDocument::getAllElements(SedElementFilter* filter)
+static void
+addSetValues(MathOwnerVector& owners, SedListOfSetValues* setValues)
 {
-  List* ret = new List();
-  List* sublist = NULL;
+  for (unsigned int i = 0; i < setValues->size(); ++i)
+  {
+    owners.push_back(setValues->get(i));
+  }
+}
 
-  SED_ADD_FILTERED_LIST(ret, sublist, mAlgorithmParameters, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mDataDescriptions, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mModels, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mSimulations, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mAbstractTasks, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mDataGenerators, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mOutputs, filter);
-  SED_ADD_FILTERED_LIST(ret, sublist, mStyles, filter);
+
+/*
+ * Collects all elements in the document that can carry MathML.
+ */
+static void
+collectMathOwners(SedDocument* doc, MathOwnerVector& owners)
+{
+  for (unsigned int i = 0; i < doc->getNumDataGenerators(); ++i)
+  {
+    owners.push_back(doc->getDataGenerator(i));
+  }
+
+  for (unsigned int i = 0; i < doc->getNumModels(); ++i)
+  {
+    SedModel* model = doc->getModel(i);
+    for (unsigned int j = 0; j < model->getNumChanges(); ++j)
+    {
+      SedChange* change = model->getChange(j);
+      if (change->isSedComputeChange())
+      {
+        owners.push_back(change);
+      }
+    }
+  }
+
+  for (unsigned int i = 0; i < doc->getNumTasks(); ++i)
+  {
+    SedAbstractTask* task = doc->getTask(i);
+    if (!task->isSedRepeatedTask()) continue;
+
+    SedRepeatedTask* repeatedTask = static_cast<SedRepeatedTask*>(task);
+    for (unsigned int j = 0; j < repeatedTask->getNumRanges(); ++j)
+    {
+      SedRange* range = repeatedTask->getRange(j);
+      if (range->isSedFunctionalRange())
+      {
+        owners.push_back(range);
+      }
+    }
+
+    addSetValues(owners, repeatedTask->getListOfTaskChanges());
+
+    for (unsigned int j = 0; j < repeatedTask->getNumSubTasks(); ++j)
+    {
+      addSetValues(owners, repeatedTask->getSubTask(j)->getListOfTaskChanges());
+    }
+  }
+}
+
+
+/*
+ * Returns the math of an element collected by collectMathOwners, parsing
+ * it if necessary but keeping any MathML retained for writing.
+ */
+static const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
+getOwnedMath(const SedBase* owner)
+{
+  switch (owner->getTypeCode())
+  {
+  case SEDML_DATAGENERATOR:
+    return static_cast<const SedDataGenerator*>(owner)->getMath();
+  case SEDML_CHANGE_COMPUTECHANGE:
+    return static_cast<const SedComputeChange*>(owner)->getMath();
+  case SEDML_RANGE_FUNCTIONALRANGE:
+    return static_cast<const SedFunctionalRange*>(owner)->getMath();
+  case SEDML_TASK_SETVALUE:
+    return static_cast<const SedSetValue*>(owner)->getMath();
+  default:
+    return NULL;
+  }
+}
+
+
+/*
+ * Returns the math of an element collected by collectMathOwners for
+ * modification.
+ */
+static LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
+getOwnedMath(SedBase* owner)
+{
+  switch (owner->getTypeCode())
+  {
+  case SEDML_DATAGENERATOR:
+    return static_cast<SedDataGenerator*>(owner)->getMath();
+  case SEDML_CHANGE_COMPUTECHANGE:
+    return static_cast<SedComputeChange*>(owner)->getMath();
+  case SEDML_RANGE_FUNCTIONALRANGE:
+    return static_cast<SedFunctionalRange*>(owner)->getMath();
+  case SEDML_TASK_SETVALUE:
+    return static_cast<SedSetValue*>(owner)->getMath();
+  default:
+    return NULL;
+  }
+}
+
+
+/*
+ * Returns true if the node names an identifier (as opposed to a built-in).
+ */
+static bool
+isSIdRefNode(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node)
+{
+  int type = node->getType();
+
+  return (type == LIBSBML_CPP_NAMESPACE_QUALIFIER AST_NAME ||
+          type == LIBSBML_CPP_NAMESPACE_QUALIFIER AST_FUNCTION) &&
+         node->getName() != NULL;
+}
+
+
+/*
+ * Renames all identifiers in the given math according to the map.
+ */
+static void
+renameMathSIdRefs(LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+                  const RenameMap& renames)
+{
+  if (isSIdRefNode(node))
+  {
+    RenameMap::const_iterator it = renames.find(node->getName());
+    if (it != renames.end())
+    {
+      node->setName(it->second.c_str());
+    }
+  }
+
+  for (unsigned int i = 0; i < node->getNumChildren(); ++i)
+  {
+    renameMathSIdRefs(node->getChild(i), renames);
+  }
+}
+
+
+/*
+ * Collects all identifiers used in the given math.
+ */
+static void
+collectMathSIdRefs(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+                   std::unordered_set<std::string>& names)
+{
+  if (isSIdRefNode(node))
+  {
+    names.insert(node->getName());
+  }
+
+  for (unsigned int i = 0; i < node->getNumChildren(); ++i)
+  {
+    collectMathSIdRefs(node->getChild(i), names);
+  }
+}
+
+
+/*
+ * Returns true if the given math uses any of the keys of renames.
+ */
+static bool
+mathUsesRenamedSIdRefs(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* node,
+                       const RenameMap& renames)
+{
+  if (isSIdRefNode(node) && renames.count(node->getName()) > 0)
+  {
+    return true;
+  }
+
+  for (unsigned int i = 0; i < node->getNumChildren(); ++i)
+  {
+    if (mathUsesRenamedSIdRefs(node->getChild(i), renames))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * @copydoc doc_renamesidref_common
+ */
+void
+SedDocument::renameSIdRefs(const std::string& oldid, const std::string& newid)
+{
+  RenameMap renames;
+  renames[oldid] = newid;
+  renameSIdRefs(renames);
+}
+
+
+/*
+ * Replaces all references to the keys of renames with the corresponding
+ * values.
+ */
+void
+SedDocument::renameSIdRefs(const std::map<std::string, std::string>& renames)
+{
+  RenameMap effective;
+  bool chained = false;
+
+  for (RenameMap::const_iterator it = renames.begin();
+       it != renames.end(); ++it)
+  {
+    if (!it->first.empty() && !it->second.empty() && it->first != it->second)
+    {
+      effective.insert(*it);
+    }
+  }
+
+  for (RenameMap::const_iterator it = effective.begin();
+       it != effective.end(); ++it)
+  {
+    if (effective.find(it->second) != effective.end())
+    {
+      chained = true;
+      break;
+    }
+  }
+
+  if (!chained)
+  {
+    applySIdRefRenames(effective);
+    return;
+  }
+
+  // renaming one id to another that is renamed itself goes through
+  // temporary ids, which must not be in use anywhere in the document
+  if (!mSIdRefIndexValid)
+  {
+    buildSIdRefIndex();
+  }
+
+  std::unordered_set<std::string> used;
+  MathOwnerVector owners;
+  collectMathOwners(this, owners);
+
+  for (MathOwnerVector::const_iterator it = owners.begin();
+       it != owners.end(); ++it)
+  {
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math =
+      getOwnedMath(static_cast<const SedBase*>(*it));
+    if (math != NULL)
+    {
+      collectMathSIdRefs(math, used);
+    }
+  }
+
+  for (SIdRefIndex::const_iterator it = mSIdRefIndex.begin();
+       it != mSIdRefIndex.end(); ++it)
+  {
+    used.insert(it->first);
+  }
+
+  RenameMap toTemporary;
+  RenameMap fromTemporary;
+  unsigned int count = 0;
+
+  for (RenameMap::const_iterator it = effective.begin();
+       it != effective.end(); ++it)
+  {
+    std::string temporary;
+    do
+    {
+      std::ostringstream oss;
+      oss << "__renamed_" << count++;
+      temporary = oss.str();
+    }
+    while (used.find(temporary) != used.end() ||
+           effective.find(temporary) != effective.end());
+
+    toTemporary[it->first] = temporary;
+    fromTemporary[temporary] = it->second;
+  }
+
+  applySIdRefRenames(toTemporary);
+  applySIdRefRenames(fromTemporary);
+}
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Builds the SId index from all elements in this SedDocument
+ */
+void
+SedDocument::buildSIdIndex()
+{
+  mSIdIndex.clear();
+  mSIdIndexHasDuplicates = false;
+
+  // generation 0 marks elements that were never indexed
+  if (++mSIdIndexGeneration == 0)
+  {
+    mSIdIndexGeneration = 1;
+  }
+
+  mSIdIndexValid = true;
+
+  // indexed elements can be modified, so lists still shared with the base
+  // of a copy-on-write clone are left out (see getElementBySId())
+  SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    if ((mSharedLists & getListFlag(lists[i])) != 0)
+    {
+      continue;
+    }
+
+    // getAllElements() returns the elements in document order, so the first
+    // element with a given id wins just like with the recursive lookup
+    List* elements = lists[i]->getAllElements();
+
+    while (elements->getSize() > 0)
+    {
+      SedBase* element = static_cast<SedBase*>(elements->remove(0));
+
+      if (element->getTypeCode() != SEDML_LIST_OF && !indexElement(element))
+      {
+        mSIdIndexHasDuplicates = true;
+      }
+    }
+
+    delete elements;
+  }
+}
+
+
+/*
+ * Returns true if the given element is listed in the current SId index
+ */
+bool
+SedDocument::isSIdIndexed(const SedBase* element) const
+{
+  if (!mSIdIndexValid || element == NULL)
+  {
+    return false;
+  }
+
+  if (element == this)
+  {
+    return true;
+  }
+
+  return element->mSIdIndexDocument == this &&
+    element->mSIdIndexGeneration == mSIdIndexGeneration;
+}
+
+
+/*
+ * Lists a single element in the SId index
+ */
+bool
+SedDocument::indexElement(SedBase* element)
+{
+  if (mSIdRefIndexValid && !isSIdIndexed(element))
+  {
+    addSIdRefs(element);
+  }
+
+  element->mSIdIndexDocument = this;
+  element->mSIdIndexGeneration = mSIdIndexGeneration;
+
+  const std::string& id = element->getId();
+
+  if (id.empty())
+  {
+    return true;
+  }
+
+  std::pair<std::unordered_map<std::string, SedBase*>::iterator, bool> result
+    = mSIdIndex.insert(std::make_pair(id, element));
+
+  return result.second || result.first->second == element;
+}
+
+
+/*
+ * Drops a single element from the SId index
+ */
+bool
+SedDocument::unindexElement(SedBase* element)
+{
+  if (element->mSIdIndexDocument != this)
+  {
+    return false;
+  }
+
+  bool indexed = isSIdIndexed(element);
+
+  if (indexed && mSIdRefIndexValid)
+  {
+    removeSIdRefs(element);
+  }
+
+  element->mSIdIndexDocument = NULL;
+  element->mSIdIndexGeneration = 0;
+
+  if (!indexed || element->mId.empty())
+  {
+    return false;
+  }
+
+  std::unordered_map<std::string, SedBase*>::iterator it =
+    mSIdIndex.find(element->mId);
+
+  if (it == mSIdIndex.end() || it->second != element)
+  {
+    return false;
+  }
+
+  mSIdIndex.erase(it);
+
+  // another element with the same id may have been hidden by this one
+  return mSIdIndexHasDuplicates;
+}
+
+
+/*
+ * Drops the elements moved here from orig from the SId index of orig
+ */
+void
+SedDocument::unindexElementsOf(SedDocument& orig)
+{
+  // with its index invalidated, orig merely forgets about each element
+  orig.invalidateSIdIndex();
+  orig.unindexChildren(this);
+}
+
+
+/*
+ * State of the walk done by SedDocument::unindexChildren()
+ */
+struct SedUnindexWalk
+{
+  SedDocument* document;
+  bool rebuild;
+};
+
+
+/*
+ * Drops the children of element from the SId index
+ */
+bool
+SedDocument::unindexChildren(SedBase* element)
+{
+  SedUnindexWalk walk = { this, false };
+  element->visitChildren(&SedDocument::unindexChild, &walk);
+  return walk.rebuild;
+}
+
+
+/*
+ * Drops a child and, in turn, its own children from the SId index
+ */
+void
+SedDocument::unindexChild(SedBase* child, void* data)
+{
+  SedUnindexWalk* walk = static_cast<SedUnindexWalk*>(data);
+  walk->rebuild = walk->document->unindexElement(child) || walk->rebuild;
+  child->visitChildren(&SedDocument::unindexChild, data);
+}
+
+
+/*
+ * Returns whether none of the styles the given resolved style was resolved
+ * from has changed since
+ */
+bool
+SedDocument::isResolvedStyleCurrent(const ResolvedStyle& resolved) const
+{
+  const SedListOfStyles& styles = readList(&SedDocument::mStyles);
+
+  for (std::vector<StyleLink>::const_iterator it = resolved.chain.begin();
+       it != resolved.chain.end(); ++it)
+  {
+    if (styles.get(it->id) != it->style
+      || (it->style != NULL && it->style->getRevision() != it->revision))
+    {
+      return false;
+    }
+  }
+
+  // the name of a style is not part of its revision
+  return !resolved.chain.empty()
+    && resolved.style->getName() == resolved.chain.front().style->getName();
+}
+
+
+/*
+ * Returns the flag marking the given list as shared in mSharedLists
+ */
+unsigned int
+SedDocument::getListFlag(const SedListOf* list) const
+{
+  const SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    if (lists[i] == list)
+    {
+      return 1u << i;
+    }
+  }
+
+  return 0;
+}
+
+
+/*
+ * Returns the given top-level list for reading
+ */
+template <class ListType>
+const ListType&
+SedDocument::readList(ListType SedDocument::* list) const
+{
+  if ((mSharedLists & getListFlag(&(this->*list))) != 0)
+  {
+    // the base may itself be a copy-on-write clone
+    return mSharedBase->readList(list);
+  }
+
+  return this->*list;
+}
+
+
+/*
+ * Returns the given top-level list for modification, copying it first if it
+ * is shared
+ */
+template <class ListType>
+ListType&
+SedDocument::writeList(ListType SedDocument::* list)
+{
+  ListType& own = this->*list;
+  unsigned int flag = getListFlag(&own);
+
+  if ((mSharedLists & flag) == 0)
+  {
+    return own;
+  }
+
+  const ListType& shared = mSharedBase->readList(list);
+
+  // copying the list as a whole would index its items in the base document
+  static_cast<SedBase&>(own) = shared;
+  own.connectToParent(this);
+
+  for (unsigned int i = 0; i < shared.size(); ++i)
+  {
+    own.appendAndOwn(shared.get(i)->clone());
+  }
+
+  mSharedLists &= ~flag;
+  invalidateSIdIndex();
+
+  if (mSharedLists == 0)
+  {
+    mSharedBase.reset();
+  }
+
+  return own;
+}
+
+
+/*
+ * Returns the element with the given id from the given list if it is still
+ * shared, copying the list first
+ */
+template <class ListType>
+SedBase*
+SedDocument::unshareElementBySId(ListType SedDocument::* list,
+                                 const std::string& id)
+{
+  if ((mSharedLists & getListFlag(&(this->*list))) == 0)
+  {
+    return NULL;
+  }
+
+  // the lookup only reads the list of the base
+  ListType& shared = const_cast<ListType&>(mSharedBase->readList(list));
+
+  if (shared.getElementBySId(id) == NULL)
+  {
+    return NULL;
+  }
+
+  return writeList(list).getElementBySId(id);
+}
+
+
+/*
+ * Copies all top-level lists still shared with the base document
+ */
+void
+SedDocument::unshareLists()
+{
+  if (mSharedLists == 0)
+  {
+    return;
+  }
+
+  writeList(&SedDocument::mAlgorithmParameters);
+  writeList(&SedDocument::mDataDescriptions);
+  writeList(&SedDocument::mModels);
+  writeList(&SedDocument::mSimulations);
+  writeList(&SedDocument::mAbstractTasks);
+  writeList(&SedDocument::mDataGenerators);
+  writeList(&SedDocument::mOutputs);
+  writeList(&SedDocument::mStyles);
+}
+
+
+/*
+ * Adds the given element and its children to the SId index
+ */
+void
+SedDocument::addToSIdIndex(SedBase* element)
+{
+  if (!mSIdIndexValid || element == NULL || isSIdIndexed(element))
+  {
+    return;
+  }
+
+  // lists are not indexed themselves, their items are added as they are
+  // connected to the list
+  if (element->getTypeCode() == SEDML_LIST_OF)
+  {
+    return;
+  }
+
+  SedBase* parent = element->mParentSedObject;
+
+  if (!isSIdIndexed(parent))
+  {
+    if (parent == NULL || parent->getTypeCode() != SEDML_LIST_OF ||
+      !isSIdIndexed(parent->mParentSedObject))
+    {
+      return;
+    }
+  }
+
+  if (!indexElement(element))
+  {
+    invalidateSIdIndex();
+    return;
+  }
+
+  List* elements = element->getAllElements();
+
+  if (elements == NULL)
+  {
+    return;
+  }
+
+  while (elements->getSize() > 0)
+  {
+    SedBase* child = static_cast<SedBase*>(elements->remove(0));
+
+    if (child->getTypeCode() != SEDML_LIST_OF && !indexElement(child))
+    {
+      invalidateSIdIndex();
+      break;
+    }
+  }
+
+  delete elements;
+}
+
+
+/*
+ * Removes the given element (and its children) from the SId index
+ */
+void
+SedDocument::removeFromSIdIndex(SedBase* element, bool recursive)
+{
+  if (element == NULL)
+  {
+    return;
+  }
+
+  // the destructor of element removes it without recursion, at that point
+  // its SIdRef attributes can no longer be queried; a whole subtree drops
+  // its references at once, which unlike dropping them one by one does not
+  // allocate
+  if (mSIdRefIndexValid && (recursive || isSIdIndexed(element)))
+  {
+    invalidateSIdRefIndex();
+  }
+
+  bool rebuild = unindexElement(element);
+
+  if (recursive)
+  {
+    rebuild = unindexChildren(element) || rebuild;
+  }
+
+  if (rebuild)
+  {
+    invalidateSIdIndex();
+  }
+}
+
+
+/*
+ * Updates the SId index after the id of the element changed
+ */
+void
+SedDocument::updateSIdIndex(SedBase* element, const std::string& oldId)
+{
+  if (!isSIdIndexed(element))
+  {
+    return;
+  }
+
+  if (!oldId.empty())
+  {
+    std::unordered_map<std::string, SedBase*>::iterator it =
+      mSIdIndex.find(oldId);
+
+    if (it != mSIdIndex.end() && it->second == element)
+    {
+      mSIdIndex.erase(it);
+
+      if (mSIdIndexHasDuplicates)
+      {
+        invalidateSIdIndex();
+        return;
+      }
+    }
+  }
+
+  if (!indexElement(element))
+  {
+    invalidateSIdIndex();
+  }
+}
+
+
+/*
+ * Discards the SId index
+ */
+void
+SedDocument::invalidateSIdIndex()
+{
+  mSIdIndexValid = false;
+  mSIdIndexHasDuplicates = false;
+  mSIdIndex.clear();
+
+  // the SIdRef index relies on the SId index to track its elements
+  invalidateSIdRefIndex();
+}
+
+
+/*
+ * Builds the SIdRef index from all elements in this SedDocument
+ */
+void
+SedDocument::buildSIdRefIndex()
+{
+  if (!mSIdIndexValid)
+  {
+    buildSIdIndex();
+  }
+
+  mSIdRefIndex.clear();
+  mSIdRefIndexValid = true;
+
+  List* elements = getAllElements();
+
+  while (elements->getSize() > 0)
+  {
+    addSIdRefs(static_cast<SedBase*>(elements->remove(0)));
+  }
+
+  delete elements;
+}
+
+
+/*
+ * Lists the SIdRef attributes of a single element in the SIdRef index
+ */
+void
+SedDocument::addSIdRefs(SedBase* element)
+{
+  std::vector<std::string> refs;
+  element->getSIdRefs(refs);
+
+  for (std::vector<std::string>::const_iterator it = refs.begin();
+       it != refs.end(); ++it)
+  {
+    mSIdRefIndex[*it].push_back(element);
+  }
+}
+
+
+/*
+ * Drops the SIdRef attributes of a single element from the SIdRef index
+ */
+void
+SedDocument::removeSIdRefs(SedBase* element)
+{
+  std::vector<std::string> refs;
+  element->getSIdRefs(refs);
+
+  for (std::vector<std::string>::const_iterator it = refs.begin();
+       it != refs.end(); ++it)
+  {
+    removeSIdRef(*it, element);
+  }
+}
+
+
+/*
+ * Drops one reference from element to ref from the SIdRef index
+ */
+void
+SedDocument::removeSIdRef(const std::string& ref, SedBase* element)
+{
+  SIdRefIndex::iterator it = mSIdRefIndex.find(ref);
+
+  if (it == mSIdRefIndex.end())
+  {
+    return;
+  }
+
+  std::vector<SedBase*>& referers = it->second;
+  std::vector<SedBase*>::iterator pos =
+    std::find(referers.begin(), referers.end(), element);
+
+  if (pos != referers.end())
+  {
+    referers.erase(pos);
+  }
+
+  if (referers.empty())
+  {
+    mSIdRefIndex.erase(it);
+  }
+}
+
+
+/*
+ * Updates the SIdRef index before a SIdRef attribute of the element changes
+ */
+void
+SedDocument::updateSIdRefIndex(SedBase* element, const std::string& oldRef,
+                               const std::string& newRef)
+{
+  if (!mSIdRefIndexValid || !isSIdIndexed(element))
+  {
+    return;
+  }
+
+  if (!oldRef.empty())
+  {
+    removeSIdRef(oldRef, element);
+  }
+
+  if (!newRef.empty())
+  {
+    mSIdRefIndex[newRef].push_back(element);
+  }
+}
+
+
+/*
+ * Applies renames (without chains) to the SIdRef attributes and the math
+ */
+void
+SedDocument::applySIdRefRenames(const std::map<std::string, std::string>& renames)
+{
+  if (renames.empty())
+  {
+    return;
+  }
+
+  MathOwnerVector owners;
+  collectMathOwners(this, owners);
+
+  for (MathOwnerVector::const_iterator it = owners.begin();
+       it != owners.end(); ++it)
+  {
+    // only math that changes gives up the MathML retained for writing
+    const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math =
+      getOwnedMath(static_cast<const SedBase*>(*it));
+    if (math != NULL && mathUsesRenamedSIdRefs(math, renames))
+    {
+      renameMathSIdRefs(getOwnedMath(*it), renames);
+    }
+  }
+
+  if (!mSIdRefIndexValid)
+  {
+    buildSIdRefIndex();
+  }
+
+  for (RenameMap::const_iterator it = renames.begin();
+       it != renames.end(); ++it)
+  {
+    SIdRefIndex::const_iterator found = mSIdRefIndex.find(it->first);
+
+    if (found == mSIdRefIndex.end())
+    {
+      continue;
+    }
+
+    // the setters called by renameSIdRefs() update the index as they go
+    const std::vector<SedBase*> referers(found->second);
+
+    for (std::vector<SedBase*>::const_iterator el = referers.begin();
+         el != referers.end(); ++el)
+    {
+      (*el)->renameSIdRefs(it->first, it->second);
+    }
+  }
+}
+
+
+/*
+ * Discards the SIdRef index
+ */
+void
+SedDocument::invalidateSIdRefIndex()
+{
+  mSIdRefIndexValid = false;
+  mSIdRefIndex.clear();
+}
+
+
+/*
+ * Sets the SedStreamHandler receiving the top-level elements
+ */
+void
+SedDocument::setStreamHandler(SedStreamHandler* handler)
+{
+  mStreamHandler = handler;
+  mStreamStopped = false;
+  mNumStreamedInList = 0;
+}
+
+
+/*
+ * Sets the limits on the errors logged while reading
+ */
+void
+SedDocument::setErrorLimits(unsigned int maxErrors, unsigned int severity)
+{
+  mMaxErrors = maxErrors;
+  mFailFastSeverity = severity;
+}
+
+
+/*
+ * Returns true if reading is to stop
+ */
+bool
+SedDocument::isReadingStopped() const
+{
+  if (mStreamStopped)
+  {
+    return true;
+  }
+
+  // called for every element read, so bail out early in the common case;
+  // the counts per severity are kept up to date by the error log
+  if (mErrorLog.getNumErrors() == 0)
+  {
+    return false;
+  }
+
+  for (unsigned int severity = mFailFastSeverity;
+       severity <= LIBSEDML_SEV_FATAL; ++severity)
+  {
+    if (mErrorLog.getNumFailsWithSeverity(severity) > 0)
+    {
+      return true;
+    }
+  }
+
+  return mMaxErrors > 0 &&
+    mErrorLog.getNumFailsWithSeverity(LIBSEDML_SEV_ERROR) +
+    mErrorLog.getNumFailsWithSeverity(LIBSEDML_SEV_FATAL) >= mMaxErrors;
+}
+
+
+/*
+ * Hands a top-level element that has been read to the SedStreamHandler
+ */
+bool
+SedDocument::streamElement(SedBase* object)
+{
+  if (mStreamHandler == NULL)
+  {
+    return false;
+  }
+
+  SedBase* parent = object->getParentSedObject();
+  if (parent == this)
+  {
+    // a top-level list is complete; it is empty even if it had items, so
+    // only report it when none were streamed from it
+    if (mNumStreamedInList == 0)
+    {
+      checkSedListOfPopulated(object);
+    }
+
+    mNumStreamedInList = 0;
+    return true;
+  }
+
+  if (parent == NULL || parent->getParentSedObject() != this)
+  {
+    return false;
+  }
+
+  SedListOf* list = static_cast<SedListOf*>(parent);
+  SedBase* element = list->remove(list->size() - 1);
+  ++mNumStreamedInList;
+
+  if (!mStreamHandler->element(*element))
+  {
+    mStreamStopped = true;
+  }
+
+  delete element;
+  return true;
+}
+
+
+/*
+ * Restricts reading to the given top-level lists
+ */
+void
+SedDocument::setListsToRead(const std::set<std::string>* listNames,
+                            bool keepSkipped)
+{
+  mListsToRead = listNames;
+  mKeepSkippedLists = keepSkipped;
+}
+
+/** @endcond */
+
+
+/*
+ * Returns a List of all child SedBase objects, including those nested to an
+ * arbitrary depth.
+ */
+List*
+SedDocument::getAllElements(SedElementFilter* filter)
+{
+  // the elements are handed out for modification
+  unshareLists();
+
+  List* ret = new List();
+  List* sublist = NULL;
+
+  SED_ADD_FILTERED_LIST(ret, sublist, mAlgorithmParameters, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mDataDescriptions, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mModels, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mSimulations, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mAbstractTasks, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mDataGenerators, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mOutputs, filter);
+  SED_ADD_FILTERED_LIST(ret, sublist, mStyles, filter);
 
   return ret;
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each top-level list owned by this SedDocument
+ */
+void
+SedDocument::visitChildren(ChildVisitor visit, void* data)
+{
+  SedListOf* lists[] = { &mAlgorithmParameters, &mDataDescriptions,
+    &mModels, &mSimulations, &mAbstractTasks, &mDataGenerators, &mOutputs,
+    &mStyles };
+
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    if ((mSharedLists & getListFlag(lists[i])) == 0)
+    {
+      visit(lists[i], data);
+    }
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Gives this SedDocument a SedArena for its elements.
+ */
+int
+SedDocument::enableArena()
+{
+  if (mArena.get() == NULL)
+  {
+    mArena.reset(new SedArena());
+  }
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns the SedArena of this SedDocument.
+ */
+SedArena*
+SedDocument::getArena() const
+{
+  return mArena.get();
+}
+
+
+/*
+ * Returns the XML of a top-level list skipped when reading.
+ */
+const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode*
+SedDocument::getSkippedList(const std::string& name) const
+{
+  std::map<std::string, LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode>::const_iterator
+    it = mSkippedLists.find(name);
+
+  return (it != mSkippedLists.end()) ? &it->second : NULL;
+}
+
+
+/*
+ * Returns the location of this SedDocument.
+ */
+const std::string&
+SedDocument::getLocationURI() const
+{
+  return mLocationURI;
+}
+
+
+/*
+ * Sets the location of this SedDocument.
+ */
+int
+SedDocument::setLocationURI(const std::string& location)
+{
+  mLocationURI = location;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
 /*
  * Returns the value of the "Namespaces" element of this SedDocument.
  */
@@ -2841,6 +4436,7 @@ SedDocument::getNamespaces() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces*
 SedDocument::getNamespaces()
 {
+  unshareSedNamespaces();
   return mSedNamespaces->getNamespaces();
 }
 
@@ -2907,9 +4503,9 @@ SedDocument::getNumErrors(unsigned int severity) const
 
 void SedDocument::sortOrderedObjects()
 {
-    for (unsigned int o = 0; o < mOutputs.size(); o++)
+    for (unsigned int o = 0; o < writeList(&SedDocument::mOutputs).size(); o++)
     {
-        SedOutput* output = mOutputs.get(o);
+        SedOutput* output = writeList(&SedDocument::mOutputs).get(o);
         int type = output->getTypeCode();
         if (type == SEDML_OUTPUT_PLOT2D) 
         {
@@ -2922,9 +4518,9 @@ void SedDocument::sortOrderedObjects()
             sp3d->getListOfSurfaces()->sort();
         }
     }
-    for (unsigned int t = 0; t < mAbstractTasks.size(); t++)
+    for (unsigned int t = 0; t < writeList(&SedDocument::mAbstractTasks).size(); t++)
     {
-        SedAbstractTask* task = mAbstractTasks.get(t);
+        SedAbstractTask* task = writeList(&SedDocument::mAbstractTasks).get(t);
         int type = task->getTypeCode();
         if (type == SEDML_TASK_REPEATEDTASK)
         {
@@ -2949,85 +4545,90 @@ SedDocument::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
   const std::string& name = stream.peek().getName();
 
+  if (isListSkipped(name))
+  {
+    return NULL;
+  }
+
   if (name == "listOfAlgorithmParameters")
   {
-      if (getErrorLog() && mAlgorithmParameters.size() != 0)
+      if (getErrorLog() && writeList(&SedDocument::mAlgorithmParameters).size() != 0)
       {
           getErrorLog()->logError(SedmlAlgorithmAllowedElements, getLevel(),
               getVersion(), "", getLine(), getColumn());
       }
 
-      obj = &mAlgorithmParameters;
+      obj = &writeList(&SedDocument::mAlgorithmParameters);
   }
   else if (name == "listOfDataDescriptions")
   {
-    if (getErrorLog() && mDataDescriptions.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mDataDescriptions).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mDataDescriptions;
+    obj = &writeList(&SedDocument::mDataDescriptions);
   }
   else if (name == "listOfModels")
   {
-    if (getErrorLog() && mModels.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mModels).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mModels;
+    obj = &writeList(&SedDocument::mModels);
   }
   else if (name == "listOfSimulations")
   {
-    if (getErrorLog() && mSimulations.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mSimulations).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mSimulations;
+    obj = &writeList(&SedDocument::mSimulations);
   }
   else if (name == "listOfTasks")
   {
-    if (getErrorLog() && mAbstractTasks.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mAbstractTasks).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mAbstractTasks;
+    obj = &writeList(&SedDocument::mAbstractTasks);
   }
   else if (name == "listOfDataGenerators")
   {
-    if (getErrorLog() && mDataGenerators.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mDataGenerators).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mDataGenerators;
+    obj = &writeList(&SedDocument::mDataGenerators);
   }
   else if (name == "listOfOutputs")
   {
-    if (getErrorLog() && mOutputs.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mOutputs).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mOutputs;
+    obj = &writeList(&SedDocument::mOutputs);
   }
   else if (name == "listOfStyles")
   {
-    if (getErrorLog() && mStyles.size() != 0)
+    if (getErrorLog() && writeList(&SedDocument::mStyles).size() != 0)
     {
       getErrorLog()->logError(SedmlDocumentAllowedElements, getLevel(),
         getVersion(), "", getLine(), getColumn());
     }
 
-    obj = &mStyles;
+    obj = &writeList(&SedDocument::mStyles);
   }
 
   connectToChild();
@@ -3039,6 +4640,85 @@ SedDocument::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Skips (and possibly keeps) the top-level lists not to be read
+ */
+bool
+SedDocument::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
+  stream)
+{
+  const std::string name = stream.peek().getName();
+
+  if (!isListSkipped(name))
+  {
+    return SedBase::readOtherXML(stream);
+  }
+
+  if (mKeepSkippedLists)
+  {
+    mSkippedLists[name] = LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode(stream);
+  }
+  else
+  {
+    stream.skipPastEnd(stream.next());
+  }
+
+  return true;
+}
+
+
+/*
+ * Returns true if the top-level list with the given name is not to be read
+ */
+bool
+SedDocument::isListSkipped(const std::string& name) const
+{
+  static const char* listNames[] = {
+    "listOfAlgorithmParameters", "listOfDataDescriptions", "listOfModels",
+    "listOfSimulations", "listOfTasks", "listOfDataGenerators",
+    "listOfOutputs", "listOfStyles"
+  };
+
+  if (mListsToRead == NULL || mListsToRead->empty() ||
+      mListsToRead->find(name) != mListsToRead->end())
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < sizeof(listNames) / sizeof(listNames[0]); ++i)
+  {
+    if (name == listNames[i])
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Writes the kept XML of a skipped list to the stream
+ */
+void
+SedDocument::writeSkippedList(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
+  stream, const std::string& name) const
+{
+  std::map<std::string, LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode>::const_iterator
+    it = mSkippedLists.find(name);
+
+  if (it != mSkippedLists.end())
+  {
+    stream << it->second;
+  }
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
@@ -3148,6 +4828,11 @@ SedDocument::readAttributes(
         getLine(), getColumn());
     }
   }
+
+  if (mStreamHandler != NULL && !mStreamHandler->startDocument(*this))
+  {
+    mStreamStopped = true;
+  }
 }
 
 /** @endcond */
@@ -3189,73 +4874,58 @@ void
 SedDocument::writeXMLNS(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
   stream) const
 {
- // need to check that we have indeed a namespace set!
-  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * thisNs =
-    const_cast<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *>(getNamespaces());
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces * thisNs = getNamespaces();
+  const std::string sedmlURI =
+    SedNamespaces::getSedNamespaceURI(getLevel(), getVersion());
 
-  // the SED-ML namespace is missing - add it
-  if (thisNs == NULL)
-    {
-      XMLNamespaces xmlns;
-
-      if (getVersion() == 1)
-        xmlns.add(SEDML_XMLNS_L1V1);
-      else if (getVersion() == 2)
-        xmlns.add(SEDML_XMLNS_L1V2);
-      else if (getVersion() == 3)
-        xmlns.add(SEDML_XMLNS_L1V3);
-      else
-        xmlns.add(SEDML_XMLNS_L1V4);
-
-      mSedNamespaces->setNamespaces(&xmlns);
-      thisNs =  const_cast<LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces *>(getNamespaces());
-    }
-  else if (thisNs->getLength() == 0)
-    {
-      if (getVersion() == 1)
-        thisNs->add(SEDML_XMLNS_L1V1);
-      else if (getVersion() == 2)
-        thisNs->add(SEDML_XMLNS_L1V2);
-      else if (getVersion() == 3)
-        thisNs->add(SEDML_XMLNS_L1V3);
-      else
-        thisNs->add(SEDML_XMLNS_L1V4);
-    }
-  else
-    {
-      // check that there is an SED-ML namespace
-      std::string sedmlURI = SedNamespaces::getSedNamespaceURI(getLevel(), getVersion());
-      std::string sedmlPrefix = thisNs->getPrefix(sedmlURI);
+  // the namespaces are written as they are unless the SED-ML namespace has
+  // to be added, which is done on a copy so that writing leaves the
+  // (possibly shared) namespaces of this document alone
+  if (thisNs != NULL && thisNs->getLength() > 0 &&
+      thisNs->hasNS(sedmlURI, thisNs->getPrefix(sedmlURI)))
+  {
+    stream << *thisNs;
+    return;
+  }
 
-      if (thisNs->hasNS(sedmlURI, sedmlPrefix) == false)
-        {
-          // the SED-ML ns is not present
-          std::string other = thisNs->getURI(sedmlPrefix);
-
-          if (other.empty() == false)
-            {
-              // there is another ns with the prefix that the SED-ML ns expects to have
-              //remove the this ns, add the sbml ns and
-              //add the new ns with a new prefix
-              thisNs->remove(sedmlPrefix);
-              thisNs->add(sedmlURI, sedmlPrefix);
-              thisNs->add(other, "addedPrefix");
-            }
-          else
-            {
-              thisNs->add(sedmlURI, sedmlPrefix);
-            }
-        }
-    }
+  LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNamespaces xmlns;
 
-  XMLNamespaces * xmlns = thisNs->clone();
+  // need to check that we have indeed a namespace set!
+  if (thisNs == NULL || thisNs->getLength() == 0)
+  {
+    // the SED-ML namespace is missing - add it
+    if (getVersion() == 1)
+      xmlns.add(SEDML_XMLNS_L1V1);
+    else if (getVersion() == 2)
+      xmlns.add(SEDML_XMLNS_L1V2);
+    else if (getVersion() == 3)
+      xmlns.add(SEDML_XMLNS_L1V3);
+    else
+      xmlns.add(SEDML_XMLNS_L1V4);
+  }
+  else
+  {
+    // the SED-ML ns is not present
+    xmlns = *thisNs;
+    std::string sedmlPrefix = xmlns.getPrefix(sedmlURI);
+    std::string other = xmlns.getURI(sedmlPrefix);
 
-  if (xmlns != NULL)
+    if (other.empty() == false)
     {
-      stream << *(xmlns);
-      delete xmlns;
+      // there is another ns with the prefix that the SED-ML ns expects to have
+      //remove the this ns, add the sbml ns and
+      //add the new ns with a new prefix
+      xmlns.remove(sedmlPrefix);
+      xmlns.add(sedmlURI, sedmlPrefix);
+      xmlns.add(other, "addedPrefix");
     }
+    else
+    {
+      xmlns.add(sedmlURI, sedmlPrefix);
+    }
+  }
 
+  stream << xmlns;
 }
 
 /** @endcond */
@@ -48,9 +48,16 @@
 
 
 #include <string>
+#include <unordered_map>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
 
 
 #include <sedml/SedBase.h>
+#include <sedml/SedArena.h>
+#include <sedml/SedStreamHandler.h>
 #include <sedml/SedListOfAlgorithmParameters.h>
 #include <sedml/SedListOfDataDescriptions.h>
 #include <sedml/SedListOfModels.h>
@@ -76,6 +83,24 @@ protected:
   bool mIsSetLevel;
   unsigned int mVersion;
   bool mIsSetVersion;
+
+  // arena holding the elements of this document, if enabled; declared
+  // ahead of the lists so that it is released after their items
+  std::unique_ptr<SedArena, SedArena::Release> mArena;
+
+  // document-wide SId index used by getElementBySId(); declared ahead of
+  // the lists so that it outlives their items on destruction
+  std::unordered_map<std::string, SedBase*> mSIdIndex;
+  bool mSIdIndexValid;
+  bool mSIdIndexHasDuplicates;
+  unsigned int mSIdIndexGeneration;
+
+  // reverse index of the SIdRef attributes used by getReferencingElements(),
+  // mapping an id to the elements referring to it
+  typedef std::unordered_map<std::string, std::vector<SedBase*> > SIdRefIndex;
+  SIdRefIndex mSIdRefIndex;
+  bool mSIdRefIndexValid;
+
   SedListOfAlgorithmParameters mAlgorithmParameters;
   SedListOfDataDescriptions mDataDescriptions;
   SedListOfModels mModels;
@@ -86,6 +111,56 @@ protected:
   SedListOfStyles mStyles;
   SedErrorLog mErrorLog;
 
+  // receives the top-level elements while this document is being streamed
+  // by SedReader::streamSedML()
+  SedStreamHandler* mStreamHandler;
+  bool mStreamStopped;
+  unsigned int mNumStreamedInList;
+
+  // top-level lists to read (all of them if NULL or empty) while this
+  // document is being read, and the XML of those skipped, if kept
+  const std::set<std::string>* mListsToRead;
+  bool mKeepSkippedLists;
+  std::map<std::string, LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode> mSkippedLists;
+
+  // limits on the errors logged while this document is being read, beyond
+  // which SedReader stops reading
+  unsigned int mMaxErrors;
+  unsigned int mFailFastSeverity;
+
+  // the file this document was read from, against which files referenced
+  // by relative paths are resolved
+  std::string mLocationURI;
+
+  // for a copy-on-write clone, the document the top-level lists flagged in
+  // mSharedLists are still read from
+  std::shared_ptr<const SedDocument> mSharedBase;
+  unsigned int mSharedLists;
+
+  // the styles resolved by getResolvedStyle(), each with the styles along
+  // its baseStyle chain (and their revisions) it was resolved from
+  struct StyleLink
+  {
+    std::string id;
+    const SedStyle* style;
+    unsigned long revision;
+  };
+
+  struct ResolvedStyle
+  {
+    std::unique_ptr<SedStyle> style;
+    std::vector<StyleLink> chain;
+  };
+
+  // the cache is read without locking; resolving a style publishes a new
+  // map, under mResolvedStylesMutex, and never modifies a published entry
+  typedef std::unordered_map<std::string,
+    std::shared_ptr<const ResolvedStyle> > ResolvedStyleMap;
+  mutable std::shared_ptr<const ResolvedStyleMap> mResolvedStyles;
+  // the entries replaced in the cache, kept as they may have been handed out
+  mutable std::vector<std::shared_ptr<const ResolvedStyle> > mRetiredStyles;
+  mutable std::mutex mResolvedStylesMutex;
+
   /** @endcond */
 
 public:
@@ -133,6 +208,30 @@ public:
   SedDocument& operator=(const SedDocument& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedDocument.
+   *
+   * The elements of @p orig, and the SedArena holding them if any, are
+   * taken over without copying; @p orig is left empty.
+   *
+   * @param orig the SedDocument instance to move from.
+   */
+  SedDocument(SedDocument&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedDocument.
+   *
+   * @param rhs the SedDocument object whose elements are moved into this
+   * one; it is left empty.
+   */
+  SedDocument& operator=(SedDocument&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedDocument object.
    *
@@ -141,6 +240,40 @@ public:
   virtual SedDocument* clone() const;
 
 
+#ifndef SWIG
+
+  /**
+   * Creates a copy-on-write clone of a SedDocument.
+   *
+   * The clone starts out sharing all top-level lists (the list of models,
+   * of simulations, of outputs and so on) with @p base, which is why it is
+   * handed over as a pointer to a @c const document that can no longer be
+   * modified.  A list is copied into the clone the first time it is asked
+   * for through a non-@c const method, typically to modify one of its
+   * elements; lists only ever read stay shared.  Many variants of a
+   * document thus cost memory and time in proportion to the lists they
+   * change rather than to the size of the document.
+   *
+   * Elements reached through the @c const methods of the clone while their
+   * list is still shared belong to @p base, and report it as their parent
+   * SedDocument.  getElementBySId() copies only the list holding the
+   * element it returns, while getAllElements(), which hands out every
+   * element for modification, copies all lists still shared.
+   *
+   * Clones of the clone made with clone() or the copy constructor keep
+   * sharing the same lists.
+   *
+   * @param base the SedDocument to share the lists of.
+   *
+   * @return the (copy-on-write) clone of @p base, or @c NULL if @p base is
+   * @c NULL.
+   */
+  static SedDocument* cloneOnWrite(
+    const std::shared_ptr<const SedDocument>& base);
+
+#endif /* !SWIG */
+
+
   /**
    * Destructor for SedDocument.
    */
@@ -2081,10 +2214,40 @@ public:
    * SedListOfStyles, but changed so that any referenced styles
    * are applied.
    *
+   * @see getResolvedStyle(const std::string& sid)
    */
   SedStyle getEffectiveStyle(const std::string& sid) const;
 
 
+  /**
+   * Get the effective SedStyle from the SedDocument based on its
+   * identifier, without copying it.
+   *
+   * The SedStyle returned is the one getEffectiveStyle() returns a copy of.
+   * It is kept in a cache of this SedDocument and only resolved again once
+   * one of the styles along its "baseStyle" chain has been modified, added,
+   * removed or renamed; styles sharing a base style share the resolution
+   * of that base style as well.  A "baseStyle" chain that leads back to a
+   * style already in it is cut there, with that last "baseStyle" ignored.
+   *
+   * @param sid a string representing the identifier of the SedStyle to
+   * retrieve.
+   *
+   * @return the SedStyle in the SedListOfStyles with the given @p sid, with
+   * any referenced styles applied, or @c NULL if no such SedStyle exists.
+   * The pointer stays valid as long as this SedDocument exists, but the
+   * SedStyle it points to is never updated: once a style along the chain
+   * has changed, the next call to this method returns a new resolution.
+   *
+   * This method and getEffectiveStyle() may be called from several threads
+   * at once as long as the styles are not modified meanwhile; styles found
+   * in the cache are returned without locking.
+   *
+   * @see getEffectiveStyle(const std::string& sid)
+   */
+  const SedStyle* getResolvedStyle(const std::string& sid) const;
+
+
   /**
    * Get a SedStyle from the SedDocument based on the BaseStyle to which it
    * refers.
@@ -2631,6 +2794,12 @@ public:
    * Returns the first child element that has the given @p id in the model-wide
    * SId namespace, or @c NULL if no such object is found.
    *
+   * The lookup is served from an index of all identifiers in this
+   * SedDocument, which is built on the first call and kept up to date as
+   * elements are added, removed or renamed.  On a copy-on-write clone (see
+   * cloneOnWrite()), only the top-level list holding the element is copied
+   * if it is still shared.
+   *
    * @param id a string representing the id attribute of the object to
    * retrieve.
    *
@@ -2640,6 +2809,117 @@ public:
   virtual SedBase* getElementBySId(const std::string& id);
 
 
+  /**
+   * Returns a List of all elements in this SedDocument that refer to the
+   * given @p id through one of their SIdRef attributes (such as
+   * "taskReference", "modelReference", "dataReference" or "style").
+   *
+   * The lookup is served from a reverse index of all SIdRef attributes in
+   * this SedDocument, which is built on the first call and kept up to date
+   * as elements are added, removed or edited.  Identifiers used inside
+   * MathML are not included.
+   *
+   * @param id the identifier the elements refer to.
+   *
+   * @return a List of pointers to the referring elements, in no particular
+   * order.  The caller owns the List (but not its elements) and is
+   * responsible for deleting it.
+   *
+   * @see SedBase::getSIdRefs(std::vector<std::string>& refs)
+   */
+  List* getReferencingElements(const std::string& id);
+
+
+  /**
+   * @copydoc doc_renamesidref_common
+   */
+  virtual void renameSIdRefs(const std::string& oldid,
+                             const std::string& newid);
+
+
+  /**
+   * Replaces all references to the keys of @p renames in this SedDocument,
+   * in SIdRef attributes as well as in MathML, with the corresponding values.
+   *
+   * All renames take effect at once, so @p renames may swap identifiers or
+   * rename an identifier to one that is itself renamed.  Only the elements
+   * referring to a renamed identifier are visited, as found through the
+   * index used by getReferencingElements().  The "id" attributes themselves
+   * are left unchanged.
+   *
+   * @param renames a map from old to new identifiers.
+   */
+  void renameSIdRefs(const std::map<std::string, std::string>& renames);
+
+
+  /**
+   * Gives this SedDocument a SedArena for its elements.
+   *
+   * Elements created while the arena is current (see SedArena::Scope), as
+   * SedReader does when SedReader::setUseArena() is set, are placed in the
+   * arena rather than on the heap, and their memory is only released, all
+   * at once, when this SedDocument is destroyed.  Elements removed from the
+   * document keep the arena alive until they are deleted in turn, so that
+   * they may outlive the document like elements on the heap.  Calling this
+   * method again has no effect.
+   *
+   * @copydetails doc_returns_one_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   */
+  int enableArena();
+
+
+  /**
+   * Returns the SedArena of this SedDocument.
+   *
+   * @return the SedArena enabled by enableArena(), or @c NULL if this
+   * SedDocument allocates its elements on the heap.
+   */
+  SedArena* getArena() const;
+
+
+  /**
+   * Returns the XML of a top-level list that was skipped when this
+   * SedDocument was read.
+   *
+   * SedReader::setListsToRead() makes a SedReader skip the top-level lists
+   * not asked for; with SedReader::setKeepSkippedLists() their XML is kept
+   * without creating any objects, and written back out in place of the
+   * list for as long as the list stays empty.
+   *
+   * @param name the element name of the list, such as "listOfModels".
+   *
+   * @return the XML of the skipped list, or @c NULL if the list was read
+   * (or skipped without being kept).
+   */
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode* getSkippedList(
+    const std::string& name) const;
+
+
+  /**
+   * Returns the location of this SedDocument.
+   *
+   * SedReader sets this to the name of the file a document is read from;
+   * files referenced from the document by relative paths, such as the
+   * binary value files of SedVectorRange objects, are looked up next to it.
+   *
+   * @return the location of this SedDocument, or an empty string if it was
+   * not read from a file.
+   */
+  const std::string& getLocationURI() const;
+
+
+  /**
+   * Sets the location of this SedDocument.
+   *
+   * @param location the name of the file this SedDocument is stored in.
+   *
+   * @copydetails doc_returns_one_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   */
+  int setLocationURI(const std::string& location);
+
+
   /**
    * Returns the value of the "Namespaces" element of this SedDocument.
    *
@@ -2751,10 +3031,242 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each of the top-level lists owned by this
+   * SedDocument.  The lists shared with the base of a copy-on-write clone
+   * are left out, they are not copied as getAllElements() would.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+
+
+  /**
+   * Adds the given element and its children to the SId index, provided the
+   * index has been built and the parent of @p element is already listed in
+   * it.
+   */
+  void addToSIdIndex(SedBase* element);
+
+
+  /**
+   * Removes the given element (and, if @p recursive is @c true, all of its
+   * children) from the SId index.
+   */
+  void removeFromSIdIndex(SedBase* element, bool recursive = true);
+
+
+  /**
+   * Updates the SId index after the id of @p element changed from @p oldId.
+   */
+  void updateSIdIndex(SedBase* element, const std::string& oldId);
+
+
+  /**
+   * Discards the SId index; it will be rebuilt on the next call to
+   * getElementBySId().
+   */
+  void invalidateSIdIndex();
+
+
+  /**
+   * Updates the SIdRef index before a SIdRef attribute of @p element
+   * changes from @p oldRef to @p newRef.
+   */
+  void updateSIdRefIndex(SedBase* element, const std::string& oldRef,
+                         const std::string& newRef);
+
+
+  /**
+   * Discards the SIdRef index; it will be rebuilt on the next call to
+   * getReferencingElements().
+   */
+  void invalidateSIdRefIndex();
+
+
+  /**
+   * Makes @p handler receive the top-level elements of this SedDocument as
+   * they are read, instead of keeping them; @c NULL restores normal reading.
+   */
+  void setStreamHandler(SedStreamHandler* handler);
+
+
+  /**
+   * Stops reading this SedDocument once @p maxErrors errors (unlimited if
+   * @c 0) or one error of at least @p severity have been logged.
+   */
+  void setErrorLimits(unsigned int maxErrors, unsigned int severity);
+
+
+  /**
+   * Returns @c true if reading this SedDocument is to stop, because its
+   * SedStreamHandler has asked to or an error limit has been reached.
+   */
+  bool isReadingStopped() const;
+
+
+  /**
+   * Called by SedBase::read() once @p object has been read completely;
+   * returns @c true if @p object was handled by streaming (in which case a
+   * top-level element has been deleted) and @c false otherwise.
+   */
+  bool streamElement(SedBase* object);
+
+
+  /**
+   * Restricts reading this SedDocument to the top-level lists named in
+   * @p listNames (all of them if @c NULL or empty), keeping the XML of the
+   * others if @p keepSkipped is @c true.
+   */
+  void setListsToRead(const std::set<std::string>* listNames,
+                      bool keepSkipped);
+
+  /** @endcond */
+
+
 
 protected:
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Builds the SId index from all elements in this SedDocument.
+   */
+  void buildSIdIndex();
+
+
+  /**
+   * Returns @c true if the given element is listed in the current SId index.
+   */
+  bool isSIdIndexed(const SedBase* element) const;
+
+
+  /**
+   * Lists a single element in the SId index, returns @c false if its id
+   * clashes with another element.
+   */
+  bool indexElement(SedBase* element);
+
+
+  /**
+   * Drops a single element from the SId index, returns @c true if the index
+   * needs to be rebuilt as a result.
+   */
+  bool unindexElement(SedBase* element);
+
+
+  /**
+   * Drops the children of @p element, at any depth, from the SId index,
+   * returns @c true if the index needs to be rebuilt as a result.  Nothing
+   * is allocated, as the move operations rely on this.
+   */
+  bool unindexChildren(SedBase* element);
+
+
+  /**
+   * The SedBase::ChildVisitor used by unindexChildren().
+   */
+  static void unindexChild(SedBase* child, void* data);
+
+
+  /**
+   * Drops the elements of this SedDocument, just moved here from @p orig,
+   * from the SId index of @p orig.
+   */
+  void unindexElementsOf(SedDocument& orig);
+
+
+  /**
+   * Returns whether none of the styles along the "baseStyle" chain of
+   * @p resolved has changed since it was resolved.
+   */
+  bool isResolvedStyleCurrent(const ResolvedStyle& resolved) const;
+
+
+  /**
+   * Resolves the style with the given @p sid and publishes the result, with
+   * those of the styles along its chain, in mResolvedStyles; needs to be
+   * called with mResolvedStylesMutex locked.
+   */
+  const SedStyle* resolveStyle(const std::string& sid) const;
+
+
+  /**
+   * Returns the flag marking @p list as shared in mSharedLists.
+   */
+  unsigned int getListFlag(const SedListOf* list) const;
+
+
+  /**
+   * Returns the given top-level list for reading, from the base document
+   * of a copy-on-write clone if the list is still shared.
+   */
+  template <class ListType>
+  const ListType& readList(ListType SedDocument::* list) const;
+
+
+  /**
+   * Returns the given top-level list for modification, copying it from the
+   * base document of a copy-on-write clone first if it is still shared.
+   */
+  template <class ListType>
+  ListType& writeList(ListType SedDocument::* list);
+
+
+  /**
+   * Copies all top-level lists still shared with the base document of a
+   * copy-on-write clone.
+   */
+  void unshareLists();
+
+
+  /**
+   * Returns the element with the given @p id from the given top-level list
+   * if it is still shared with the base document of a copy-on-write clone,
+   * copying (only) that list first, or @c NULL if the list is not shared or
+   * has no such element.
+   */
+  template <class ListType>
+  SedBase* unshareElementBySId(ListType SedDocument::* list,
+                               const std::string& id);
+
+
+  /**
+   * Builds the SIdRef index from all elements in this SedDocument.
+   */
+  void buildSIdRefIndex();
+
+
+  /**
+   * Lists the SIdRef attributes of a single element in the SIdRef index.
+   */
+  void addSIdRefs(SedBase* element);
+
+
+  /**
+   * Drops the SIdRef attributes of a single element from the SIdRef index.
+   */
+  void removeSIdRefs(SedBase* element);
+
+
+  /**
+   * Drops one reference from @p element to @p ref from the SIdRef index.
+   */
+  void removeSIdRef(const std::string& ref, SedBase* element);
+
+
+  /**
+   * Applies @p renames, none of whose new identifiers may be renamed itself,
+   * to the SIdRef attributes and MathML of this SedDocument.
+   */
+  void applySIdRefRenames(const std::map<std::string, std::string>& renames);
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -2767,6 +3279,31 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Skips (and possibly keeps) the top-level lists not to be read
+   */
+  virtual bool readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
+    stream);
+
+
+  /**
+   * Returns @c true if the top-level list @p name is not to be read
+   */
+  bool isListSkipped(const std::string& name) const;
+
+
+  /**
+   * Writes the kept XML of the skipped list @p name to the stream
+   */
+  void writeSkippedList(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
+    stream, const std::string& name) const;
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
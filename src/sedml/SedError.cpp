@@ -38,6 +38,7 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
 #include <sbml/xml/XMLError.h>
 
@@ -82,6 +83,44 @@ getSeverityForEntry(unsigned int index,
 }
 
 
+/*
+ * Marks a SedError whose message is not made from an sedmlErrorTable entry.
+ */
+static const unsigned int sedmlNoTableEntry = (unsigned int)(-1);
+
+
+/*
+ * Helper function for SedError().  Returns the index of the sedmlErrorTable
+ * entry for the given error code, or 0 (that of SedUnknown) if there is
+ * none.
+ */
+static unsigned int
+getIndexForCode(unsigned int code)
+{
+  typedef std::unordered_map<unsigned int, unsigned int> IndexMap;
+
+  // the table is not sorted by code; map the codes to the entries once, on
+  // first use, rather than scanning it for every error
+  static const IndexMap indices = []()
+  {
+    IndexMap map;
+    unsigned int tableSize = sizeof(sedmlErrorTable)/sizeof(sedmlErrorTable[0]);
+
+    for (unsigned int i = tableSize; i > 0; --i)
+    {
+      // the first of several entries for a code wins, as before
+      map[sedmlErrorTable[i - 1].code] = i - 1;
+    }
+
+    return map;
+  }();
+
+  IndexMap::const_iterator it = indices.find(code);
+
+  return (it != indices.end()) ? it->second : 0;
+}
+
+
 /*
  * @return the severity as a string for the given @n code.
  */
@@ -151,6 +190,79 @@ std::string SedError::stringForCategory(unsigned int code) const
 
   return XMLError::stringForCategory(code);
 }
+
+
+/*
+ * Puts the full message of this error together from its sedmlErrorTable
+ * entry and details.
+ */
+void
+SedError::formatMessage() const
+{
+  if (mMessageFormatted)
+  {
+    return;
+  }
+
+  const sedmlErrorTableEntry& entry = sedmlErrorTable[mTableIndex];
+  std::string message;
+
+  switch (getSeverityForEntry(mTableIndex, mLevel, mVersion))
+  {
+  case LIBSEDML_SEV_SCHEMA_ERROR:
+    message += sedmlErrorTable[3].message; // FIXME
+    message += ' ';
+    break;
+
+  case LIBSEDML_SEV_GENERAL_WARNING:
+    message += "[Although SED-ML Level ";
+    message += std::to_string(mLevel);
+    message += " Version ";
+    message += std::to_string(mVersion);
+    message += " does not explicitly define the following as an error, "
+               "other Levels and/or Versions of SED-ML do.] \n";
+    break;
+
+  default:
+    break;
+  }
+
+  // Finish updating the (full) error message.
+
+  if (entry.message != NULL && entry.message[0] != '\0')
+  {
+    message += entry.message;
+    message += '\n';
+  }
+
+  // look for individual references (there is only one SED-ML Level and
+  // Version to have them for so far)
+
+  if (entry.reference.ref_l1v1 != NULL && entry.reference.ref_l1v1[0] != '\0')
+  {
+    message += "Reference: ";
+    message += entry.reference.ref_l1v1;
+    message += '\n';
+  }
+
+  // until now, mMessage has been holding the details only
+  const std::string& details = mMessage;
+
+  if (!details.empty())
+  {
+    message += ' ';
+    message += details;
+
+    if (details[details.size()-1] != '\n')
+    {
+      message += '\n';
+    }
+  }
+
+  // store the message where XMLError::getMessage() finds it, too
+  const_cast<SedError*>(this)->mMessage = message;
+  mMessageFormatted = true;
+}
 /** @endcond **/
 
 
@@ -163,6 +275,10 @@ SedError::SedError (  const unsigned int errorId
                       , const unsigned int severity
                       , const unsigned int category) :
     XMLError((int)errorId, details, line, column, severity, category)
+  , mTableIndex (sedmlNoTableEntry)
+  , mLevel (level)
+  , mVersion (version)
+  , mMessageFormatted (true)
 {
   // Check if the given @p id is one we have in our table of error codes.  If
   // it is, fill in the fields of the error object with the appropriate
@@ -177,17 +293,7 @@ SedError::SedError (  const unsigned int errorId
   else if ( mErrorId > XMLErrorCodesUpperBound
             && mErrorId < SedCodesUpperBound )
   {
-    unsigned int tableSize = sizeof(sedmlErrorTable)/sizeof(sedmlErrorTable[0]);
-    unsigned int index = 0;
-
-    for ( unsigned int i = 0; i < tableSize; i++ )
-    {
-      if ( mErrorId == sedmlErrorTable[i].code )
-      {
-        index = i;
-        break;
-      }
-    }
+    unsigned int index = getIndexForCode(mErrorId);
 
     if ( index == 0 && mErrorId != SedUnknown )
     {
@@ -207,13 +313,14 @@ SedError::SedError (  const unsigned int errorId
     }
 
     // The rest of this block massages the results to account for how some
-    // internal bookkeeping is done in libSEDML 3, and also to provide
-    // additional info in the messages.
+    // internal bookkeeping is done in libSEDML 3.  The (full) error message
+    // is only put together by formatMessage(), if it is ever asked for.
 
     mCategory     = sedmlErrorTable[index].category;
     mShortMessage = sedmlErrorTable[index].shortMessage;
+    mTableIndex   = index;
+    mMessageFormatted = false;
 
-    ostringstream newMsg;
     mSeverity = getSeverityForEntry(index, level, version);
 
     if (mValidError == false)
@@ -223,59 +330,12 @@ SedError::SedError (  const unsigned int errorId
     {
       mErrorId  = SedNotSchemaConformant;
       mSeverity = LIBSEDML_SEV_ERROR;
-      newMsg << sedmlErrorTable[3].message << " "; // FIXME
     }
     else if (mSeverity == LIBSEDML_SEV_GENERAL_WARNING)
     {
-
       mSeverity = LIBSEDML_SEV_WARNING;
-      newMsg << "[Although SED-ML Level " << level
-             << " Version " << version << " does not explicitly define the "
-             << "following as an error, other Levels and/or Versions "
-             << "of SED-ML do.] " << endl;
     }
 
-    // Finish updating the (full) error message.
-
-    if (!((string)sedmlErrorTable[index].message).empty()) {
-      newMsg << sedmlErrorTable[index].message << endl;
-    }
-
-    // look for individual references
-    // if the code for this error does not yet exist skip
-
-    if (sedmlErrorTable[index].reference.ref_l1v1 != NULL)
-    {
-
-      std::string ref;
-      switch(level)
-      {
-      case 1:
-      default:
-       switch(version)
-        {
-        case 1:
-        default:
-          ref = sedmlErrorTable[index].reference.ref_l1v1;
-        break;
-        }
-       break;
-      }
-
-      if (!ref.empty())
-      {
-        newMsg << "Reference: " << ref << endl;
-      }
-    }
-    if (!details.empty())
-    {
-      newMsg << " " << details;
-      if (details[details.size()-1] != '\n') {
-        newMsg << endl;
-      }
-    }      
-    mMessage  = newMsg.str();
-
     // We mucked around with the severity code and (maybe) category code
     // after creating the XMLError object, so we may have to update the
     // corresponding strings.
@@ -303,6 +363,10 @@ SedError::SedError (  const unsigned int errorId
  */
 SedError::SedError(const SedError& orig) :
  XMLError(orig)
+  , mTableIndex (orig.mTableIndex)
+  , mLevel (orig.mLevel)
+  , mVersion (orig.mVersion)
+  , mMessageFormatted (orig.mMessageFormatted)
 {
 }
 
@@ -312,10 +376,26 @@ SedError::operator=(const SedError& rhs)
   if (&rhs != this)
   {
     XMLError::operator=(rhs);
+    mTableIndex = rhs.mTableIndex;
+    mLevel = rhs.mLevel;
+    mVersion = rhs.mVersion;
+    mMessageFormatted = rhs.mMessageFormatted;
   }
   return *this;
 }
 
+
+/*
+ * Returns the message text of this error, putting it together first if
+ * need be.
+ */
+const std::string&
+SedError::getMessage() const
+{
+  formatMessage();
+  return mMessage;
+}
+
  /*
  * Destroys this SedError.
  */
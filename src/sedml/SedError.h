@@ -696,6 +696,23 @@ public:
 
   SedError& operator=(const SedError& rhs);
 
+
+  /**
+   * Returns the message text of this error.
+   *
+   * For errors with a SED-ML error code, the message combines the
+   * predefined text for the code, the specification reference and the
+   * details given to the constructor.  As most errors logged are never
+   * looked at, that message is only put together on the first call to this
+   * method, or when the error is handed out by SedErrorLog::getError() or
+   * SedErrorLog::getErrorWithSeverity().  Until then,
+   * XMLError::getMessage() returns just the details; this is only visible
+   * for errors retrieved through XMLErrorLog::getError() on a SedErrorLog.
+   *
+   * @return the message text.
+   */
+  const std::string& getMessage() const;
+
 #ifndef SWIG
 
   /** @cond doxygenLibsedmlInternal **/
@@ -727,6 +744,18 @@ protected:
   virtual std::string stringForSeverity(unsigned int code) const;
   virtual std::string stringForCategory(unsigned int code) const;
 
+  void formatMessage() const;
+
+  friend class SedErrorLog;
+
+  // the entry of sedmlErrorTable and the SED-ML Level and Version the
+  // message is formatted from by formatMessage(); until then, mMessage holds
+  // just the details
+  unsigned int mTableIndex;
+  unsigned int mLevel;
+  unsigned int mVersion;
+  mutable bool mMessageFormatted;
+
   /** @endcond **/
 };
 
@@ -60,6 +60,9 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  * Creates a new empty SedErrorLog.
  */
 SedErrorLog::SedErrorLog ()
+  : mIdCounts ()
+  , mSeverityCounts ()
+  , mNumCounted (0)
 {
 }
 
@@ -68,6 +71,9 @@ SedErrorLog::SedErrorLog ()
 */
 SedErrorLog::SedErrorLog (const SedErrorLog& other)
   : XMLErrorLog(other)
+  , mIdCounts ()
+  , mSeverityCounts ()
+  , mNumCounted (0)
 {
 }
 
@@ -79,6 +85,7 @@ SedErrorLog& SedErrorLog::operator=(const SedErrorLog& other)
   if (&other != this)
   {
   XMLErrorLog::operator=(other);
+  resetCounts();
   }
   return *this;
 }
@@ -195,6 +202,11 @@ private:
 void
 SedErrorLog::remove (const unsigned int errorId)
 {
+  if (!contains(errorId))
+  {
+    return;
+  }
+
   vector<XMLError*>::iterator delIter;
 
   // finds an item with the given errorId (the first item will be found if
@@ -203,6 +215,10 @@ SedErrorLog::remove (const unsigned int errorId)
 
   if ( delIter != mErrors.end() )
   {
+    --mIdCounts[errorId];
+    --mSeverityCounts[(*delIter)->getSeverity()];
+    --mNumCounted;
+
     // deletes (invoke delete operator for the matched item) and erases (removes
     // the pointer from mErrors) the matched item (if any)
     delete *delIter;
@@ -213,44 +229,128 @@ SedErrorLog::remove (const unsigned int errorId)
 void
 SedErrorLog::removeAll (const unsigned int errorId)
 {
-  vector<XMLError*>::iterator delIter;
+  if (!contains(errorId))
+  {
+    return;
+  }
 
-  // finds an item with the given errorId (the first item will be found if
-  // there are two or more items with the same Id)
-  delIter = find_if(mErrors.begin(), mErrors.end(), MatchErrorId(errorId));
+  // deletes the matching items and closes the gaps in a single pass
+  vector<XMLError*>::iterator keep = mErrors.begin();
+  vector<XMLError*>::iterator iter;
 
-  while ( delIter != mErrors.end() )
+  for (iter = mErrors.begin(); iter != mErrors.end(); ++iter)
   {
-    // deletes (invoke delete operator for the matched item) and erases (removes
-    // the pointer from mErrors) the matched item (if any)
-    delete *delIter;
-    mErrors.erase(delIter);
+    if ((*iter)->getErrorId() == errorId)
+    {
+      --mSeverityCounts[(*iter)->getSeverity()];
+      delete *iter;
+    }
+    else
+    {
+      *keep++ = *iter;
+    }
+  }
+
+  mErrors.erase(keep, mErrors.end());
+  mIdCounts.erase(errorId);
+  mNumCounted = mErrors.size();
+}
 
-    delIter = find_if(mErrors.begin(), mErrors.end(), MatchErrorId(errorId));
+
+void
+SedErrorLog::removeAllExcept (bool (*keep)(const unsigned int errorId))
+{
+  // deletes the rejected items and closes the gaps in a single pass
+  vector<XMLError*>::iterator kept = mErrors.begin();
+  vector<XMLError*>::iterator iter;
+
+  for (iter = mErrors.begin(); iter != mErrors.end(); ++iter)
+  {
+    if (keep((*iter)->getErrorId()))
+    {
+      *kept++ = *iter;
+    }
+    else
+    {
+      delete *iter;
+    }
   }
+
+  mErrors.erase(kept, mErrors.end());
+  resetCounts();
 }
 
 
 bool
 SedErrorLog::contains (const unsigned int errorId) const
 {
-  vector<XMLError*>::const_iterator iter;
+  updateCounts();
+
+  CountMap::const_iterator count = mIdCounts.find(errorId);
+
+  return count != mIdCounts.end() && count->second > 0;
+}
 
-  // finds an item with the given errorId (the first item will be found if
-  // there are two or more items with the same Id)
-  iter = find_if(mErrors.begin(), mErrors.end(), MatchErrorId(errorId));
 
-  if ( iter != mErrors.end() )
+/*
+ * Deletes all errors from this log.
+ */
+void
+SedErrorLog::clearLog()
+{
+  XMLErrorLog::clearLog();
+  resetCounts();
+}
+
+
+/*
+ * Changes the severity of the errors with the given severity.
+ */
+void
+SedErrorLog::changeErrorSeverity(XMLErrorSeverity_t originalSeverity,
+                                 XMLErrorSeverity_t targetSeverity,
+                                 std::string package)
+{
+  XMLErrorLog::changeErrorSeverity(originalSeverity, targetSeverity, package);
+  resetCounts();
+}
+
+
+/*
+ * Adds the errors logged since the last call to the counts.
+ */
+void
+SedErrorLog::updateCounts() const
+{
+  if (mNumCounted > mErrors.size())
   {
-    return true;
+    // errors were removed behind our back
+    mIdCounts.clear();
+    mSeverityCounts.clear();
+    mNumCounted = 0;
   }
-  else
+
+  for (; mNumCounted < mErrors.size(); ++mNumCounted)
   {
-    return false;
+    const XMLError* error = mErrors[mNumCounted];
+    ++mIdCounts[error->getErrorId()];
+    ++mSeverityCounts[error->getSeverity()];
   }
 }
 
 
+/*
+ * Drops the counts, to count the errors again on the next query.
+ */
+void
+SedErrorLog::resetCounts()
+{
+  mIdCounts.clear();
+  mSeverityCounts.clear();
+  mNumCounted = 0;
+}
+
+
 /*
  * Helper class used by
  * SedErrorLog::getNumFailsWithSeverity(SedErrorSeverity_t).
@@ -275,16 +375,11 @@ private:
 unsigned int 
 SedErrorLog::getNumFailsWithSeverity(unsigned int severity) const
 {
-  unsigned int n = 0;
+  updateCounts();
 
-#if defined(__SUNPRO_CC)
-  // Workaround for Sun cc which is missing:
-  count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity), n);
-#else
-  n = (unsigned int)count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity));
-#endif
+  CountMap::const_iterator count = mSeverityCounts.find(severity);
 
-  return n;
+  return (count != mSeverityCounts.end()) ? count->second : 0;
 }
 
 
@@ -294,16 +389,7 @@ SedErrorLog::getNumFailsWithSeverity(unsigned int severity) const
 unsigned int
 SedErrorLog::getNumFailsWithSeverity(unsigned int severity)
 {
-  unsigned int n = 0;
-
-#if defined(__SUNPRO_CC)
-  // Workaround for Sun cc which is missing:
-  count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity), n);
-#else
-  n = (unsigned int)count_if(mErrors.begin(), mErrors.end(), MatchSeverity(severity));
-#endif
-
-  return n;
+  return static_cast<const SedErrorLog*>(this)->getNumFailsWithSeverity(severity);
 }
 
 
@@ -317,7 +403,16 @@ SedErrorLog::getNumFailsWithSeverity(unsigned int severity)
 const SedError*
 SedErrorLog::getError (unsigned int n) const
 {
-  return static_cast<const SedError*>(XMLErrorLog::getError(n));
+  const XMLError* error = XMLErrorLog::getError(n);
+
+  // complete the message before it can be seen through XMLError, too
+  const SedError* sedError = dynamic_cast<const SedError*>(error);
+  if (sedError != NULL)
+  {
+    sedError->formatMessage();
+  }
+
+  return static_cast<const SedError*>(error);
 }
 
 
@@ -332,6 +427,11 @@ SedErrorLog::getError (unsigned int n) const
 const SedError*
 SedErrorLog::getErrorWithSeverity(unsigned int n, unsigned int severity) const
 {
+  if (n >= getNumFailsWithSeverity(severity))
+  {
+    return NULL;
+  }
+
   unsigned int count = 0;
   MatchSeverity matcher(severity);
   std::vector<XMLError*>::const_iterator it = mErrors.begin();
@@ -339,7 +439,15 @@ SedErrorLog::getErrorWithSeverity(unsigned int n, unsigned int severity) const
   {
     if (matcher(*it))
     {
-      if (count == n) return dynamic_cast<const SedError*>(*it);
+      if (count == n)
+      {
+        const SedError* sedError = dynamic_cast<const SedError*>(*it);
+        if (sedError != NULL)
+        {
+          sedError->formatMessage();
+        }
+        return sedError;
+      }
       ++count;
     }
   }
@@ -49,6 +49,7 @@
 #ifdef __cplusplus
 
 #include <vector>
+#include <unordered_map>
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
@@ -249,6 +250,16 @@ public:
    */
   void removeAll(const unsigned int errorId);
 
+
+  /**
+   * Removes all errors whose error identifier is not accepted by @p keep
+   * from the SedError list.
+   *
+   * @param keep a function returning @c true for the error identifiers of
+   * the errors to be kept.
+   */
+  void removeAllExcept(bool (*keep)(const unsigned int errorId));
+
   /**
    * Returns true if SedErrorLog contains an errorId
    *
@@ -257,6 +268,55 @@ public:
   bool contains (const unsigned int errorId) const;
 
 
+  /**
+   * Deletes all errors from this log.
+   */
+  void clearLog();
+
+
+  /**
+   * Changes the severity of the errors in this log with the severity
+   * @p originalSeverity to @p targetSeverity.
+   *
+   * @param originalSeverity the severity code to be changed.
+   *
+   * @param targetSeverity the severity code to change to.
+   *
+   * @param package only change the errors logged by this package; the
+   * default value @c "all" changes the errors of all packages.
+   */
+  void changeErrorSeverity(XMLErrorSeverity_t originalSeverity,
+                           XMLErrorSeverity_t targetSeverity,
+                           std::string package = "all");
+
+
+  /** @endcond */
+
+
+protected:
+
+  /** @cond doxygenLibsedmlInternal */
+
+  /**
+   * Adds the errors logged since the last call to the counts.
+   */
+  void updateCounts() const;
+
+
+  /**
+   * Drops the counts, to count the errors again on the next query.
+   */
+  void resetCounts();
+
+
+  // the numbers of errors per error id and per severity among the first
+  // mNumCounted errors of mErrors; errors added through XMLErrorLog
+  // directly, as the XML parser does, are counted on the next query
+  typedef std::unordered_map<unsigned int, unsigned int> CountMap;
+  mutable CountMap mIdCounts;
+  mutable CountMap mSeverityCounts;
+  mutable size_t mNumCounted;
+
   /** @endcond */
 };
 
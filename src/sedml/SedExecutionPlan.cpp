@@ -0,0 +1,595 @@
+/**
+ * @file SedExecutionPlan.cpp
+ * @brief Implementation of the SedExecutionPlan class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedExecutionPlan.h>
+#include <sedml/SedModel.h>
+#include <sedml/SedRepeatedTask.h>
+#include <sedml/SedSubTask.h>
+#include <sedml/SedTypeCodes.h>
+
+#include <algorithm>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Stores the given element and all the elements nested in it to elements.
+ */
+static void
+collectElements(const SedBase* element, vector<const SedBase*>& elements)
+{
+  elements.push_back(element);
+
+  // getAllElements() only walks the children, it does not modify them
+  List* children = const_cast<SedBase*>(element)->getAllElements();
+
+  while (children->getSize() > 0)
+  {
+    elements.push_back(static_cast<const SedBase*>(children->remove(0)));
+  }
+
+  delete children;
+}
+
+
+/*
+ * Stores the items of the given list to nodes.
+ */
+static void
+collectItems(const SedListOf* list, vector<const SedBase*>& nodes)
+{
+  for (unsigned int i = 0; i < list->size(); ++i)
+  {
+    nodes.push_back(list->get(i));
+  }
+}
+
+
+/*
+ * Removes the items of the copy of a list whose originals are not required;
+ * n is the index of the first item among all top-level elements, and is
+ * advanced past the list.
+ */
+static void
+pruneList(SedListOf* copy, const vector<bool>& required, unsigned int& n)
+{
+  const unsigned int size = copy->size();
+  const unsigned int first = n;
+  n += size;
+
+  for (unsigned int i = size; i-- > 0; )
+  {
+    if (!required[first + i])
+    {
+      delete copy->remove(i);
+    }
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Creates the SedExecutionPlan of the given SedDocument.
+ */
+SedExecutionPlan::SedExecutionPlan(const SedDocument& document)
+  : mDocument (document)
+  , mNodes ()
+  , mNodeIndex ()
+  , mOwners ()
+  , mDependencyIndices ()
+  , mSubTaskTasks ()
+  , mDependencies ()
+  , mStages ()
+  , mStageIndices ()
+  , mUnscheduled ()
+{
+  collectItems(document.getListOfDataDescriptions(), mNodes);
+  collectItems(document.getListOfModels(), mNodes);
+  collectItems(document.getListOfSimulations(), mNodes);
+  collectItems(document.getListOfTasks(), mNodes);
+  collectItems(document.getListOfDataGenerators(), mNodes);
+  collectItems(document.getListOfOutputs(), mNodes);
+
+  const unsigned int numNodes = (unsigned int)(mNodes.size());
+  vector<vector<const SedBase*> > elements(numNodes);
+
+  // the ids of all nested elements are known before any reference is
+  // resolved; the first of duplicate ids wins
+  for (unsigned int n = 0; n < numNodes; ++n)
+  {
+    mNodeIndex.insert(make_pair(mNodes[n], n));
+    collectElements(mNodes[n], elements[n]);
+
+    for (size_t i = 0; i < elements[n].size(); ++i)
+    {
+      if (elements[n][i]->isSetId())
+      {
+        mOwners.insert(make_pair(elements[n][i]->getId(), n));
+      }
+    }
+  }
+
+  mDependencyIndices.resize(numNodes);
+  mSubTaskTasks.resize(numNodes);
+  for (unsigned int n = 0; n < numNodes; ++n)
+  {
+    addDependencies(n, elements[n]);
+  }
+
+  vector<int> state(numNodes, 0);
+  for (unsigned int n = 0; n < numNodes; ++n)
+  {
+    inheritDependencies(n, state);
+  }
+
+  schedule();
+}
+
+
+/*
+ * Returns the SedDocument planned by this SedExecutionPlan.
+ */
+const SedDocument&
+SedExecutionPlan::getDocument() const
+{
+  return mDocument;
+}
+
+
+/*
+ * Returns the number of stages.
+ */
+unsigned int
+SedExecutionPlan::getNumStages() const
+{
+  return (unsigned int)(mStages.size());
+}
+
+
+/*
+ * Returns the elements of the nth stage.
+ */
+const std::vector<const SedBase*>&
+SedExecutionPlan::getStage(unsigned int n) const
+{
+  static const vector<const SedBase*> none;
+  return (n < mStages.size()) ? mStages[n] : none;
+}
+
+
+/*
+ * Returns the stage of the given top-level element.
+ */
+int
+SedExecutionPlan::getStageIndex(const SedBase* element) const
+{
+  unordered_map<const SedBase*, unsigned int>::const_iterator it =
+    mNodeIndex.find(element);
+  return (it != mNodeIndex.end()) ? mStageIndices[it->second] : -1;
+}
+
+
+/*
+ * Returns the elements the given top-level element depends on directly.
+ */
+const std::vector<const SedBase*>&
+SedExecutionPlan::getDependencies(const SedBase* element) const
+{
+  static const vector<const SedBase*> none;
+  unordered_map<const SedBase*, unsigned int>::const_iterator it =
+    mNodeIndex.find(element);
+  return (it != mNodeIndex.end()) ? mDependencies[it->second] : none;
+}
+
+
+/*
+ * Returns the number of top-level elements left out of the stages.
+ */
+unsigned int
+SedExecutionPlan::getNumUnscheduled() const
+{
+  return (unsigned int)(mUnscheduled.size());
+}
+
+
+/*
+ * Returns the nth element left out of the stages.
+ */
+const SedBase*
+SedExecutionPlan::getUnscheduled(unsigned int n) const
+{
+  return (n < mUnscheduled.size()) ? mUnscheduled[n] : NULL;
+}
+
+
+/*
+ * Groups the sub-tasks of the given SedRepeatedTask into stages.
+ */
+void
+SedExecutionPlan::getSubTaskStages(
+  const SedRepeatedTask& task,
+  std::vector<std::vector<const SedSubTask*> >& stages) const
+{
+  stages.clear();
+
+  vector<const SedSubTask*> subTasks;
+  task.getSubTasksInOrder(subTasks);
+
+  vector<const SedBase*> stageModels;
+  vector<const SedBase*> models;
+
+  for (size_t i = 0; i < subTasks.size(); ++i)
+  {
+    const SedSubTask* subTask = subTasks[i];
+    getModels(mDocument.getTask(subTask->getTask()), models);
+
+    // sub-tasks of the same order share a stage unless they run the same
+    // model, whose state the first one would change under the second
+    bool joins = !stages.empty() && subTask->isSetOrder() &&
+                 stages.back().front()->isSetOrder() &&
+                 stages.back().front()->getOrder() == subTask->getOrder();
+    for (size_t j = 0; joins && j < models.size(); ++j)
+    {
+      joins = find(stageModels.begin(), stageModels.end(), models[j]) ==
+              stageModels.end();
+    }
+
+    if (!joins)
+    {
+      stages.push_back(vector<const SedSubTask*>());
+      stageModels.clear();
+    }
+    stages.back().push_back(subTask);
+    stageModels.insert(stageModels.end(), models.begin(), models.end());
+  }
+}
+
+
+/*
+ * Returns true if the iterations of the given SedRepeatedTask may run in
+ * parallel.
+ */
+bool
+SedExecutionPlan::hasIndependentIterations(const SedRepeatedTask& task) const
+{
+  return task.getResetModel();
+}
+
+
+/*
+ * Stores the top-level elements that the given ones need.
+ */
+void
+SedExecutionPlan::getRequiredElements(
+  const std::vector<std::string>& ids,
+  std::vector<const SedBase*>& elements) const
+{
+  vector<bool> required;
+  markRequired(ids, required);
+
+  elements.clear();
+  for (size_t n = 0; n < mNodes.size(); ++n)
+  {
+    if (required[n])
+    {
+      elements.push_back(mNodes[n]);
+    }
+  }
+}
+
+
+/*
+ * Returns a copy of the SedDocument with only the top-level elements needed
+ * by those with the given ids.
+ */
+SedDocument*
+SedExecutionPlan::createPrunedDocument(
+  const std::vector<std::string>& ids) const
+{
+  vector<bool> required;
+  markRequired(ids, required);
+
+  // the lists of the copy hold the same elements in the same order as
+  // those the plan was made from
+  SedDocument* copy = mDocument.clone();
+  unsigned int n = 0;
+  pruneList(copy->getListOfDataDescriptions(), required, n);
+  pruneList(copy->getListOfModels(), required, n);
+  pruneList(copy->getListOfSimulations(), required, n);
+  pruneList(copy->getListOfTasks(), required, n);
+  pruneList(copy->getListOfDataGenerators(), required, n);
+  pruneList(copy->getListOfOutputs(), required, n);
+
+  return copy;
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Resolves the references of the nth element and the elements nested in
+ * it; references from sub-tasks are kept apart, as the tasks they refer to
+ * run as part of the element.
+ */
+void
+SedExecutionPlan::addDependencies(unsigned int n,
+                                  const vector<const SedBase*>& elements)
+{
+  vector<string> refs;
+
+  for (size_t i = 0; i < elements.size(); ++i)
+  {
+    const bool subTask = (elements[i]->getTypeCode() == SEDML_TASK_SUBTASK);
+
+    refs.clear();
+    elements[i]->getSIdRefs(refs);
+
+    for (size_t j = 0; j < refs.size(); ++j)
+    {
+      unordered_map<string, unsigned int>::const_iterator it =
+        mOwners.find(refs[j]);
+      if (it == mOwners.end())
+      {
+        continue;
+      }
+
+      if (subTask)
+      {
+        mSubTaskTasks[n].push_back(it->second);
+      }
+      else if (it->second != n)
+      {
+        mDependencyIndices[n].push_back(it->second);
+      }
+    }
+  }
+
+  // a model derived from another one of the document names it as its
+  // source, with or without a leading '#'
+  if (mNodes[n]->getTypeCode() == SEDML_MODEL)
+  {
+    string source = static_cast<const SedModel*>(mNodes[n])->getSource();
+    if (!source.empty() && source[0] == '#')
+    {
+      source.erase(0, 1);
+    }
+
+    unordered_map<string, unsigned int>::const_iterator it =
+      mOwners.find(source);
+    if (it != mOwners.end() && it->second != n &&
+        mNodes[it->second]->getTypeCode() == SEDML_MODEL &&
+        mNodes[it->second]->getId() == source)
+    {
+      mDependencyIndices[n].push_back(it->second);
+    }
+  }
+}
+
+
+/*
+ * Adds the dependencies of the tasks run by the sub-tasks of the nth
+ * element to its own; state holds 1 for elements being visited and 2 for
+ * those done.
+ */
+void
+SedExecutionPlan::inheritDependencies(unsigned int n, vector<int>& state)
+{
+  if (state[n] != 0)
+  {
+    return;
+  }
+
+  state[n] = 1;
+  vector<unsigned int>& dependencies = mDependencyIndices[n];
+
+  for (size_t i = 0; i < mSubTaskTasks[n].size(); ++i)
+  {
+    unsigned int task = mSubTaskTasks[n][i];
+
+    // a task that runs itself, directly or not, depends on itself, which
+    // keeps it out of the stages
+    if (state[task] == 1)
+    {
+      dependencies.push_back(task);
+      continue;
+    }
+
+    inheritDependencies(task, state);
+    for (size_t j = 0; j < mDependencyIndices[task].size(); ++j)
+    {
+      if (mDependencyIndices[task][j] != n)
+      {
+        dependencies.push_back(mDependencyIndices[task][j]);
+      }
+    }
+  }
+
+  sort(dependencies.begin(), dependencies.end());
+  dependencies.erase(unique(dependencies.begin(), dependencies.end()),
+                     dependencies.end());
+  state[n] = 2;
+}
+
+
+/*
+ * Splits the elements into stages, each depending only on earlier ones.
+ */
+void
+SedExecutionPlan::schedule()
+{
+  const unsigned int numNodes = (unsigned int)(mNodes.size());
+  vector<unsigned int> numPending(numNodes);
+  vector<vector<unsigned int> > dependents(numNodes);
+  vector<unsigned int> stage;
+
+  mDependencies.resize(numNodes);
+  for (unsigned int n = 0; n < numNodes; ++n)
+  {
+    const vector<unsigned int>& dependencies = mDependencyIndices[n];
+    numPending[n] = (unsigned int)(dependencies.size());
+
+    for (size_t i = 0; i < dependencies.size(); ++i)
+    {
+      dependents[dependencies[i]].push_back(n);
+      mDependencies[n].push_back(mNodes[dependencies[i]]);
+    }
+    if (dependencies.empty())
+    {
+      stage.push_back(n);
+    }
+  }
+
+  mStageIndices.assign(numNodes, -1);
+  vector<unsigned int> next;
+
+  while (!stage.empty())
+  {
+    mStages.push_back(vector<const SedBase*>());
+    next.clear();
+
+    for (size_t i = 0; i < stage.size(); ++i)
+    {
+      mStages.back().push_back(mNodes[stage[i]]);
+      mStageIndices[stage[i]] = (int)(mStages.size() - 1);
+
+      const vector<unsigned int>& waiting = dependents[stage[i]];
+      for (size_t j = 0; j < waiting.size(); ++j)
+      {
+        if (--numPending[waiting[j]] == 0)
+        {
+          next.push_back(waiting[j]);
+        }
+      }
+    }
+
+    sort(next.begin(), next.end());
+    stage.swap(next);
+  }
+
+  for (unsigned int n = 0; n < numNodes; ++n)
+  {
+    if (mStageIndices[n] < 0)
+    {
+      mUnscheduled.push_back(mNodes[n]);
+    }
+  }
+}
+
+
+/*
+ * Stores the models the given task runs to models.
+ */
+void
+SedExecutionPlan::getModels(const SedAbstractTask* task,
+                            vector<const SedBase*>& models) const
+{
+  models.clear();
+
+  unordered_map<const SedBase*, unsigned int>::const_iterator it =
+    mNodeIndex.find(task);
+  if (it == mNodeIndex.end())
+  {
+    return;
+  }
+
+  const vector<const SedBase*>& dependencies = mDependencies[it->second];
+  for (size_t i = 0; i < dependencies.size(); ++i)
+  {
+    if (dependencies[i]->getTypeCode() == SEDML_MODEL)
+    {
+      models.push_back(dependencies[i]);
+    }
+  }
+}
+
+
+/*
+ * Marks the top-level elements that those with the given ids need, walking
+ * the dependencies backwards.
+ */
+void
+SedExecutionPlan::markRequired(const vector<string>& ids,
+                               vector<bool>& required) const
+{
+  required.assign(mNodes.size(), false);
+  vector<unsigned int> pending;
+
+  for (size_t i = 0; i < ids.size(); ++i)
+  {
+    unordered_map<string, unsigned int>::const_iterator it =
+      mOwners.find(ids[i]);
+    if (it != mOwners.end() && mNodes[it->second]->getId() == ids[i] &&
+        !required[it->second])
+    {
+      required[it->second] = true;
+      pending.push_back(it->second);
+    }
+  }
+
+  // the tasks of sub-tasks are not dependencies, but have to stay in the
+  // document for the repeated tasks to run them
+  while (!pending.empty())
+  {
+    unsigned int n = pending.back();
+    pending.pop_back();
+
+    for (int list = 0; list < 2; ++list)
+    {
+      const vector<unsigned int>& next =
+        (list == 0) ? mDependencyIndices[n] : mSubTaskTasks[n];
+      for (size_t i = 0; i < next.size(); ++i)
+      {
+        if (!required[next[i]])
+        {
+          required[next[i]] = true;
+          pending.push_back(next[i]);
+        }
+      }
+    }
+  }
+}
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,265 @@
+/**
+ * @file SedExecutionPlan.h
+ * @brief Definition of the SedExecutionPlan class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedExecutionPlan
+ * @sbmlbrief{sedml} The order in which the elements of a SedDocument can be
+ * processed.
+ *
+ * The elements of a SedDocument refer to each other by id: tasks to models
+ * and simulations, models to the models they are derived from through
+ * their "source", data generators to tasks, outputs to data generators.  A
+ * SedExecutionPlan derives the dependency graph of the top-level elements
+ * (data descriptions, models, simulations, tasks, data generators and
+ * outputs) from these references, and splits it into stages: each element
+ * depends only on elements of earlier stages, so the elements of a stage
+ * can be processed in parallel once the previous stages are done.
+ *
+ * The tasks run by the sub-tasks of a SedRepeatedTask are run as part of
+ * it, not before it, so the repeated task depends on what those tasks
+ * depend on rather than on the tasks themselves.  Within the repeated task,
+ * getSubTaskStages() groups the sub-tasks that may run together, and
+ * hasIndependentIterations() tells whether its iterations may.
+ *
+ * Elements that depend on themselves, directly or not, cannot be scheduled
+ * and are left out of the stages, as are those depending on them.
+ *
+ * The same graph, walked backwards from some of the outputs, yields the
+ * elements those outputs need: getRequiredElements() lists them, and
+ * createPrunedDocument() copies the SedDocument without all the others, so
+ * that simulations no requested output depends on are never run.
+ *
+ * The SedDocument must not be modified while a SedExecutionPlan of it is
+ * in use.
+ */
+
+
+#ifndef SedExecutionPlan_H__
+#define SedExecutionPlan_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sedml/SedDocument.h>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedExecutionPlan
+{
+public:
+
+  /**
+   * Creates the SedExecutionPlan of the given SedDocument.
+   */
+  SedExecutionPlan(const SedDocument& document);
+
+
+  /**
+   * Returns the SedDocument planned by this SedExecutionPlan.
+   */
+  const SedDocument& getDocument() const;
+
+
+  /**
+   * Returns the number of stages.
+   */
+  unsigned int getNumStages() const;
+
+
+  /**
+   * Returns the elements of the nth stage, in document order.
+   *
+   * @return the elements of the stage, or an empty vector if @p n is out of
+   * range.
+   */
+  const std::vector<const SedBase*>& getStage(unsigned int n) const;
+
+
+  /**
+   * Returns the stage of the given top-level element.
+   *
+   * @return the index of the stage, or @c -1 if @p element is not part of
+   * any stage.
+   */
+  int getStageIndex(const SedBase* element) const;
+
+
+  /**
+   * Returns the elements the given top-level element depends on directly,
+   * in document order.
+   *
+   * @return the elements @p element depends on, or an empty vector if it is
+   * not a top-level element of the SedDocument.
+   */
+  const std::vector<const SedBase*>&
+  getDependencies(const SedBase* element) const;
+
+
+  /**
+   * Returns the number of top-level elements left out of the stages
+   * because they depend on themselves, directly or not.
+   */
+  unsigned int getNumUnscheduled() const;
+
+
+  /**
+   * Returns the nth element left out of the stages.
+   *
+   * @return the element, or @c NULL if @p n is out of range.
+   */
+  const SedBase* getUnscheduled(unsigned int n) const;
+
+
+  /**
+   * Groups the sub-tasks of the given SedRepeatedTask into the stages they
+   * run in within each of its iterations.
+   *
+   * The sub-tasks run in the order given by their "order" attribute.
+   * Consecutive sub-tasks with the same order share a stage, and may run in
+   * parallel, unless they run the same model; sub-tasks without an order
+   * run last, one at a time.
+   *
+   * @param task the SedRepeatedTask of the SedDocument.
+   *
+   * @param stages the vector the stages are stored to, replacing its
+   * contents.
+   */
+  void getSubTaskStages(const SedRepeatedTask& task,
+                        std::vector<std::vector<const SedSubTask*> >& stages)
+    const;
+
+
+  /**
+   * Returns @c true if the iterations of the given SedRepeatedTask may run
+   * in parallel.
+   *
+   * This is the case if its models are reset before each iteration, so that
+   * no iteration starts from the state another one has left.
+   */
+  bool hasIndependentIterations(const SedRepeatedTask& task) const;
+
+
+  /**
+   * Stores the top-level elements that the given ones need to the given
+   * vector, in document order.
+   *
+   * These are the elements with the given ids, typically outputs, and all
+   * the elements they depend on, directly or not, including the tasks run
+   * by the sub-tasks of the repeated tasks among them.
+   *
+   * @param ids the ids of the top-level elements to keep; those of no
+   * top-level element are ignored.
+   *
+   * @param elements the vector the elements are stored to, replacing its
+   * contents.
+   */
+  void getRequiredElements(const std::vector<std::string>& ids,
+                           std::vector<const SedBase*>& elements) const;
+
+
+  /**
+   * Returns a copy of the SedDocument with only the top-level elements
+   * needed by those with the given ids.
+   *
+   * Styles and algorithm parameters are copied in full.
+   *
+   * @param ids the ids of the top-level elements to keep, typically those of
+   * outputs.
+   *
+   * @return the pruned copy of the SedDocument; the caller owns it.
+   *
+   * @see getRequiredElements()
+   */
+  SedDocument* createPrunedDocument(const std::vector<std::string>& ids)
+    const;
+
+
+private:
+
+  /** @cond doxygenLibsedmlInternal */
+
+  SedExecutionPlan(const SedExecutionPlan&);
+  SedExecutionPlan& operator=(const SedExecutionPlan&);
+
+  void addDependencies(unsigned int n,
+                       const std::vector<const SedBase*>& elements);
+
+  void inheritDependencies(unsigned int n, std::vector<int>& state);
+
+  void schedule();
+
+  void getModels(const SedAbstractTask* task,
+                 std::vector<const SedBase*>& models) const;
+
+  void markRequired(const std::vector<std::string>& ids,
+                    std::vector<bool>& required) const;
+
+  const SedDocument& mDocument;
+
+  // the top-level elements in document order, the index of each and the
+  // top-level element owning each id, including those of nested elements
+  std::vector<const SedBase*> mNodes;
+  std::unordered_map<const SedBase*, unsigned int> mNodeIndex;
+  std::unordered_map<std::string, unsigned int> mOwners;
+
+  // for each element, the elements it depends on and the tasks run by its
+  // sub-tasks, by index, and the elements it depends on
+  std::vector<std::vector<unsigned int> > mDependencyIndices;
+  std::vector<std::vector<unsigned int> > mSubTaskTasks;
+  std::vector<std::vector<const SedBase*> > mDependencies;
+
+  std::vector<std::vector<const SedBase*> > mStages;
+  std::vector<int> mStageIndices;
+  std::vector<const SedBase*> mUnscheduled;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedExecutionPlan_H__ */
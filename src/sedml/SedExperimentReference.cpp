@@ -56,7 +56,6 @@ SedExperimentReference::SedExperimentReference(unsigned int level, unsigned int
   : SedBase(level, version)
   , mExperimentId ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -98,6 +97,32 @@ SedExperimentReference::operator=(const SedExperimentReference& rhs)
 }
 
 
+/*
+ * Move constructor for SedExperimentReference.
+ */
+SedExperimentReference::SedExperimentReference(SedExperimentReference&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mExperimentId ( std::move(orig.mExperimentId) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedExperimentReference.
+ */
+SedExperimentReference&
+SedExperimentReference::operator=(SedExperimentReference&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mExperimentId = std::move(rhs.mExperimentId);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedExperimentReference object.
  */
@@ -149,6 +174,7 @@ SedExperimentReference::setExperimentId(const std::string& experimentId)
   }
   else
   {
+    sIdRefChanged(mExperimentId, experimentId);
     mExperimentId = experimentId;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -161,6 +187,7 @@ SedExperimentReference::setExperimentId(const std::string& experimentId)
 int
 SedExperimentReference::unsetExperimentId()
 {
+  sIdRefChanged(mExperimentId, std::string());
   mExperimentId.erase();
 
   if (mExperimentId.empty() == true)
@@ -188,6 +215,19 @@ SedExperimentReference::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedExperimentReference to refs.
+ */
+void
+SedExperimentReference::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetExperimentId())
+  {
+    refs.push_back(mExperimentId);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedExperimentReference object.
  */
@@ -113,6 +113,27 @@ public:
   SedExperimentReference& operator=(const SedExperimentReference& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedExperimentReference.
+   *
+   * @param orig the SedExperimentReference instance to move from; it is left empty.
+   */
+  SedExperimentReference(SedExperimentReference&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedExperimentReference.
+   *
+   * @param rhs the SedExperimentReference object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedExperimentReference& operator=(SedExperimentReference&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedExperimentReference object.
    *
@@ -178,6 +199,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedExperimentReference object.
    *
@@ -58,7 +58,6 @@ SedFigure::SedFigure(unsigned int level, unsigned int version)
   , mIsSetNumCols (false)
   , mSubPlots (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -115,6 +114,42 @@ SedFigure::operator=(const SedFigure& rhs)
 }
 
 
+/*
+ * Move constructor for SedFigure.
+ */
+SedFigure::SedFigure(SedFigure&& orig) noexcept
+  : SedOutput( std::move(orig) )
+  , mNumRows ( std::move(orig.mNumRows) )
+  , mIsSetNumRows ( std::move(orig.mIsSetNumRows) )
+  , mNumCols ( std::move(orig.mNumCols) )
+  , mIsSetNumCols ( std::move(orig.mIsSetNumCols) )
+  , mSubPlots ( std::move(orig.mSubPlots) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedFigure.
+ */
+SedFigure&
+SedFigure::operator=(SedFigure&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mNumRows = std::move(rhs.mNumRows);
+    mIsSetNumRows = std::move(rhs.mIsSetNumRows);
+    mNumCols = std::move(rhs.mNumCols);
+    mIsSetNumCols = std::move(rhs.mIsSetNumCols);
+    mSubPlots = std::move(rhs.mSubPlots);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFigure object.
  */
@@ -901,6 +936,20 @@ SedFigure::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedFigure
+ */
+void
+SedFigure::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mSubPlots, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
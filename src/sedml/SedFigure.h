@@ -116,6 +116,27 @@ public:
   SedFigure& operator=(const SedFigure& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedFigure.
+   *
+   * @param orig the SedFigure instance to move from; it is left empty.
+   */
+  SedFigure(SedFigure&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedFigure.
+   *
+   * @param rhs the SedFigure object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedFigure& operator=(SedFigure&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFigure object.
    *
@@ -846,6 +867,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedFigure.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
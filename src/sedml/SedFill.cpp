@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFill.h>
+#include <sedml/SedStyle.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -55,7 +56,6 @@ SedFill::SedFill(unsigned int level, unsigned int version)
   , mColor ("")
   //, mSecondColor ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -99,6 +99,32 @@ SedFill::operator=(const SedFill& rhs)
 }
 
 
+/*
+ * Move constructor for SedFill.
+ */
+SedFill::SedFill(SedFill&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mColor ( std::move(orig.mColor) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedFill.
+ */
+SedFill&
+SedFill::operator=(SedFill&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mColor = std::move(rhs.mColor);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFill object.
  */
@@ -164,6 +190,8 @@ SedFill::isSetColor() const
 int
 SedFill::setColor(const std::string& color)
 {
+  styleChanged();
+
   mColor = color;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -186,6 +214,8 @@ SedFill::setColor(const std::string& color)
 int
 SedFill::unsetColor()
 {
+  styleChanged();
+
   mColor.erase();
 
   if (mColor.empty() == true)
@@ -680,6 +710,26 @@ SedFill::writeAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Tells the parent SedStyle, if any, that this SedFill changes
+ */
+void
+SedFill::styleChanged()
+{
+  SedBase* parent = getParentSedObject();
+
+  if (parent != NULL && parent->getTypeCode() == SEDML_STYLE)
+  {
+    static_cast<SedStyle*>(parent)->styleChanged();
+  }
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
@@ -111,6 +111,27 @@ public:
   SedFill& operator=(const SedFill& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedFill.
+   *
+   * @param orig the SedFill instance to move from; it is left empty.
+   */
+  SedFill(SedFill&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedFill.
+   *
+   * @param rhs the SedFill object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedFill& operator=(SedFill&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFill object.
    *
@@ -564,6 +585,17 @@ protected:
   /** @endcond */
 
 
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Tells the parent SedStyle, if any, that this SedFill changes
+   */
+  void styleChanged();
+
+  /** @endcond */
+
+
 };
 
 
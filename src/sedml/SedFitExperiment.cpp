@@ -58,7 +58,6 @@ SedFitExperiment::SedFitExperiment(unsigned int level, unsigned int version)
   , mAlgorithm (NULL)
   , mFitMappings (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -124,6 +123,42 @@ SedFitExperiment::operator=(const SedFitExperiment& rhs)
 }
 
 
+/*
+ * Move constructor for SedFitExperiment.
+ */
+SedFitExperiment::SedFitExperiment(SedFitExperiment&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mType ( std::move(orig.mType) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mFitMappings ( std::move(orig.mFitMappings) )
+{
+  orig.mAlgorithm = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedFitExperiment.
+ */
+SedFitExperiment&
+SedFitExperiment::operator=(SedFitExperiment&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mType = std::move(rhs.mType);
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+    mFitMappings = std::move(rhs.mFitMappings);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFitExperiment object.
  */
@@ -1075,6 +1110,25 @@ SedFitExperiment::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedFitExperiment
+ */
+void
+SedFitExperiment::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mAlgorithm != NULL)
+  {
+    visit(mAlgorithm, data);
+  }
+
+  visit(&mFitMappings, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -144,6 +144,27 @@ public:
   SedFitExperiment& operator=(const SedFitExperiment& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedFitExperiment.
+   *
+   * @param orig the SedFitExperiment instance to move from; it is left empty.
+   */
+  SedFitExperiment(SedFitExperiment&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedFitExperiment.
+   *
+   * @param rhs the SedFitExperiment object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedFitExperiment& operator=(SedFitExperiment&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFitExperiment object.
    *
@@ -987,6 +1008,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedFitExperiment.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
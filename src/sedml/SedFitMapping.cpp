@@ -61,7 +61,6 @@ SedFitMapping::SedFitMapping(unsigned int level, unsigned int version)
   , mIsSetWeight (false)
   , mPointWeight ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -117,6 +116,42 @@ SedFitMapping::operator=(const SedFitMapping& rhs)
 }
 
 
+/*
+ * Move constructor for SedFitMapping.
+ */
+SedFitMapping::SedFitMapping(SedFitMapping&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mDataSource ( std::move(orig.mDataSource) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mType ( std::move(orig.mType) )
+  , mWeight ( std::move(orig.mWeight) )
+  , mIsSetWeight ( std::move(orig.mIsSetWeight) )
+  , mPointWeight ( std::move(orig.mPointWeight) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedFitMapping.
+ */
+SedFitMapping&
+SedFitMapping::operator=(SedFitMapping&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mDataSource = std::move(rhs.mDataSource);
+    mTarget = std::move(rhs.mTarget);
+    mType = std::move(rhs.mType);
+    mWeight = std::move(rhs.mWeight);
+    mIsSetWeight = std::move(rhs.mIsSetWeight);
+    mPointWeight = std::move(rhs.mPointWeight);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFitMapping object.
  */
@@ -262,6 +297,7 @@ SedFitMapping::setDataSource(const std::string& dataSource)
   }
   else
   {
+    sIdRefChanged(mDataSource, dataSource);
     mDataSource = dataSource;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -280,6 +316,7 @@ SedFitMapping::setTarget(const std::string& target)
   }
   else
   {
+    sIdRefChanged(mTarget, target);
     mTarget = target;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -346,6 +383,7 @@ SedFitMapping::setPointWeight(const std::string& pointWeight)
   }
   else
   {
+    sIdRefChanged(mPointWeight, pointWeight);
     mPointWeight = pointWeight;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -358,6 +396,7 @@ SedFitMapping::setPointWeight(const std::string& pointWeight)
 int
 SedFitMapping::unsetDataSource()
 {
+  sIdRefChanged(mDataSource, std::string());
   mDataSource.erase();
 
   if (mDataSource.empty() == true)
@@ -377,6 +416,7 @@ SedFitMapping::unsetDataSource()
 int
 SedFitMapping::unsetTarget()
 {
+  sIdRefChanged(mTarget, std::string());
   mTarget.erase();
 
   if (mTarget.empty() == true)
@@ -427,6 +467,7 @@ SedFitMapping::unsetWeight()
 int
 SedFitMapping::unsetPointWeight()
 {
+  sIdRefChanged(mPointWeight, std::string());
   mPointWeight.erase();
 
   if (mPointWeight.empty() == true)
@@ -464,6 +505,29 @@ SedFitMapping::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedFitMapping to refs.
+ */
+void
+SedFitMapping::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetDataSource())
+  {
+    refs.push_back(mDataSource);
+  }
+
+  if (isSetTarget())
+  {
+    refs.push_back(mTarget);
+  }
+
+  if (isSetPointWeight())
+  {
+    refs.push_back(mPointWeight);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedFitMapping object.
  */
@@ -147,6 +147,27 @@ public:
   SedFitMapping& operator=(const SedFitMapping& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedFitMapping.
+   *
+   * @param orig the SedFitMapping instance to move from; it is left empty.
+   */
+  SedFitMapping(SedFitMapping&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedFitMapping.
+   *
+   * @param rhs the SedFitMapping object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedFitMapping& operator=(SedFitMapping&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFitMapping object.
    *
@@ -426,6 +447,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedFitMapping object.
    *
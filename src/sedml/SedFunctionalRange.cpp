@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedFunctionalRange.h>
+#include <sedml/SedDocument.h>
 #include <sedml/SedVariable.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/math/MathML.h>
@@ -57,11 +58,10 @@ SedFunctionalRange::SedFunctionalRange(unsigned int level,
                                        unsigned int version)
   : SedRange(level, version)
   , mRange ("")
-  , mMath (NULL)
+  , mMath ()
   , mVariables (level, version)
   , mParameters (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -73,7 +73,7 @@ SedFunctionalRange::SedFunctionalRange(unsigned int level,
 SedFunctionalRange::SedFunctionalRange(SedNamespaces *sedmlns)
   : SedRange(sedmlns)
   , mRange ("")
-  , mMath (NULL)
+  , mMath ()
   , mVariables (sedmlns)
   , mParameters (sedmlns)
 {
@@ -88,15 +88,10 @@ SedFunctionalRange::SedFunctionalRange(SedNamespaces *sedmlns)
 SedFunctionalRange::SedFunctionalRange(const SedFunctionalRange& orig)
   : SedRange( orig )
   , mRange ( orig.mRange )
-  , mMath ( NULL )
+  , mMath ( orig.mMath )
   , mVariables ( orig.mVariables )
   , mParameters ( orig.mParameters )
 {
-  if (orig.mMath != NULL)
-  {
-    mMath = orig.mMath->deepCopy();
-  }
-
   connectToChild();
 }
 
@@ -113,15 +108,7 @@ SedFunctionalRange::operator=(const SedFunctionalRange& rhs)
     mRange = rhs.mRange;
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
-    delete mMath;
-    if (rhs.mMath != NULL)
-    {
-      mMath = rhs.mMath->deepCopy();
-    }
-    else
-    {
-      mMath = NULL;
-    }
+    mMath = rhs.mMath;
 
     connectToChild();
   }
@@ -130,6 +117,40 @@ SedFunctionalRange::operator=(const SedFunctionalRange& rhs)
 }
 
 
+/*
+ * Move constructor for SedFunctionalRange.
+ */
+SedFunctionalRange::SedFunctionalRange(SedFunctionalRange&& orig) noexcept
+  : SedRange( std::move(orig) )
+  , mRange ( std::move(orig.mRange) )
+  , mMath ( std::move(orig.mMath) )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedFunctionalRange.
+ */
+SedFunctionalRange&
+SedFunctionalRange::operator=(SedFunctionalRange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mRange = std::move(rhs.mRange);
+    mMath = std::move(rhs.mMath);
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedFunctionalRange object.
  */
@@ -145,8 +166,6 @@ SedFunctionalRange::clone() const
  */
 SedFunctionalRange::~SedFunctionalRange()
 {
-  delete mMath;
-  mMath = NULL;
 }
 
 
@@ -183,6 +202,7 @@ SedFunctionalRange::setRange(const std::string& range)
   }
   else
   {
+    sIdRefChanged(mRange, range);
     mRange = range;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -195,6 +215,7 @@ SedFunctionalRange::setRange(const std::string& range)
 int
 SedFunctionalRange::unsetRange()
 {
+  sIdRefChanged(mRange, std::string());
   mRange.erase();
 
   if (mRange.empty() == true)
@@ -214,7 +235,7 @@ SedFunctionalRange::unsetRange()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedFunctionalRange::getMath() const
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -224,7 +245,7 @@ SedFunctionalRange::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedFunctionalRange::getMath()
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -235,7 +256,7 @@ SedFunctionalRange::getMath()
 bool
 SedFunctionalRange::isSetMath() const
 {
-  return (mMath != NULL);
+  return mMath.isSet();
 }
 
 
@@ -246,14 +267,13 @@ int
 SedFunctionalRange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
   math)
 {
-  if (mMath == math)
+  if (mMath.owns(math))
   {
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (math == NULL)
   {
-    delete mMath;
-    mMath = NULL;
+    mMath.set(NULL);
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!(math->isWellFormedASTNode()))
@@ -262,8 +282,7 @@ SedFunctionalRange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
   }
   else
   {
-    delete mMath;
-    mMath = (math != NULL) ? math->deepCopy() : NULL;
+    mMath.set(math->deepCopy());
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -275,8 +294,7 @@ SedFunctionalRange::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 int
 SedFunctionalRange::unsetMath()
 {
-  delete mMath;
-  mMath = NULL;
+  mMath.set(NULL);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -649,9 +667,25 @@ SedFunctionalRange::renameSIdRefs(const std::string& oldid,
     setRange(newid);
   }
 
-  if (isSetMath())
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math = getMath();
+
+  // math that fails to parse has no references to rename
+  if (math != NULL)
   {
-    mMath->renameSIdRefs(oldid, newid);
+    math->renameSIdRefs(oldid, newid);
+  }
+}
+
+
+/*
+ * Appends the values of the set SIdRef attributes of this SedFunctionalRange to refs.
+ */
+void
+SedFunctionalRange::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetRange())
+  {
+    refs.push_back(mRange);
   }
 }
 
@@ -720,10 +754,8 @@ SedFunctionalRange::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER
 {
   SedRange::writeElements(stream);
 
-  if (isSetMath() == true)
-  {
-    writeMathML(getMath(), stream, NULL);
-  }
+  // math that does not parse is still written back as it was read
+  mMath.write(stream);
 
   if (getNumVariables() > 0)
   {
@@ -1213,6 +1245,22 @@ SedFunctionalRange::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedFunctionalRange
+ */
+void
+SedFunctionalRange::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mVariables, data);
+
+  visit(&mParameters, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -1369,8 +1417,7 @@ SedFunctionalRange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER
   {
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
-    delete mMath;
-    mMath = readMathML(stream, prefix);
+    mMath.read(stream, prefix);
     read = true;
   }
 
@@ -52,6 +52,7 @@
 
 #include <sedml/SedRange.h>
 #include <sbml/math/ASTNode.h>
+#include <sedml/SedLazyMath.h>
 #include <sedml/SedListOfVariables.h>
 #include <sedml/SedListOfParameters.h>
 #include <sbml/common/libsbml-namespace.h>
@@ -67,7 +68,7 @@ protected:
   /** @cond doxygenLibSEDMLInternal */
 
   std::string mRange;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* mMath;
+  SedLazyMath mMath;
   SedListOfVariables mVariables;
   SedListOfParameters mParameters;
 
@@ -119,6 +120,27 @@ public:
   SedFunctionalRange& operator=(const SedFunctionalRange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedFunctionalRange.
+   *
+   * @param orig the SedFunctionalRange instance to move from; it is left empty.
+   */
+  SedFunctionalRange(SedFunctionalRange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedFunctionalRange.
+   *
+   * @param rhs the SedFunctionalRange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedFunctionalRange& operator=(SedFunctionalRange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedFunctionalRange object.
    *
@@ -742,6 +764,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedFunctionalRange object.
    *
@@ -1205,6 +1233,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedFunctionalRange.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
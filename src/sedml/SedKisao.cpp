@@ -0,0 +1,191 @@
+/**
+ * @file SedKisao.cpp
+ * @brief Queries on the KiSAO ontology.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedKisao.h>
+
+#include <climits>
+#include <cstddef>
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Returns the entry of kisaoTerms for the given number, or NULL.
+ */
+static const KisaoTerm*
+getKisaoTerm(int kisaoID)
+{
+  if (kisaoID < 0 || kisaoID > kisaoMaxID || kisaoTermIndex[kisaoID] < 0)
+  {
+    return NULL;
+  }
+
+  return &kisaoTerms[kisaoTermIndex[kisaoID]];
+}
+
+
+/*
+ * Returns the number of is_a links between the given terms through their
+ * nearest common ancestor that is not a root, or UINT_MAX if there is none.
+ */
+static unsigned int
+getKisaoDistance(const KisaoTerm& term, const KisaoTerm& other)
+{
+  if (&term == &other)
+  {
+    return 0;
+  }
+
+  unsigned int best = UINT_MAX;
+
+  // either term counts as an ancestor of itself at distance 0
+  for (unsigned int i = 0; i <= term.numAncestors; ++i)
+  {
+    const KisaoTerm& ancestor =
+      (i == 0) ? term : kisaoTerms[term.ancestors[i - 1]];
+    unsigned int distance = (i == 0) ? 0 : term.distances[i - 1];
+
+    if (ancestor.numAncestors == 0)
+    {
+      continue;
+    }
+
+    for (unsigned int j = 0; j <= other.numAncestors; ++j)
+    {
+      const KisaoTerm& common =
+        (j == 0) ? other : kisaoTerms[other.ancestors[j - 1]];
+
+      if (&common == &ancestor)
+      {
+        unsigned int otherDistance = (j == 0) ? 0 : other.distances[j - 1];
+        if (distance + otherDistance < best)
+        {
+          best = distance + otherDistance;
+        }
+        break;
+      }
+    }
+  }
+
+  return best;
+}
+
+/** @endcond */
+
+
+/*
+ * Returns the name of the KiSAO term with the given number.
+ */
+const char*
+getKisaoName(int kisaoID)
+{
+  const KisaoTerm* term = getKisaoTerm(kisaoID);
+  return (term != NULL) ? term->name : NULL;
+}
+
+
+/*
+ * Returns true if a KiSAO term is a kind of another one.
+ */
+bool
+isKisaoKindOf(int kisaoID, int ancestorID)
+{
+  const KisaoTerm* term = getKisaoTerm(kisaoID);
+  const KisaoTerm* ancestor = getKisaoTerm(ancestorID);
+
+  if (term == NULL || ancestor == NULL)
+  {
+    return false;
+  }
+
+  if (term == ancestor)
+  {
+    return true;
+  }
+
+  // terms without descendants have no bit
+  if (ancestor->bit < 0)
+  {
+    return false;
+  }
+
+  return ((term->ancestorBits[ancestor->bit / 64] >> (ancestor->bit % 64))
+          & 1) != 0;
+}
+
+
+/*
+ * Returns the supported KiSAO term closest to the given one.
+ */
+int
+getKisaoSubstitute(int kisaoID, const std::vector<int>& supportedIDs)
+{
+  const KisaoTerm* term = getKisaoTerm(kisaoID);
+  if (term == NULL)
+  {
+    return -1;
+  }
+
+  int substitute = -1;
+  unsigned int best = UINT_MAX;
+
+  for (vector<int>::const_iterator it = supportedIDs.begin();
+       it != supportedIDs.end() && best > 0; ++it)
+  {
+    const KisaoTerm* candidate = getKisaoTerm(*it);
+    if (candidate == NULL)
+    {
+      continue;
+    }
+
+    unsigned int distance = getKisaoDistance(*term, *candidate);
+    if (distance < best)
+    {
+      substitute = *it;
+      best = distance;
+    }
+  }
+
+  return substitute;
+}
+
+
+LIBSEDML_CPP_NAMESPACE_END
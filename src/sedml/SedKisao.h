@@ -0,0 +1,148 @@
+/**
+ * @file SedKisao.h
+ * @brief Queries on the KiSAO ontology.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * The terms of the KiSAO version libSEDML was built with are compiled into a
+ * constant table, generated from src/kisao/KISAO.csv by
+ * src/kisao/transform_kisao.py, so that looking up a term needs neither
+ * initialization nor memory allocation.
+ */
+
+
+#ifndef SedKisao_H__
+#define SedKisao_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <vector>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/**
+ * Returns the name of the KiSAO term with the given number.
+ *
+ * @param kisaoID the number of the term, such as 19 for KISAO:0000019.
+ *
+ * @return the name of the term, or @c NULL if it is not a known term.
+ */
+LIBSEDML_EXTERN
+const char* getKisaoName(int kisaoID);
+
+
+/**
+ * Returns @c true if the KiSAO term @p kisaoID is the term @p ancestorID or,
+ * through one or more is_a links, a kind of it.
+ *
+ * This takes constant time; for instance, whether an algorithm is a kind of
+ * KISAO:0000433 can be checked with isKisaoKindOf(id, 433).
+ *
+ * @param kisaoID the number of the term to check.
+ *
+ * @param ancestorID the number of the term it may be a kind of.
+ *
+ * @return @c true if @p kisaoID is a kind of @p ancestorID, @c false
+ * otherwise or if either is not a known term.
+ */
+LIBSEDML_EXTERN
+bool isKisaoKindOf(int kisaoID, int ancestorID);
+
+
+/**
+ * Returns the term among @p supportedIDs closest to the KiSAO term
+ * @p kisaoID.
+ *
+ * Terms are the closer the fewer is_a links separate them from their
+ * nearest common ancestor; terms that are only related through a root of
+ * the ontology, such as "modelling and simulation algorithm", are not
+ * considered substitutes for each other.  Of equally close terms, the first
+ * one in @p supportedIDs is returned.
+ *
+ * @param kisaoID the number of the term to substitute.
+ *
+ * @param supportedIDs the numbers of the terms to choose from.
+ *
+ * @return the number of the closest term, which is @p kisaoID itself if it
+ * is supported, or @c -1 if none of @p supportedIDs is related to it.
+ */
+LIBSEDML_EXTERN
+int getKisaoSubstitute(int kisaoID, const std::vector<int>& supportedIDs);
+
+
+/** @cond doxygenLibsedmlInternal */
+
+// capacities of KisaoTerm; transform_kisao.py fails if the ontology
+// outgrows them
+static const unsigned int KISAO_ANCESTOR_WORDS = 2;
+static const unsigned int KISAO_MAX_ANCESTORS = 8;
+
+struct KisaoTerm
+{
+  int id;
+  const char* name;
+
+  // the bit standing for this term in the ancestor sets of its
+  // descendants, or -1 if it has none
+  int bit;
+  unsigned long long ancestorBits[KISAO_ANCESTOR_WORDS];
+
+  // the indices in kisaoTerms of all ancestors of this term, nearest first,
+  // and the number of is_a links to each of them
+  unsigned int numAncestors;
+  short ancestors[KISAO_MAX_ANCESTORS];
+  unsigned char distances[KISAO_MAX_ANCESTORS];
+};
+
+// the known terms, sorted by number, and the index in kisaoTerms of each
+// number up to kisaoMaxID (-1 for those that are not terms)
+extern const KisaoTerm kisaoTerms[];
+extern const unsigned int kisaoNumTerms;
+extern const int kisaoMaxID;
+extern const short kisaoTermIndex[];
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedKisao_H__ */
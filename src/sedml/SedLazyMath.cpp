@@ -0,0 +1,301 @@
+/**
+ * @file SedLazyMath.cpp
+ * @brief Implementation of the SedLazyMath class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedLazyMath.h>
+
+#include <sbml/xml/XMLInputStream.h>
+#include <sbml/xml/XMLOutputStream.h>
+#include <sbml/math/MathML.h>
+
+#include <mutex>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+static const char* const MATHML_URI = "http://www.w3.org/1998/Math/MathML";
+
+
+/*
+ * Creates a new SedLazyMath
+ */
+SedLazyMath::SedLazyMath()
+  : mAST (NULL)
+  , mInvalid (false)
+  , mXML ()
+  , mPrefix ()
+{
+}
+
+
+/*
+ * Copy constructor for SedLazyMath
+ */
+SedLazyMath::SedLazyMath(const SedLazyMath& orig)
+  : mAST (NULL)
+  , mInvalid (orig.mInvalid.load())
+  , mXML (orig.mXML)
+  , mPrefix (orig.mPrefix)
+{
+  if (mXML == NULL && orig.mAST != NULL)
+  {
+    mAST = orig.mAST.load()->deepCopy();
+  }
+}
+
+
+/*
+ * Assignment operator for SedLazyMath
+ */
+SedLazyMath&
+SedLazyMath::operator=(const SedLazyMath& rhs)
+{
+  if (&rhs != this)
+  {
+    delete mAST.load();
+    mAST = NULL;
+    mInvalid = rhs.mInvalid.load();
+    mXML = rhs.mXML;
+    mPrefix = rhs.mPrefix;
+
+    if (mXML == NULL && rhs.mAST != NULL)
+    {
+      mAST = rhs.mAST.load()->deepCopy();
+    }
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move constructor for SedLazyMath
+ */
+SedLazyMath::SedLazyMath(SedLazyMath&& orig) noexcept
+  : mAST (orig.mAST.load())
+  , mInvalid (orig.mInvalid.load())
+  , mXML (std::move(orig.mXML))
+  , mPrefix (std::move(orig.mPrefix))
+{
+  orig.mAST = NULL;
+}
+
+
+/*
+ * Move assignment operator for SedLazyMath
+ */
+SedLazyMath&
+SedLazyMath::operator=(SedLazyMath&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    delete mAST.load();
+    mAST = rhs.mAST.load();
+    rhs.mAST = NULL;
+    mInvalid = rhs.mInvalid.load();
+    mXML = std::move(rhs.mXML);
+    mPrefix = std::move(rhs.mPrefix);
+  }
+
+  return *this;
+}
+
+
+/*
+ * Destructor for SedLazyMath
+ */
+SedLazyMath::~SedLazyMath()
+{
+  delete mAST.load();
+}
+
+
+/*
+ * Returns the math, keeping the retained XML
+ */
+const ASTNode*
+SedLazyMath::get(XMLErrorLog* log) const
+{
+  parse(log);
+  return mAST;
+}
+
+
+/*
+ * Returns the math, discarding the retained XML
+ */
+ASTNode*
+SedLazyMath::get(XMLErrorLog* log)
+{
+  parse(log);
+
+  // invalid math is still written back as it was read
+  if (mAST != NULL)
+  {
+    mXML.reset();
+  }
+
+  return mAST;
+}
+
+
+/*
+ * Returns true if there is math
+ */
+bool
+SedLazyMath::isSet() const
+{
+  return mAST != NULL || (mXML != NULL && !mInvalid);
+}
+
+
+/*
+ * Returns true if the given math is the one held by this object
+ */
+bool
+SedLazyMath::owns(const ASTNode* math) const
+{
+  return math != NULL && math == mAST;
+}
+
+
+/*
+ * Replaces the math
+ */
+void
+SedLazyMath::set(ASTNode* math)
+{
+  if (math != mAST)
+  {
+    delete mAST.load();
+    mAST = math;
+  }
+
+  mInvalid = false;
+  mXML.reset();
+}
+
+
+/*
+ * Retains the math element at the current position of the stream
+ */
+void
+SedLazyMath::read(XMLInputStream& stream, const std::string& prefix)
+{
+  XMLNode* math = new XMLNode(stream);
+
+  // the MathML namespace may have been declared on an ancestor; declare it
+  // on the element itself so that it can be parsed on its own
+  if (!math->getNamespaces().hasURI(MATHML_URI))
+  {
+    math->addNamespace(MATHML_URI, prefix);
+  }
+
+  delete mAST.load();
+  mAST = NULL;
+  mInvalid = false;
+  mXML.reset(math);
+  mPrefix = prefix;
+}
+
+
+/*
+ * Writes the math to the stream
+ */
+void
+SedLazyMath::write(XMLOutputStream& stream) const
+{
+  if (mXML != NULL)
+  {
+    stream << *mXML;
+  }
+  else if (mAST != NULL)
+  {
+    writeMathML(mAST, stream, NULL);
+  }
+}
+
+
+/*
+ * Serializes parsing, so that math shared between threads is parsed (and
+ * its errors are logged) only once.
+ */
+static std::mutex&
+parseMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+
+/*
+ * Parses the retained XML, if not done already
+ */
+void
+SedLazyMath::parse(XMLErrorLog* log) const
+{
+  if (mAST.load(std::memory_order_acquire) != NULL || mXML == NULL ||
+      mInvalid)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(parseMutex());
+
+  // another thread may have parsed the math while this one waited
+  if (mAST.load(std::memory_order_relaxed) != NULL || mInvalid)
+  {
+    return;
+  }
+
+  const std::string xml = mXML->toXMLString();
+  XMLInputStream stream(xml.c_str(), false, "", log);
+  ASTNode* math = readMathML(stream, mPrefix);
+  mInvalid = (math == NULL);
+  mAST.store(math, std::memory_order_release);
+}
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
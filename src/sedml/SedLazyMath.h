@@ -0,0 +1,188 @@
+/**
+ * @file SedLazyMath.h
+ * @brief Definition of the SedLazyMath class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedLazyMath
+ * @sbmlbrief{} Holds the "math" element of a SED-ML object, parsing it on
+ * first use.
+ *
+ * MathML read from a document is kept as XML, shared between copies, and
+ * only turned into an ASTNode when the math is asked for.  As long as the
+ * math is not modified, it is written back out from the retained XML.
+ */
+
+
+#ifndef SedLazyMath_H__
+#define SedLazyMath_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+#include <sbml/common/libsbml-namespace.h>
+#include <sbml/math/ASTNode.h>
+#include <sbml/xml/XMLNode.h>
+#include <sbml/xml/XMLErrorLog.h>
+
+
+#ifdef __cplusplus
+
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+class LIBSEDML_EXTERN SedLazyMath
+{
+public:
+
+  /**
+   * Creates a new SedLazyMath holding no math.
+   */
+  SedLazyMath();
+
+
+  /**
+   * Copy constructor; the retained XML is shared, a parsed ASTNode is only
+   * copied if there is no XML to parse it from again.
+   */
+  SedLazyMath(const SedLazyMath& orig);
+
+
+  /**
+   * Assignment operator for SedLazyMath.
+   */
+  SedLazyMath& operator=(const SedLazyMath& rhs);
+
+
+  /**
+   * Move constructor; takes over the math of @p orig, leaving it empty.
+   */
+  SedLazyMath(SedLazyMath&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedLazyMath.
+   */
+  SedLazyMath& operator=(SedLazyMath&& rhs) noexcept;
+
+
+  /**
+   * Destructor for SedLazyMath.
+   */
+  ~SedLazyMath();
+
+
+  /**
+   * Returns the math, parsing the retained XML if necessary, or @c NULL if
+   * there is none or it is not valid MathML; the retained XML is kept for
+   * writing.  Errors found while parsing are logged to @p log, if given.
+   * Concurrent calls are safe as long as the math is not modified.
+   */
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
+  get(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLErrorLog* log = NULL) const;
+
+
+  /**
+   * Returns the math, parsing the retained XML if necessary, or @c NULL if
+   * there is none or it is not valid MathML; as the caller may modify the
+   * math, the retained XML is discarded once it has been parsed.  Errors
+   * found while parsing are logged to @p log, if given.
+   */
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
+  get(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLErrorLog* log = NULL);
+
+
+  /**
+   * Returns @c true if there is math, parsed or not.  Retained XML is only
+   * found to be invalid when it is parsed, so get() may still return
+   * @c NULL if this returns @c true; after a failed parse this returns
+   * @c false.
+   */
+  bool isSet() const;
+
+
+  /**
+   * Returns @c true if @p math is the (parsed) math held by this object.
+   */
+  bool owns(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math) const;
+
+
+  /**
+   * Replaces the math with @p math, taking ownership of it; @c NULL unsets
+   * the math.
+   */
+  void set(LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math);
+
+
+  /**
+   * Retains the "math" element at the current position of @p stream, whose
+   * MathML namespace uses @p prefix, without parsing it.
+   */
+  void read(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream,
+            const std::string& prefix);
+
+
+  /**
+   * Writes the math to @p stream, from the retained XML if there is any.
+   */
+  void write(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream& stream) const;
+
+private:
+
+  void parse(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLErrorLog* log) const;
+
+  // set by the const get(), which may be called from several threads on
+  // math shared by copy-on-write clones of a document
+  mutable std::atomic<LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*> mAST;
+  mutable std::atomic<bool> mInvalid;
+  std::shared_ptr<const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLNode> mXML;
+  std::string mPrefix;
+};
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedLazyMath_H__ */
+
+
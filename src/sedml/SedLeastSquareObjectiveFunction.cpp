@@ -58,7 +58,6 @@ SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(
                                                                    version)
   : SedObjective(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -100,6 +99,30 @@ SedLeastSquareObjectiveFunction::operator=(const
 }
 
 
+/*
+ * Move constructor for SedLeastSquareObjectiveFunction.
+ */
+SedLeastSquareObjectiveFunction::SedLeastSquareObjectiveFunction(SedLeastSquareObjectiveFunction&& orig) noexcept
+  : SedObjective( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedLeastSquareObjectiveFunction.
+ */
+SedLeastSquareObjectiveFunction&
+SedLeastSquareObjectiveFunction::operator=(SedLeastSquareObjectiveFunction&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedObjective::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedLeastSquareObjectiveFunction
  * object.
@@ -109,6 +109,27 @@ public:
     SedLeastSquareObjectiveFunction& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedLeastSquareObjectiveFunction.
+   *
+   * @param orig the SedLeastSquareObjectiveFunction instance to move from; it is left empty.
+   */
+  SedLeastSquareObjectiveFunction(SedLeastSquareObjectiveFunction&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedLeastSquareObjectiveFunction.
+   *
+   * @param rhs the SedLeastSquareObjectiveFunction object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedLeastSquareObjectiveFunction& operator=(SedLeastSquareObjectiveFunction&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedLeastSquareObjectiveFunction
    * object.
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedLine.h>
+#include <sedml/SedStyle.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -57,7 +58,6 @@ SedLine::SedLine(unsigned int level, unsigned int version)
   , mThickness (util_NaN())
   , mIsSetThickness (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -107,6 +107,38 @@ SedLine::operator=(const SedLine& rhs)
 }
 
 
+/*
+ * Move constructor for SedLine.
+ */
+SedLine::SedLine(SedLine&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mType ( std::move(orig.mType) )
+  , mColor ( std::move(orig.mColor) )
+  , mThickness ( std::move(orig.mThickness) )
+  , mIsSetThickness ( std::move(orig.mIsSetThickness) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedLine.
+ */
+SedLine&
+SedLine::operator=(SedLine&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mType = std::move(rhs.mType);
+    mColor = std::move(rhs.mColor);
+    mThickness = std::move(rhs.mThickness);
+    mIsSetThickness = std::move(rhs.mIsSetThickness);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedLine object.
  */
@@ -202,6 +234,8 @@ SedLine::isSetThickness() const
 int
 SedLine::setType(const LineType_t type)
 {
+  styleChanged();
+
   if (LineType_isValid(type) == 0)
   {
     mType = SEDML_LINETYPE_INVALID;
@@ -221,6 +255,8 @@ SedLine::setType(const LineType_t type)
 int
 SedLine::setType(const std::string& type)
 {
+  styleChanged();
+
   mType = LineType_fromString(type.c_str());
 
   if (mType == SEDML_LINETYPE_INVALID)
@@ -238,6 +274,8 @@ SedLine::setType(const std::string& type)
 int
 SedLine::setColor(const std::string& color)
 {
+  styleChanged();
+
   mColor = color;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -249,6 +287,8 @@ SedLine::setColor(const std::string& color)
 int
 SedLine::setThickness(double thickness)
 {
+  styleChanged();
+
   mThickness = thickness;
   mIsSetThickness = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -261,6 +301,8 @@ SedLine::setThickness(double thickness)
 int
 SedLine::unsetType()
 {
+  styleChanged();
+
   mType = SEDML_LINETYPE_INVALID;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -272,6 +314,8 @@ SedLine::unsetType()
 int
 SedLine::unsetColor()
 {
+  styleChanged();
+
   mColor.erase();
 
   if (mColor.empty() == true)
@@ -291,6 +335,8 @@ SedLine::unsetColor()
 int
 SedLine::unsetThickness()
 {
+  styleChanged();
+
   mThickness = util_NaN();
   mIsSetThickness = false;
 
@@ -823,6 +869,26 @@ SedLine::writeAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Tells the parent SedStyle, if any, that this SedLine changes
+ */
+void
+SedLine::styleChanged()
+{
+  SedBase* parent = getParentSedObject();
+
+  if (parent != NULL && parent->getTypeCode() == SEDML_STYLE)
+  {
+    static_cast<SedStyle*>(parent)->styleChanged();
+  }
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
@@ -147,6 +147,27 @@ public:
   SedLine& operator=(const SedLine& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedLine.
+   *
+   * @param orig the SedLine instance to move from; it is left empty.
+   */
+  SedLine(SedLine&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedLine.
+   *
+   * @param rhs the SedLine object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedLine& operator=(SedLine&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedLine object.
    *
@@ -685,6 +706,17 @@ protected:
   /** @endcond */
 
 
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Tells the parent SedStyle, if any, that this SedLine changes
+   */
+  void styleChanged();
+
+  /** @endcond */
+
+
 };
 
 
@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <mutex>
 
 #include <sedml/SedVisitor.h>
 #include <sedml/SedListOf.h>
@@ -54,6 +55,9 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  */
 SedListOf::SedListOf (unsigned int level, unsigned int version)
 : SedBase(level,version)
+  , mItemPositions()
+  , mItemPositionsValid(false)
+  , mItemPositionsHaveDuplicates(false)
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SedConstructorException();
@@ -65,6 +69,9 @@ SedListOf::SedListOf (unsigned int level, unsigned int version)
  */
 SedListOf::SedListOf (SedNamespaces* sedmlns)
 : SedBase(sedmlns)
+  , mItemPositions()
+  , mItemPositionsValid(false)
+  , mItemPositionsHaveDuplicates(false)
 {
     if (!hasValidLevelVersionNamespaceCombination())
     throw SedConstructorException();
@@ -102,6 +109,9 @@ struct Clone
  * Copy constructor. Creates a copy of this SedListOf items.
  */
 SedListOf::SedListOf (const SedListOf& orig) : SedBase(orig), mItems()
+  , mItemPositions()
+  , mItemPositionsValid(false)
+  , mItemPositionsHaveDuplicates(false)
 {
   mItems.resize( orig.size() );
   transform( orig.mItems.begin(), orig.mItems.end(), mItems.begin(), Clone() );
@@ -121,6 +131,43 @@ SedListOf& SedListOf::operator=(const SedListOf& rhs)
     for_each( mItems.begin(), mItems.end(), Delete() );
     mItems.resize( rhs.size() );
     transform( rhs.mItems.begin(), rhs.mItems.end(), mItems.begin(), Clone() );
+    invalidateItemPositions();
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move constructor
+ */
+SedListOf::SedListOf (SedListOf&& orig) noexcept : SedBase(std::move(orig))
+  , mItems(std::move(orig.mItems))
+  , mItemPositions()
+  , mItemPositionsValid(false)
+  , mItemPositionsHaveDuplicates(false)
+{
+  orig.mItems.clear();
+  orig.invalidateItemPositions();
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator
+ */
+SedListOf& SedListOf::operator=(SedListOf&& rhs) noexcept
+{
+  if(&rhs!=this)
+  {
+    this->SedBase::operator =(std::move(rhs));
+    // Deletes existing items
+    for_each( mItems.begin(), mItems.end(), Delete() );
+    mItems = std::move(rhs.mItems);
+    rhs.mItems.clear();
+    rhs.invalidateItemPositions();
+    invalidateItemPositions();
     connectToChild();
   }
 
@@ -172,6 +219,7 @@ SedListOf::insertAndOwn(int location, SedBase* item)
   if (this->getItemTypeCode() == SEDML_UNKNOWN )
   {
     mItems.insert( mItems.begin() + location, item );
+    itemInserted((unsigned int)location);
     item->connectToParent(this);
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -182,6 +230,7 @@ SedListOf::insertAndOwn(int location, SedBase* item)
   else
   {
     mItems.insert( mItems.begin() + location, item );
+    itemInserted((unsigned int)location);
     item->connectToParent(this);
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -216,6 +265,7 @@ SedListOf::appendAndOwn (SedBase* item)
   if (this->getItemTypeCode() == SEDML_UNKNOWN )
   {
     mItems.push_back( item );
+    itemInserted((unsigned int)mItems.size() - 1);
     item->connectToParent(this);
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -226,6 +276,7 @@ SedListOf::appendAndOwn (SedBase* item)
   else
   {
     mItems.push_back( item );
+    itemInserted((unsigned int)mItems.size() - 1);
     item->connectToParent(this);
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -334,6 +385,35 @@ SedListOf::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Calls visit on each item of this SedListOf
+ */
+void
+SedListOf::visitChildren(ChildVisitor visit, void* data)
+{
+  for (unsigned int i = 0; i < mItems.size(); i++)
+  {
+    visit(mItems[i], data);
+  }
+}
+/** @endcond */
+
+
+/**
+ * Used by SedListOf::clear() to detach items from
+ * the SId index of their SedDocument and from this list.
+ */
+struct RemoveFromSIdIndex
+{
+  void operator() (SedBase* sb)
+  {
+    sb->removeFromSIdIndex();
+    sb->connectToParent(NULL);
+  }
+};
+
+
 /*
  * Removes all items in this SedListOf object.
  *
@@ -348,8 +428,11 @@ SedListOf::clear (bool doDelete)
 {
   if (doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
+  else
+    for_each( mItems.begin(), mItems.end(), RemoveFromSIdIndex() );
   
   mItems.clear();
+  invalidateItemPositions();
 }
 
 
@@ -372,7 +455,13 @@ SedListOf::remove (unsigned int n)
 {
   SedBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    mItems.erase( mItems.begin() + n );
+    itemRemoved(item, n);
+    item->removeFromSIdIndex();
+    item->connectToParent(NULL);
+  }
   
   return item;
 }
@@ -435,6 +524,221 @@ SedListOf::connectToChild()
   for_each( mItems.begin(), mItems.end(), SetParentSedObject(this) );
 }
 
+
+/*
+ * Lists with at most this many items are searched linearly, building and
+ * maintaining the id table does not pay off for them.
+ */
+static const unsigned int ITEM_POSITION_MIN_SIZE = 8;
+
+
+/*
+ * Returns the position of the first item with the given id, or size()
+ * if there is no such item.
+ */
+unsigned int
+SedListOf::findItemPosition (const std::string& sid) const
+{
+  const unsigned int numItems = (unsigned int)mItems.size();
+
+  if (sid.empty() || numItems <= ITEM_POSITION_MIN_SIZE)
+  {
+    for (unsigned int n = 0; n < numItems; ++n)
+    {
+      if (mItems[n]->getId() == sid)
+      {
+        return n;
+      }
+    }
+    return numItems;
+  }
+
+  if (!mItemPositionsValid.load(std::memory_order_acquire))
+  {
+    buildItemPositions();
+  }
+
+  ItemPositionMap::const_iterator it = mItemPositions.find(sid);
+  return (it != mItemPositions.end()) ? it->second : numItems;
+}
+
+
+/*
+ * Discards the id table, it will be rebuilt on the next lookup.
+ */
+void
+SedListOf::invalidateItemPositions ()
+{
+  mItemPositions.clear();
+  mItemPositionsValid = false;
+  mItemPositionsHaveDuplicates = false;
+}
+
+
+/*
+ * Serializes building the id tables, which const lookups do on lists that
+ * may be shared between threads.  Tables are built rarely, so a single
+ * lock for all lists is enough.
+ */
+static std::mutex&
+itemPositionsMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+
+/*
+ * Maps the id of every item to the position of its first occurrence.
+ */
+void
+SedListOf::buildItemPositions () const
+{
+  std::lock_guard<std::mutex> lock(itemPositionsMutex());
+
+  // another thread may have built the table while this one waited
+  if (mItemPositionsValid.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  mItemPositions.clear();
+  mItemPositions.reserve(mItems.size());
+  mItemPositionsHaveDuplicates = false;
+
+  for (unsigned int n = 0; n < mItems.size(); ++n)
+  {
+    const std::string& id = mItems[n]->getId();
+    if (id.empty()) continue;
+
+    if (!mItemPositions.insert(std::make_pair(id, n)).second)
+    {
+      mItemPositionsHaveDuplicates = true;
+    }
+  }
+
+  mItemPositionsValid.store(true, std::memory_order_release);
+}
+
+
+/*
+ * Updates the id table after an item was inserted at the given location.
+ */
+void
+SedListOf::itemInserted (unsigned int location)
+{
+  if (!mItemPositionsValid) return;
+
+  if (location + 1 < mItems.size())
+  {
+    for (ItemPositionMap::iterator it = mItemPositions.begin();
+         it != mItemPositions.end(); ++it)
+    {
+      if (it->second >= location) ++it->second;
+    }
+  }
+
+  const std::string& id = mItems[location]->getId();
+  if (id.empty()) return;
+
+  std::pair<ItemPositionMap::iterator, bool> result =
+    mItemPositions.insert(std::make_pair(id, location));
+
+  if (!result.second)
+  {
+    mItemPositionsHaveDuplicates = true;
+    if (location < result.first->second)
+    {
+      result.first->second = location;
+    }
+  }
+}
+
+
+/*
+ * Updates the id table after the given item was removed from the given
+ * location.
+ */
+void
+SedListOf::itemRemoved (SedBase* item, unsigned int location)
+{
+  if (!mItemPositionsValid) return;
+
+  // the next occurrence of a duplicated id would have to be searched for
+  if (mItemPositionsHaveDuplicates)
+  {
+    invalidateItemPositions();
+    return;
+  }
+
+  ItemPositionMap::iterator found = mItemPositions.find(item->getId());
+  if (found != mItemPositions.end() && found->second == location)
+  {
+    mItemPositions.erase(found);
+  }
+
+  if (location < mItems.size())
+  {
+    for (ItemPositionMap::iterator it = mItemPositions.begin();
+         it != mItemPositions.end(); ++it)
+    {
+      if (it->second > location) --it->second;
+    }
+  }
+}
+
+
+/*
+ * Updates the id table after the id of one of the items changed.
+ */
+void
+SedListOf::updateItemId (SedBase* item, const std::string& oldId)
+{
+  if (!mItemPositionsValid) return;
+
+  if (mItemPositionsHaveDuplicates)
+  {
+    invalidateItemPositions();
+    return;
+  }
+
+  // locate the item, it may not (or no longer) be a member of this list
+  unsigned int location = (unsigned int)mItems.size();
+
+  ItemPositionMap::iterator found = mItemPositions.find(oldId);
+  if (found != mItemPositions.end() && mItems[found->second] == item)
+  {
+    location = found->second;
+    mItemPositions.erase(found);
+  }
+  else if (!mItems.empty() && mItems.back() == item)
+  {
+    // the usual case of an item that was just created and is named now
+    location = (unsigned int)mItems.size() - 1;
+  }
+  else
+  {
+    ListItem::const_iterator pos = find(mItems.begin(), mItems.end(), item);
+    if (pos == mItems.end()) return;
+    location = (unsigned int)(pos - mItems.begin());
+  }
+
+  const std::string& id = item->getId();
+  if (id.empty()) return;
+
+  std::pair<ItemPositionMap::iterator, bool> result =
+    mItemPositions.insert(std::make_pair(id, location));
+
+  if (!result.second)
+  {
+    mItemPositionsHaveDuplicates = true;
+    if (location < result.first->second)
+    {
+      result.first->second = location;
+    }
+  }
+}
+
 /** @endcond */
 
 
@@ -48,9 +48,12 @@
 #ifdef __cplusplus
 
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <unordered_map>
 
 #include <sedml/SedBase.h>
 
@@ -123,6 +126,26 @@ public:
   SedListOf& operator=(const SedListOf& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor; takes over the items of another SedListOf, which is
+   * left empty.
+   *
+   * @param orig the SedListOf instance to move from.
+   */
+  SedListOf (SedListOf&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOf; the items of this list are
+   * deleted and replaced by those of @p rhs, which is left empty.
+   */
+  SedListOf& operator=(SedListOf&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
 
   /** @cond doxygenLibsedmlInternal */
   /**
@@ -186,6 +209,36 @@ public:
   int appendAndOwn (SedBase* disownedItem);
 
 
+#ifndef SWIG
+
+  /**
+   * Adds an item to the end of this SedListOf's list of items, taking
+   * ownership of it from a @c std::unique_ptr.
+   *
+   * Like appendAndOwn(SedBase* disownedItem), this does not copy the item;
+   * the pointer is only released if the item was added, so on failure it
+   * stays with the caller.
+   *
+   * @param item the item to be added to the list.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   */
+  template <class T>
+  int appendAndOwn (std::unique_ptr<T>&& item)
+  {
+    int result = appendAndOwn(static_cast<SedBase*>(item.get()));
+    if (result == LIBSEDML_OPERATION_SUCCESS)
+    {
+      item.release();
+    }
+    return result;
+  }
+
+#endif /* !SWIG */
+
+
   /**
    * Adds a clone of a list of items to this SedListOf's list.
    *
@@ -303,6 +356,14 @@ public:
   virtual List* getAllElements(SedElementFilter* filter = NULL);
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Calls @p visit on each item of this SedListOf.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+  /** @endcond */
+
+
   /**
    * Removes all items in this SedListOf object.
    *
@@ -389,6 +450,18 @@ public:
   /** @endcond */
 
 
+  /** @cond doxygenLibsedmlInternal */
+  /**
+   * Updates the id lookup table of this SedListOf after the id of one of
+   * its items changed from @p oldId.
+   *
+   * @param item the item whose id changed.
+   * @param oldId the previous value of the "id" attribute of @p item.
+   */
+  void updateItemId (SedBase* item, const std::string& oldId);
+  /** @endcond */
+
+
   /**
    * Returns the libSEDML type code for this object, namely,
    * @sedmlconstant{SEDML_LIST_OF, SedTypeCode_t}.
@@ -480,8 +553,47 @@ protected:
 
   virtual bool isValidTypeForList(SedBase * item);
 
+
+  /**
+   * Returns the position of the first item with the given @p sid, or size()
+   * if there is no such item.
+   *
+   * Lists with more than a handful of items answer this from an id to
+   * position table that is built on first use and kept up to date as items
+   * are inserted, removed or renamed.  Concurrent calls are safe, e.g. on a
+   * list shared by several copy-on-write clones of a document, as long as
+   * the list itself is not modified.
+   */
+  unsigned int findItemPosition (const std::string& sid) const;
+
+
+  /**
+   * Discards the id lookup table, it is rebuilt on the next call to
+   * findItemPosition().  Subclasses need to call this whenever they reorder
+   * mItems directly.
+   */
+  void invalidateItemPositions ();
+
+  // SedBase discards the table when an item is renamed by a move
+  friend class SedBase;
+
+
   ListItem mItems;
 
+  typedef std::unordered_map<std::string, unsigned int> ItemPositionMap;
+
+  mutable ItemPositionMap mItemPositions;
+  mutable std::atomic<bool> mItemPositionsValid;
+  mutable bool            mItemPositionsHaveDuplicates;
+
+private:
+
+  void buildItemPositions () const;
+
+  void itemInserted (unsigned int location);
+
+  void itemRemoved (SedBase* item, unsigned int location);
+
   /** @endcond */
 };
 
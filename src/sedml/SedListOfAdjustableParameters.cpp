@@ -58,7 +58,6 @@ SedListOfAdjustableParameters::SedListOfAdjustableParameters(
                                                                version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -100,6 +99,30 @@ SedListOfAdjustableParameters::operator=(const SedListOfAdjustableParameters&
 }
 
 
+/*
+ * Move constructor for SedListOfAdjustableParameters.
+ */
+SedListOfAdjustableParameters::SedListOfAdjustableParameters(SedListOfAdjustableParameters&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfAdjustableParameters.
+ */
+SedListOfAdjustableParameters&
+SedListOfAdjustableParameters::operator=(SedListOfAdjustableParameters&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfAdjustableParameters
  * object.
@@ -158,11 +181,8 @@ SedListOfAdjustableParameters::get(const std::string& sid)
 const SedAdjustableParameter*
 SedListOfAdjustableParameters::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAdjustableParameter>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const
-    SedAdjustableParameter*> (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedAdjustableParameter*>(SedListOf::get(n));
 }
 
 
@@ -184,19 +204,8 @@ SedListOfAdjustableParameters::remove(unsigned int n)
 SedAdjustableParameter*
 SedListOfAdjustableParameters::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAdjustableParameter>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAdjustableParameter*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedAdjustableParameter*>(SedListOf::remove(n));
 }
 
 
@@ -109,6 +109,27 @@ public:
     rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfAdjustableParameters.
+   *
+   * @param orig the SedListOfAdjustableParameters instance to move from; it is left empty.
+   */
+  SedListOfAdjustableParameters(SedListOfAdjustableParameters&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfAdjustableParameters.
+   *
+   * @param rhs the SedListOfAdjustableParameters object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfAdjustableParameters& operator=(SedListOfAdjustableParameters&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfAdjustableParameters
    * object.
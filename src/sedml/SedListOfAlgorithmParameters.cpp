@@ -56,7 +56,6 @@ SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(unsigned int level,
                                                              version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -98,6 +97,30 @@ SedListOfAlgorithmParameters::operator=(const SedListOfAlgorithmParameters&
 }
 
 
+/*
+ * Move constructor for SedListOfAlgorithmParameters.
+ */
+SedListOfAlgorithmParameters::SedListOfAlgorithmParameters(SedListOfAlgorithmParameters&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfAlgorithmParameters.
+ */
+SedListOfAlgorithmParameters&
+SedListOfAlgorithmParameters::operator=(SedListOfAlgorithmParameters&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfAlgorithmParameters object.
  */
@@ -155,11 +178,8 @@ SedListOfAlgorithmParameters::get(const std::string& sid)
 const SedAlgorithmParameter*
 SedListOfAlgorithmParameters::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAlgorithmParameter>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const
-    SedAlgorithmParameter*> (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedAlgorithmParameter*>(SedListOf::get(n));
 }
 
 
@@ -181,19 +201,8 @@ SedListOfAlgorithmParameters::remove(unsigned int n)
 SedAlgorithmParameter*
 SedListOfAlgorithmParameters::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAlgorithmParameter>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAlgorithmParameter*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedAlgorithmParameter*>(SedListOf::remove(n));
 }
 
 
@@ -108,6 +108,27 @@ public:
     rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfAlgorithmParameters.
+   *
+   * @param orig the SedListOfAlgorithmParameters instance to move from; it is left empty.
+   */
+  SedListOfAlgorithmParameters(SedListOfAlgorithmParameters&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfAlgorithmParameters.
+   *
+   * @param rhs the SedListOfAlgorithmParameters object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfAlgorithmParameters& operator=(SedListOfAlgorithmParameters&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfAlgorithmParameters
    * object.
@@ -56,7 +56,6 @@ SedListOfAppliedDimensions::SedListOfAppliedDimensions(unsigned int level,
                                                              version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -98,6 +97,30 @@ SedListOfAppliedDimensions::operator=(const SedListOfAppliedDimensions&
 }
 
 
+/*
+ * Move constructor for SedListOfAppliedDimensions.
+ */
+SedListOfAppliedDimensions::SedListOfAppliedDimensions(SedListOfAppliedDimensions&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfAppliedDimensions.
+ */
+SedListOfAppliedDimensions&
+SedListOfAppliedDimensions::operator=(SedListOfAppliedDimensions&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfAppliedDimensions object.
  */
@@ -155,11 +178,8 @@ SedListOfAppliedDimensions::get(const std::string& sid)
 const SedAppliedDimension*
 SedListOfAppliedDimensions::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAppliedDimension>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const
-    SedAppliedDimension*> (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedAppliedDimension*>(SedListOf::get(n));
 }
 
 
@@ -181,19 +201,8 @@ SedListOfAppliedDimensions::remove(unsigned int n)
 SedAppliedDimension*
 SedListOfAppliedDimensions::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAppliedDimension>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAppliedDimension*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedAppliedDimension*>(SedListOf::remove(n));
 }
 
 
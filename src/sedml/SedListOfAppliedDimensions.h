@@ -108,6 +108,27 @@ public:
     rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfAppliedDimensions.
+   *
+   * @param orig the SedListOfAppliedDimensions instance to move from; it is left empty.
+   */
+  SedListOfAppliedDimensions(SedListOfAppliedDimensions&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfAppliedDimensions.
+   *
+   * @param rhs the SedListOfAppliedDimensions object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfAppliedDimensions& operator=(SedListOfAppliedDimensions&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfAppliedDimensions
    * object.
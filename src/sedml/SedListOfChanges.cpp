@@ -60,7 +60,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfChanges::SedListOfChanges(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -99,6 +98,30 @@ SedListOfChanges::operator=(const SedListOfChanges& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfChanges.
+ */
+SedListOfChanges::SedListOfChanges(SedListOfChanges&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfChanges.
+ */
+SedListOfChanges&
+SedListOfChanges::operator=(SedListOfChanges&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfChanges object.
  */
@@ -154,10 +177,8 @@ SedListOfChanges::get(const std::string& sid)
 const SedChange*
 SedListOfChanges::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedChange>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedChange*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedChange*>(SedListOf::get(n));
 }
 
 
@@ -179,18 +200,8 @@ SedListOfChanges::remove(unsigned int n)
 SedChange*
 SedListOfChanges::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedChange>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedChange*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedChange*>(SedListOf::remove(n));
 }
 
 
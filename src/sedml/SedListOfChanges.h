@@ -113,6 +113,27 @@ public:
   SedListOfChanges& operator=(const SedListOfChanges& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfChanges.
+   *
+   * @param orig the SedListOfChanges instance to move from; it is left empty.
+   */
+  SedListOfChanges(SedListOfChanges&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfChanges.
+   *
+   * @param rhs the SedListOfChanges object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfChanges& operator=(SedListOfChanges&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfChanges object.
    *
@@ -57,7 +57,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfCurves::SedListOfCurves(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -96,6 +95,30 @@ SedListOfCurves::operator=(const SedListOfCurves& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfCurves.
+ */
+SedListOfCurves::SedListOfCurves(SedListOfCurves&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfCurves.
+ */
+SedListOfCurves&
+SedListOfCurves::operator=(SedListOfCurves&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 struct AbstractCurvesOrderComparator
 {
     // Compare two SedSubTasks objects using the 'order' attribute.
@@ -119,6 +142,7 @@ struct AbstractCurvesOrderComparator
 void SedListOfCurves::sort()
 {
     std::sort(mItems.begin(), mItems.end(), AbstractCurvesOrderComparator());
+    invalidateItemPositions();
 }
 
 /*
@@ -176,11 +200,8 @@ SedListOfCurves::get(const std::string& sid)
 const SedAbstractCurve*
 SedListOfCurves::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractCurve>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedAbstractCurve*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedAbstractCurve*>(SedListOf::get(n));
 }
 
 
@@ -202,19 +223,8 @@ SedListOfCurves::remove(unsigned int n)
 SedAbstractCurve*
 SedListOfCurves::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractCurve>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAbstractCurve*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedAbstractCurve*>(SedListOf::remove(n));
 }
 
 
@@ -110,6 +110,27 @@ public:
   SedListOfCurves& operator=(const SedListOfCurves& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfCurves.
+   *
+   * @param orig the SedListOfCurves instance to move from; it is left empty.
+   */
+  SedListOfCurves(SedListOfCurves&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfCurves.
+   *
+   * @param rhs the SedListOfCurves object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfCurves& operator=(SedListOfCurves&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Sort the SedListOfCurves according to the 'order' attribute.
    *
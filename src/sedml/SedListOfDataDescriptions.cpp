@@ -55,7 +55,6 @@ SedListOfDataDescriptions::SedListOfDataDescriptions(unsigned int level,
                                                      unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -95,6 +94,30 @@ SedListOfDataDescriptions::operator=(const SedListOfDataDescriptions& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfDataDescriptions.
+ */
+SedListOfDataDescriptions::SedListOfDataDescriptions(SedListOfDataDescriptions&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfDataDescriptions.
+ */
+SedListOfDataDescriptions&
+SedListOfDataDescriptions::operator=(SedListOfDataDescriptions&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataDescriptions object.
  */
@@ -152,11 +175,8 @@ SedListOfDataDescriptions::get(const std::string& sid)
 const SedDataDescription*
 SedListOfDataDescriptions::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataDescription>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataDescription*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedDataDescription*>(SedListOf::get(n));
 }
 
 
@@ -178,19 +198,8 @@ SedListOfDataDescriptions::remove(unsigned int n)
 SedDataDescription*
 SedListOfDataDescriptions::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataDescription>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataDescription*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedDataDescription*>(SedListOf::remove(n));
 }
 
 
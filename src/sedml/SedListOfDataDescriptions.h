@@ -107,6 +107,27 @@ public:
   SedListOfDataDescriptions& operator=(const SedListOfDataDescriptions& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfDataDescriptions.
+   *
+   * @param orig the SedListOfDataDescriptions instance to move from; it is left empty.
+   */
+  SedListOfDataDescriptions(SedListOfDataDescriptions&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfDataDescriptions.
+   *
+   * @param rhs the SedListOfDataDescriptions object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfDataDescriptions& operator=(SedListOfDataDescriptions&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataDescriptions object.
    *
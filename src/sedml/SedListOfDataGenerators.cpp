@@ -56,7 +56,6 @@ SedListOfDataGenerators::SedListOfDataGenerators(unsigned int level,
                                                  unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -96,6 +95,30 @@ SedListOfDataGenerators::operator=(const SedListOfDataGenerators& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfDataGenerators.
+ */
+SedListOfDataGenerators::SedListOfDataGenerators(SedListOfDataGenerators&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfDataGenerators.
+ */
+SedListOfDataGenerators&
+SedListOfDataGenerators::operator=(SedListOfDataGenerators&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataGenerators object.
  */
@@ -153,11 +176,8 @@ SedListOfDataGenerators::get(const std::string& sid)
 const SedDataGenerator*
 SedListOfDataGenerators::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataGenerator>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataGenerator*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedDataGenerator*>(SedListOf::get(n));
 }
 
 
@@ -179,19 +199,8 @@ SedListOfDataGenerators::remove(unsigned int n)
 SedDataGenerator*
 SedListOfDataGenerators::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedDataGenerator>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataGenerator*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedDataGenerator*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfDataGenerators& operator=(const SedListOfDataGenerators& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfDataGenerators.
+   *
+   * @param orig the SedListOfDataGenerators instance to move from; it is left empty.
+   */
+  SedListOfDataGenerators(SedListOfDataGenerators&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfDataGenerators.
+   *
+   * @param rhs the SedListOfDataGenerators object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfDataGenerators& operator=(SedListOfDataGenerators&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataGenerators object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfDataSets::SedListOfDataSets(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfDataSets::operator=(const SedListOfDataSets& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfDataSets.
+ */
+SedListOfDataSets::SedListOfDataSets(SedListOfDataSets&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfDataSets.
+ */
+SedListOfDataSets&
+SedListOfDataSets::operator=(SedListOfDataSets&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataSets object.
  */
@@ -148,10 +171,8 @@ SedListOfDataSets::get(const std::string& sid)
 const SedDataSet*
 SedListOfDataSets::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSet>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataSet*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedDataSet*>(SedListOf::get(n));
 }
 
 
@@ -173,18 +194,8 @@ SedListOfDataSets::remove(unsigned int n)
 SedDataSet*
 SedListOfDataSets::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSet>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataSet*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedDataSet*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfDataSets& operator=(const SedListOfDataSets& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfDataSets.
+   *
+   * @param orig the SedListOfDataSets instance to move from; it is left empty.
+   */
+  SedListOfDataSets(SedListOfDataSets&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfDataSets.
+   *
+   * @param rhs the SedListOfDataSets object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfDataSets& operator=(SedListOfDataSets&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataSets object.
    *
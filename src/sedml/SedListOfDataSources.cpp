@@ -55,7 +55,6 @@ SedListOfDataSources::SedListOfDataSources(unsigned int level,
                                            unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -94,6 +93,30 @@ SedListOfDataSources::operator=(const SedListOfDataSources& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfDataSources.
+ */
+SedListOfDataSources::SedListOfDataSources(SedListOfDataSources&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfDataSources.
+ */
+SedListOfDataSources&
+SedListOfDataSources::operator=(SedListOfDataSources&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfDataSources object.
  */
@@ -149,10 +172,8 @@ SedListOfDataSources::get(const std::string& sid)
 const SedDataSource*
 SedListOfDataSources::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSource>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedDataSource*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedDataSource*>(SedListOf::get(n));
 }
 
 
@@ -174,18 +195,8 @@ SedListOfDataSources::remove(unsigned int n)
 SedDataSource*
 SedListOfDataSources::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedDataSource>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedDataSource*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedDataSource*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfDataSources& operator=(const SedListOfDataSources& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfDataSources.
+   *
+   * @param orig the SedListOfDataSources instance to move from; it is left empty.
+   */
+  SedListOfDataSources(SedListOfDataSources&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfDataSources.
+   *
+   * @param rhs the SedListOfDataSources object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfDataSources& operator=(SedListOfDataSources&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfDataSources object.
    *
@@ -55,7 +55,6 @@ SedListOfExperimentReferences::SedListOfExperimentReferences(unsigned int level,
                                                  unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -95,6 +94,30 @@ SedListOfExperimentReferences::operator=(const SedListOfExperimentReferences& rh
 }
 
 
+/*
+ * Move constructor for SedListOfExperimentReferences.
+ */
+SedListOfExperimentReferences::SedListOfExperimentReferences(SedListOfExperimentReferences&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfExperimentReferences.
+ */
+SedListOfExperimentReferences&
+SedListOfExperimentReferences::operator=(SedListOfExperimentReferences&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfExperimentReferences object.
  */
@@ -152,11 +175,8 @@ SedListOfExperimentReferences::get(const std::string& sid)
 const SedExperimentReference*
 SedListOfExperimentReferences::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedExperimentReference>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedExperimentReference*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedExperimentReference*>(SedListOf::get(n));
 }
 
 
@@ -178,19 +198,8 @@ SedListOfExperimentReferences::remove(unsigned int n)
 SedExperimentReference*
 SedListOfExperimentReferences::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedExperimentReference>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedExperimentReference*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedExperimentReference*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfExperimentReferences& operator=(const SedListOfExperimentReferences& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfExperimentReferences.
+   *
+   * @param orig the SedListOfExperimentReferences instance to move from; it is left empty.
+   */
+  SedListOfExperimentReferences(SedListOfExperimentReferences&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfExperimentReferences.
+   *
+   * @param rhs the SedListOfExperimentReferences object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfExperimentReferences& operator=(SedListOfExperimentReferences&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfExperimentReferences object.
    *
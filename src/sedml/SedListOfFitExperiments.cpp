@@ -55,7 +55,6 @@ SedListOfFitExperiments::SedListOfFitExperiments(unsigned int level,
                                                  unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -95,6 +94,30 @@ SedListOfFitExperiments::operator=(const SedListOfFitExperiments& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfFitExperiments.
+ */
+SedListOfFitExperiments::SedListOfFitExperiments(SedListOfFitExperiments&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfFitExperiments.
+ */
+SedListOfFitExperiments&
+SedListOfFitExperiments::operator=(SedListOfFitExperiments&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfFitExperiments object.
  */
@@ -152,11 +175,8 @@ SedListOfFitExperiments::get(const std::string& sid)
 const SedFitExperiment*
 SedListOfFitExperiments::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedFitExperiment>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedFitExperiment*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedFitExperiment*>(SedListOf::get(n));
 }
 
 
@@ -178,19 +198,8 @@ SedListOfFitExperiments::remove(unsigned int n)
 SedFitExperiment*
 SedListOfFitExperiments::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedFitExperiment>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedFitExperiment*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedFitExperiment*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfFitExperiments& operator=(const SedListOfFitExperiments& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfFitExperiments.
+   *
+   * @param orig the SedListOfFitExperiments instance to move from; it is left empty.
+   */
+  SedListOfFitExperiments(SedListOfFitExperiments&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfFitExperiments.
+   *
+   * @param rhs the SedListOfFitExperiments object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfFitExperiments& operator=(SedListOfFitExperiments&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfFitExperiments object.
    *
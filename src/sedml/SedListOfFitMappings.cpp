@@ -55,7 +55,6 @@ SedListOfFitMappings::SedListOfFitMappings(unsigned int level,
                                            unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -94,6 +93,30 @@ SedListOfFitMappings::operator=(const SedListOfFitMappings& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfFitMappings.
+ */
+SedListOfFitMappings::SedListOfFitMappings(SedListOfFitMappings&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfFitMappings.
+ */
+SedListOfFitMappings&
+SedListOfFitMappings::operator=(SedListOfFitMappings&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfFitMappings object.
  */
@@ -149,10 +172,8 @@ SedListOfFitMappings::get(const std::string& sid)
 const SedFitMapping*
 SedListOfFitMappings::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedFitMapping>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedFitMapping*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedFitMapping*>(SedListOf::get(n));
 }
 
 
@@ -174,18 +195,8 @@ SedListOfFitMappings::remove(unsigned int n)
 SedFitMapping*
 SedListOfFitMappings::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedFitMapping>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedFitMapping*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedFitMapping*>(SedListOf::remove(n));
 }
 
 
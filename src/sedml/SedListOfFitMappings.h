@@ -107,6 +107,27 @@ public:
   SedListOfFitMappings& operator=(const SedListOfFitMappings& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfFitMappings.
+   *
+   * @param orig the SedListOfFitMappings instance to move from; it is left empty.
+   */
+  SedListOfFitMappings(SedListOfFitMappings&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfFitMappings.
+   *
+   * @param rhs the SedListOfFitMappings object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfFitMappings& operator=(SedListOfFitMappings&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfFitMappings object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfModels::SedListOfModels(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfModels::operator=(const SedListOfModels& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfModels.
+ */
+SedListOfModels::SedListOfModels(SedListOfModels&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfModels.
+ */
+SedListOfModels&
+SedListOfModels::operator=(SedListOfModels&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfModels object.
  */
@@ -148,10 +171,8 @@ SedListOfModels::get(const std::string& sid)
 const SedModel*
 SedListOfModels::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedModel>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedModel*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedModel*>(SedListOf::get(n));
 }
 
 
@@ -173,18 +194,8 @@ SedListOfModels::remove(unsigned int n)
 SedModel*
 SedListOfModels::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedModel>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedModel*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedModel*>(SedListOf::remove(n));
 }
 
 
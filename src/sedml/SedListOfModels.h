@@ -107,6 +107,27 @@ public:
   SedListOfModels& operator=(const SedListOfModels& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfModels.
+   *
+   * @param orig the SedListOfModels instance to move from; it is left empty.
+   */
+  SedListOfModels(SedListOfModels&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfModels.
+   *
+   * @param rhs the SedListOfModels object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfModels& operator=(SedListOfModels&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfModels object.
    *
@@ -61,7 +61,6 @@ SedListOfOutputs::SedListOfOutputs(unsigned int level, unsigned int version)
   : SedListOf(level, version)
   , mElementName("listOfOutputs")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -103,6 +102,32 @@ SedListOfOutputs::operator=(const SedListOfOutputs& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfOutputs.
+ */
+SedListOfOutputs::SedListOfOutputs(SedListOfOutputs&& orig) noexcept
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfOutputs.
+ */
+SedListOfOutputs&
+SedListOfOutputs::operator=(SedListOfOutputs&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfOutputs object.
  */
@@ -158,10 +183,8 @@ SedListOfOutputs::get(const std::string& sid)
 const SedOutput*
 SedListOfOutputs::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedOutput>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedOutput*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedOutput*>(SedListOf::get(n));
 }
 
 
@@ -183,18 +206,8 @@ SedListOfOutputs::remove(unsigned int n)
 SedOutput*
 SedListOfOutputs::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedOutput>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedOutput*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedOutput*>(SedListOf::remove(n));
 }
 
 
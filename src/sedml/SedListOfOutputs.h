@@ -120,6 +120,27 @@ public:
   SedListOfOutputs& operator=(const SedListOfOutputs& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfOutputs.
+   *
+   * @param orig the SedListOfOutputs instance to move from; it is left empty.
+   */
+  SedListOfOutputs(SedListOfOutputs&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfOutputs.
+   *
+   * @param rhs the SedListOfOutputs object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfOutputs& operator=(SedListOfOutputs&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfOutputs object.
    *
@@ -55,7 +55,6 @@ SedListOfParameters::SedListOfParameters(unsigned int level,
                                          unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -94,6 +93,30 @@ SedListOfParameters::operator=(const SedListOfParameters& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfParameters.
+ */
+SedListOfParameters::SedListOfParameters(SedListOfParameters&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfParameters.
+ */
+SedListOfParameters&
+SedListOfParameters::operator=(SedListOfParameters&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfParameters object.
  */
@@ -149,10 +172,8 @@ SedListOfParameters::get(const std::string& sid)
 const SedParameter*
 SedListOfParameters::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedParameter>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedParameter*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedParameter*>(SedListOf::get(n));
 }
 
 
@@ -174,18 +195,8 @@ SedListOfParameters::remove(unsigned int n)
 SedParameter*
 SedListOfParameters::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedParameter>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedParameter*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedParameter*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfParameters& operator=(const SedListOfParameters& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfParameters.
+   *
+   * @param orig the SedListOfParameters instance to move from; it is left empty.
+   */
+  SedListOfParameters(SedListOfParameters&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfParameters.
+   *
+   * @param rhs the SedListOfParameters object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfParameters& operator=(SedListOfParameters&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfParameters object.
    *
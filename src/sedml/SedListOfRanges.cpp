@@ -60,7 +60,6 @@ SedListOfRanges::SedListOfRanges(unsigned int level, unsigned int version)
   : SedListOf(level, version)
   , mElementName("listOfRanges")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -102,6 +101,32 @@ SedListOfRanges::operator=(const SedListOfRanges& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfRanges.
+ */
+SedListOfRanges::SedListOfRanges(SedListOfRanges&& orig) noexcept
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfRanges.
+ */
+SedListOfRanges&
+SedListOfRanges::operator=(SedListOfRanges&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfRanges object.
  */
@@ -157,10 +182,8 @@ SedListOfRanges::get(const std::string& sid)
 const SedRange*
 SedListOfRanges::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedRange>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedRange*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedRange*>(SedListOf::get(n));
 }
 
 
@@ -182,18 +205,8 @@ SedListOfRanges::remove(unsigned int n)
 SedRange*
 SedListOfRanges::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedRange>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedRange*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedRange*>(SedListOf::remove(n));
 }
 
 
@@ -119,6 +119,27 @@ public:
   SedListOfRanges& operator=(const SedListOfRanges& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfRanges.
+   *
+   * @param orig the SedListOfRanges instance to move from; it is left empty.
+   */
+  SedListOfRanges(SedListOfRanges&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfRanges.
+   *
+   * @param rhs the SedListOfRanges object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfRanges& operator=(SedListOfRanges&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfRanges object.
    *
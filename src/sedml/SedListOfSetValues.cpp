@@ -56,7 +56,6 @@ SedListOfSetValues::SedListOfSetValues(unsigned int level,
                                        unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -95,6 +94,30 @@ SedListOfSetValues::operator=(const SedListOfSetValues& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfSetValues.
+ */
+SedListOfSetValues::SedListOfSetValues(SedListOfSetValues&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfSetValues.
+ */
+SedListOfSetValues&
+SedListOfSetValues::operator=(SedListOfSetValues&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSetValues object.
  */
@@ -150,10 +173,8 @@ SedListOfSetValues::get(const std::string& sid)
 const SedSetValue*
 SedListOfSetValues::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSetValue>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSetValue*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedSetValue*>(SedListOf::get(n));
 }
 
 
@@ -175,18 +196,8 @@ SedListOfSetValues::remove(unsigned int n)
 SedSetValue*
 SedListOfSetValues::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSetValue>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSetValue*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedSetValue*>(SedListOf::remove(n));
 }
 
 
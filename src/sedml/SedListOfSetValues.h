@@ -107,6 +107,27 @@ public:
   SedListOfSetValues& operator=(const SedListOfSetValues& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfSetValues.
+   *
+   * @param orig the SedListOfSetValues instance to move from; it is left empty.
+   */
+  SedListOfSetValues(SedListOfSetValues&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfSetValues.
+   *
+   * @param rhs the SedListOfSetValues object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfSetValues& operator=(SedListOfSetValues&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSetValues object.
    *
@@ -60,7 +60,6 @@ SedListOfSimulations::SedListOfSimulations(unsigned int level,
                                            unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -99,6 +98,30 @@ SedListOfSimulations::operator=(const SedListOfSimulations& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfSimulations.
+ */
+SedListOfSimulations::SedListOfSimulations(SedListOfSimulations&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfSimulations.
+ */
+SedListOfSimulations&
+SedListOfSimulations::operator=(SedListOfSimulations&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSimulations object.
  */
@@ -154,10 +177,8 @@ SedListOfSimulations::get(const std::string& sid)
 const SedSimulation*
 SedListOfSimulations::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSimulation>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSimulation*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedSimulation*>(SedListOf::get(n));
 }
 
 
@@ -179,18 +200,8 @@ SedListOfSimulations::remove(unsigned int n)
 SedSimulation*
 SedListOfSimulations::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSimulation>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSimulation*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedSimulation*>(SedListOf::remove(n));
 }
 
 
@@ -112,6 +112,27 @@ public:
   SedListOfSimulations& operator=(const SedListOfSimulations& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfSimulations.
+   *
+   * @param orig the SedListOfSimulations instance to move from; it is left empty.
+   */
+  SedListOfSimulations(SedListOfSimulations&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfSimulations.
+   *
+   * @param rhs the SedListOfSimulations object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfSimulations& operator=(SedListOfSimulations&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSimulations object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSlices::SedListOfSlices(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfSlices::operator=(const SedListOfSlices& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfSlices.
+ */
+SedListOfSlices::SedListOfSlices(SedListOfSlices&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfSlices.
+ */
+SedListOfSlices&
+SedListOfSlices::operator=(SedListOfSlices&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSlices object.
  */
@@ -148,10 +171,8 @@ SedListOfSlices::get(const std::string& sid)
 const SedSlice*
 SedListOfSlices::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSlice>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSlice*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedSlice*>(SedListOf::get(n));
 }
 
 
@@ -173,18 +194,8 @@ SedListOfSlices::remove(unsigned int n)
 SedSlice*
 SedListOfSlices::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSlice>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSlice*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedSlice*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfSlices& operator=(const SedListOfSlices& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfSlices.
+   *
+   * @param orig the SedListOfSlices instance to move from; it is left empty.
+   */
+  SedListOfSlices(SedListOfSlices&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfSlices.
+   *
+   * @param rhs the SedListOfSlices object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfSlices& operator=(SedListOfSlices&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSlices object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfStyles::SedListOfStyles(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfStyles::operator=(const SedListOfStyles& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfStyles.
+ */
+SedListOfStyles::SedListOfStyles(SedListOfStyles&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfStyles.
+ */
+SedListOfStyles&
+SedListOfStyles::operator=(SedListOfStyles&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfStyles object.
  */
@@ -148,10 +171,8 @@ SedListOfStyles::get(const std::string& sid)
 const SedStyle*
 SedListOfStyles::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedStyle>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedStyle*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedStyle*>(SedListOf::get(n));
 }
 
 
@@ -173,18 +194,8 @@ SedListOfStyles::remove(unsigned int n)
 SedStyle*
 SedListOfStyles::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedStyle>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedStyle*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedStyle*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfStyles& operator=(const SedListOfStyles& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfStyles.
+   *
+   * @param orig the SedListOfStyles instance to move from; it is left empty.
+   */
+  SedListOfStyles(SedListOfStyles&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfStyles.
+   *
+   * @param rhs the SedListOfStyles object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfStyles& operator=(SedListOfStyles&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfStyles object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSubPlots::SedListOfSubPlots(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfSubPlots::operator=(const SedListOfSubPlots& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfSubPlots.
+ */
+SedListOfSubPlots::SedListOfSubPlots(SedListOfSubPlots&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfSubPlots.
+ */
+SedListOfSubPlots&
+SedListOfSubPlots::operator=(SedListOfSubPlots&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSubPlots object.
  */
@@ -148,10 +171,8 @@ SedListOfSubPlots::get(const std::string& sid)
 const SedSubPlot*
 SedListOfSubPlots::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubPlot>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSubPlot*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedSubPlot*>(SedListOf::get(n));
 }
 
 
@@ -173,18 +194,8 @@ SedListOfSubPlots::remove(unsigned int n)
 SedSubPlot*
 SedListOfSubPlots::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubPlot>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSubPlot*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedSubPlot*>(SedListOf::remove(n));
 }
 
 
@@ -107,6 +107,27 @@ public:
   SedListOfSubPlots& operator=(const SedListOfSubPlots& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfSubPlots.
+   *
+   * @param orig the SedListOfSubPlots instance to move from; it is left empty.
+   */
+  SedListOfSubPlots(SedListOfSubPlots&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfSubPlots.
+   *
+   * @param rhs the SedListOfSubPlots object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfSubPlots& operator=(SedListOfSubPlots&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSubPlots object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSubTasks::SedListOfSubTasks(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfSubTasks::operator=(const SedListOfSubTasks& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfSubTasks.
+ */
+SedListOfSubTasks::SedListOfSubTasks(SedListOfSubTasks&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfSubTasks.
+ */
+SedListOfSubTasks&
+SedListOfSubTasks::operator=(SedListOfSubTasks&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfSubTasks object.
  */
@@ -134,6 +157,7 @@ struct SubTaskOrderComparator
 void SedListOfSubTasks::sort()
 {
     std::sort(mItems.begin(), mItems.end(), SubTaskOrderComparator());
+    invalidateItemPositions();
 }
 
 
@@ -175,10 +199,8 @@ SedListOfSubTasks::get(const std::string& sid)
 const SedSubTask*
 SedListOfSubTasks::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubTask>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSubTask*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedSubTask*>(SedListOf::get(n));
 }
 
 
@@ -200,18 +222,8 @@ SedListOfSubTasks::remove(unsigned int n)
 SedSubTask*
 SedListOfSubTasks::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSubTask>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSubTask*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedSubTask*>(SedListOf::remove(n));
 }
 
 
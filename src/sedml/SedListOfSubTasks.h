@@ -107,6 +107,27 @@ public:
   SedListOfSubTasks& operator=(const SedListOfSubTasks& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfSubTasks.
+   *
+   * @param orig the SedListOfSubTasks instance to move from; it is left empty.
+   */
+  SedListOfSubTasks(SedListOfSubTasks&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfSubTasks.
+   *
+   * @param rhs the SedListOfSubTasks object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfSubTasks& operator=(SedListOfSubTasks&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfSubTasks object.
    *
@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedListOfSurfaces::SedListOfSurfaces(unsigned int level, unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedListOfSurfaces::operator=(const SedListOfSurfaces& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfSurfaces.
+ */
+SedListOfSurfaces::SedListOfSurfaces(SedListOfSurfaces&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfSurfaces.
+ */
+SedListOfSurfaces&
+SedListOfSurfaces::operator=(SedListOfSurfaces&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 struct SurfaceOrderComparator
 {
     // Compare two SedSubTasks objects using the 'order' attribute.
@@ -116,6 +139,7 @@ struct SurfaceOrderComparator
 void SedListOfSurfaces::sort()
 {
     std::sort(mItems.begin(), mItems.end(), SurfaceOrderComparator());
+    invalidateItemPositions();
 }
 
 /*
@@ -173,10 +197,8 @@ SedListOfSurfaces::get(const std::string& sid)
 const SedSurface*
 SedListOfSurfaces::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSurface>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedSurface*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedSurface*>(SedListOf::get(n));
 }
 
 
@@ -198,18 +220,8 @@ SedListOfSurfaces::remove(unsigned int n)
 SedSurface*
 SedListOfSurfaces::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedSurface>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedSurface*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedSurface*>(SedListOf::remove(n));
 }
 
 
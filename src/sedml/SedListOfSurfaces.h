@@ -107,6 +107,27 @@ public:
   SedListOfSurfaces& operator=(const SedListOfSurfaces& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfSurfaces.
+   *
+   * @param orig the SedListOfSurfaces instance to move from; it is left empty.
+   */
+  SedListOfSurfaces(SedListOfSurfaces&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfSurfaces.
+   *
+   * @param rhs the SedListOfSurfaces object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfSurfaces& operator=(SedListOfSurfaces&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Sort the SedListOfCurves according to the 'order' attribute.
    *
@@ -59,7 +59,6 @@ SedListOfTasks::SedListOfTasks(unsigned int level, unsigned int version)
   : SedListOf(level, version)
   , mElementName("listOfTasks")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -101,6 +100,32 @@ SedListOfTasks::operator=(const SedListOfTasks& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfTasks.
+ */
+SedListOfTasks::SedListOfTasks(SedListOfTasks&& orig) noexcept
+  : SedListOf( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfTasks.
+ */
+SedListOfTasks&
+SedListOfTasks::operator=(SedListOfTasks&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfTasks object.
  */
@@ -156,11 +181,8 @@ SedListOfTasks::get(const std::string& sid)
 const SedAbstractTask*
 SedListOfTasks::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractTask>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedAbstractTask*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedAbstractTask*>(SedListOf::get(n));
 }
 
 
@@ -182,19 +204,8 @@ SedListOfTasks::remove(unsigned int n)
 SedAbstractTask*
 SedListOfTasks::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(),
-    SedIdEq<SedAbstractTask>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedAbstractTask*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedAbstractTask*>(SedListOf::remove(n));
 }
 
 
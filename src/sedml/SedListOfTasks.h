@@ -118,6 +118,27 @@ public:
   SedListOfTasks& operator=(const SedListOfTasks& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfTasks.
+   *
+   * @param orig the SedListOfTasks instance to move from; it is left empty.
+   */
+  SedListOfTasks(SedListOfTasks&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfTasks.
+   *
+   * @param rhs the SedListOfTasks object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfTasks& operator=(SedListOfTasks&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfTasks object.
    *
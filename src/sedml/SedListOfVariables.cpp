@@ -56,7 +56,6 @@ SedListOfVariables::SedListOfVariables(unsigned int level,
                                        unsigned int version)
   : SedListOf(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -95,6 +94,30 @@ SedListOfVariables::operator=(const SedListOfVariables& rhs)
 }
 
 
+/*
+ * Move constructor for SedListOfVariables.
+ */
+SedListOfVariables::SedListOfVariables(SedListOfVariables&& orig) noexcept
+  : SedListOf( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedListOfVariables.
+ */
+SedListOfVariables&
+SedListOfVariables::operator=(SedListOfVariables&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedListOf::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedListOfVariables object.
  */
@@ -150,10 +173,8 @@ SedListOfVariables::get(const std::string& sid)
 const SedVariable*
 SedListOfVariables::get(const std::string& sid) const
 {
-  vector<SedBase*>::const_iterator result;
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedVariable>(sid));
-  return (result == mItems.end()) ? 0 : static_cast <const SedVariable*>
-    (*result);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<const SedVariable*>(SedListOf::get(n));
 }
 
 
@@ -175,18 +196,8 @@ SedListOfVariables::remove(unsigned int n)
 SedVariable*
 SedListOfVariables::remove(const std::string& sid)
 {
-  SedBase* item = NULL;
-  vector<SedBase*>::iterator result;
-
-  result = find_if(mItems.begin(), mItems.end(), SedIdEq<SedVariable>(sid));
-
-  if (result != mItems.end())
-  {
-    item = *result;
-    mItems.erase(result);
-  }
-
-  return static_cast <SedVariable*> (item);
+  unsigned int n = findItemPosition(sid);
+  return static_cast<SedVariable*>(SedListOf::remove(n));
 }
 
 
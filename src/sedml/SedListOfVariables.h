@@ -107,6 +107,27 @@ public:
   SedListOfVariables& operator=(const SedListOfVariables& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedListOfVariables.
+   *
+   * @param orig the SedListOfVariables instance to move from; it is left empty.
+   */
+  SedListOfVariables(SedListOfVariables&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedListOfVariables.
+   *
+   * @param rhs the SedListOfVariables object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedListOfVariables& operator=(SedListOfVariables&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedListOfVariables object.
    *
@@ -0,0 +1,170 @@
+/**
+ * @file SedMappedFile.cpp
+ * @brief Implementation of the SedMappedFile class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedMappedFile.h>
+
+#if defined(WIN32) && !defined(CYGWIN)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+using namespace std;
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Maps the file with the given name.
+ */
+SedMappedFile::SedMappedFile(const std::string& filename)
+  : mData (NULL)
+  , mSize (0)
+  , mMapping (NULL)
+{
+#if defined(WIN32) && !defined(CYGWIN)
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) return;
+
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0 &&
+      (unsigned long long)size.QuadPart <= (size_t)-1)
+  {
+    mMapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mMapping != NULL)
+    {
+      mData = static_cast<const char*>(
+        MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+      mSize = (mData != NULL) ? (size_t)size.QuadPart : 0;
+    }
+  }
+  CloseHandle(file);
+#else
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+  {
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data != MAP_FAILED)
+    {
+      mData = static_cast<const char*>(data);
+      mSize = (size_t)st.st_size;
+    }
+  }
+  close(fd);
+#endif
+}
+
+
+/*
+ * Destructor for SedMappedFile.
+ */
+SedMappedFile::~SedMappedFile()
+{
+#if defined(WIN32) && !defined(CYGWIN)
+  if (mData != NULL) UnmapViewOfFile(mData);
+  if (mMapping != NULL) CloseHandle(mMapping);
+#else
+  if (mData != NULL) munmap(const_cast<char*>(mData), mSize);
+#endif
+}
+
+
+/*
+ * Returns the mapped bytes.
+ */
+const char*
+SedMappedFile::getData() const
+{
+  return mData;
+}
+
+
+/*
+ * Returns the number of mapped bytes.
+ */
+size_t
+SedMappedFile::getSize() const
+{
+  return mSize;
+}
+
+
+/*
+ * Returns the mapped text if it is NUL-terminated.
+ */
+const char*
+SedMappedFile::getText() const
+{
+  if (mData == NULL || mSize % getPageSize() == 0)
+  {
+    return NULL;
+  }
+
+  return mData;
+}
+
+
+/*
+ * Returns the size of a memory page.
+ */
+size_t
+SedMappedFile::getPageSize()
+{
+#if defined(WIN32) && !defined(CYGWIN)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+#else
+  return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
@@ -0,0 +1,119 @@
+/**
+ * @file SedMappedFile.h
+ * @brief Definition of the SedMappedFile class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedMappedFile
+ * @sbmlbrief{} A read-only memory mapping of a whole file.
+ *
+ * Used by SedReader to parse documents in place and by SedVectorRange to
+ * access binary value arrays without reading them into memory.
+ */
+
+
+#ifndef SedMappedFile_H__
+#define SedMappedFile_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <string>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+class LIBSEDML_EXTERN SedMappedFile
+{
+public:
+
+  /**
+   * Maps the file with the given name; if that fails, the mapping is empty.
+   */
+  SedMappedFile(const std::string& filename);
+
+
+  /**
+   * Destructor for SedMappedFile, unmaps the file.
+   */
+  ~SedMappedFile();
+
+
+  /**
+   * Returns the mapped bytes, or @c NULL if the file could not be mapped.
+   */
+  const char* getData() const;
+
+
+  /**
+   * Returns the number of mapped bytes.
+   */
+  size_t getSize() const;
+
+
+  /**
+   * Returns the mapped text if it is NUL-terminated, that is, if the file
+   * does not end on a page boundary so that the rest of its last page reads
+   * as zeros; returns NULL otherwise.
+   */
+  const char* getText() const;
+
+
+private:
+
+  SedMappedFile(const SedMappedFile&);
+  SedMappedFile& operator=(const SedMappedFile&);
+
+  static size_t getPageSize();
+
+  const char* mData;
+  size_t mSize;
+  void* mMapping;
+};
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedMappedFile_H__ */
@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedMarker.h>
+#include <sedml/SedStyle.h>
 #include <sbml/xml/XMLInputStream.h>
 
 
@@ -60,7 +61,6 @@ SedMarker::SedMarker(unsigned int level, unsigned int version)
   , mLineThickness (util_NaN())
   , mIsSetLineThickness (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -119,6 +119,44 @@ SedMarker::operator=(const SedMarker& rhs)
 }
 
 
+/*
+ * Move constructor for SedMarker.
+ */
+SedMarker::SedMarker(SedMarker&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mSize ( std::move(orig.mSize) )
+  , mIsSetSize ( std::move(orig.mIsSetSize) )
+  , mType ( std::move(orig.mType) )
+  , mFill ( std::move(orig.mFill) )
+  , mLineColor ( std::move(orig.mLineColor) )
+  , mLineThickness ( std::move(orig.mLineThickness) )
+  , mIsSetLineThickness ( std::move(orig.mIsSetLineThickness) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedMarker.
+ */
+SedMarker&
+SedMarker::operator=(SedMarker&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mSize = std::move(rhs.mSize);
+    mIsSetSize = std::move(rhs.mIsSetSize);
+    mType = std::move(rhs.mType);
+    mFill = std::move(rhs.mFill);
+    mLineColor = std::move(rhs.mLineColor);
+    mLineThickness = std::move(rhs.mLineThickness);
+    mIsSetLineThickness = std::move(rhs.mIsSetLineThickness);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedMarker object.
  */
@@ -256,6 +294,8 @@ SedMarker::isSetLineThickness() const
 int
 SedMarker::setSize(double size)
 {
+  styleChanged();
+
   mSize = size;
   mIsSetSize = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -268,6 +308,8 @@ SedMarker::setSize(double size)
 int
 SedMarker::setType(const MarkerType_t type)
 {
+  styleChanged();
+
   if (MarkerType_isValid(type) == 0)
   {
     mType = SEDML_MARKERTYPE_INVALID;
@@ -287,6 +329,8 @@ SedMarker::setType(const MarkerType_t type)
 int
 SedMarker::setType(const std::string& type)
 {
+  styleChanged();
+
   mType = MarkerType_fromString(type.c_str());
 
   if (mType == SEDML_MARKERTYPE_INVALID)
@@ -304,6 +348,8 @@ SedMarker::setType(const std::string& type)
 int
 SedMarker::setFill(const std::string& fill)
 {
+  styleChanged();
+
   mFill = fill;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -315,6 +361,8 @@ SedMarker::setFill(const std::string& fill)
 int
 SedMarker::setLineColor(const std::string& lineColor)
 {
+  styleChanged();
+
   mLineColor = lineColor;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -326,6 +374,8 @@ SedMarker::setLineColor(const std::string& lineColor)
 int
 SedMarker::setLineThickness(double lineThickness)
 {
+  styleChanged();
+
   mLineThickness = lineThickness;
   mIsSetLineThickness = true;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -338,6 +388,8 @@ SedMarker::setLineThickness(double lineThickness)
 int
 SedMarker::unsetSize()
 {
+  styleChanged();
+
   mSize = util_NaN();
   mIsSetSize = false;
 
@@ -358,6 +410,8 @@ SedMarker::unsetSize()
 int
 SedMarker::unsetType()
 {
+  styleChanged();
+
   mType = SEDML_MARKERTYPE_INVALID;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -369,6 +423,8 @@ SedMarker::unsetType()
 int
 SedMarker::unsetFill()
 {
+  styleChanged();
+
   mFill.erase();
 
   if (mFill.empty() == true)
@@ -388,6 +444,8 @@ SedMarker::unsetFill()
 int
 SedMarker::unsetLineColor()
 {
+  styleChanged();
+
   mLineColor.erase();
 
   if (mLineColor.empty() == true)
@@ -407,6 +465,8 @@ SedMarker::unsetLineColor()
 int
 SedMarker::unsetLineThickness()
 {
+  styleChanged();
+
   mLineThickness = util_NaN();
   mIsSetLineThickness = false;
 
@@ -1021,6 +1081,26 @@ SedMarker::writeAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Tells the parent SedStyle, if any, that this SedMarker changes
+ */
+void
+SedMarker::styleChanged()
+{
+  SedBase* parent = getParentSedObject();
+
+  if (parent != NULL && parent->getTypeCode() == SEDML_STYLE)
+  {
+    static_cast<SedStyle*>(parent)->styleChanged();
+  }
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
@@ -165,6 +165,27 @@ public:
   SedMarker& operator=(const SedMarker& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedMarker.
+   *
+   * @param orig the SedMarker instance to move from; it is left empty.
+   */
+  SedMarker(SedMarker&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedMarker.
+   *
+   * @param rhs the SedMarker object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedMarker& operator=(SedMarker&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedMarker object.
    *
@@ -802,6 +823,17 @@ protected:
   /** @endcond */
 
 
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Tells the parent SedStyle, if any, that this SedMarker changes
+   */
+  void styleChanged();
+
+  /** @endcond */
+
+
 };
 
 
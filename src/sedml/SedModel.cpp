@@ -63,7 +63,6 @@ SedModel::SedModel(unsigned int level, unsigned int version)
   , mSource ("")
   , mChanges (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -118,6 +117,38 @@ SedModel::operator=(const SedModel& rhs)
 }
 
 
+/*
+ * Move constructor for SedModel.
+ */
+SedModel::SedModel(SedModel&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mLanguage ( std::move(orig.mLanguage) )
+  , mSource ( std::move(orig.mSource) )
+  , mChanges ( std::move(orig.mChanges) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedModel.
+ */
+SedModel&
+SedModel::operator=(SedModel&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mLanguage = std::move(rhs.mLanguage);
+    mSource = std::move(rhs.mSource);
+    mChanges = std::move(rhs.mChanges);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedModel object.
  */
@@ -1057,6 +1088,20 @@ SedModel::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedModel
+ */
+void
+SedModel::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mChanges, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
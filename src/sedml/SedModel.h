@@ -113,6 +113,27 @@ public:
   SedModel& operator=(const SedModel& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedModel.
+   *
+   * @param orig the SedModel instance to move from; it is left empty.
+   */
+  SedModel(SedModel&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedModel.
+   *
+   * @param rhs the SedModel object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedModel& operator=(SedModel&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedModel object.
    *
@@ -878,6 +899,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedModel.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
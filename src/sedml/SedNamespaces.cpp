@@ -95,6 +95,7 @@ SedNamespaces::SedNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
   ,mNamespaces(NULL)
+  ,mRefCount(0)
 {
   initSedNamespace();
 }
@@ -114,6 +115,7 @@ SedNamespaces::SedNamespaces(const SedNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mRefCount(0)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
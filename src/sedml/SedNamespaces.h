@@ -68,6 +68,7 @@ static const char* const SEDML_XMLNS_L1V4   = "http://sed-ml.org/sed-ml/level1/v
 
 #include <string>
 #include <stdexcept>
+#include <atomic>
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
@@ -287,6 +288,12 @@ protected:
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
 
+  // number of SedBase objects sharing this instance, 0 if it is not
+  // managed by SedBase (see SedBase::shareSedNamespaces)
+  std::atomic<unsigned int> mRefCount;
+
+  friend class SedBase;
+
   /** @endcond */
 };
 
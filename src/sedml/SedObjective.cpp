@@ -57,7 +57,6 @@ SedObjective::SedObjective(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mElementName("objective")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -98,6 +97,32 @@ SedObjective::operator=(const SedObjective& rhs)
 }
 
 
+/*
+ * Move constructor for SedObjective.
+ */
+SedObjective::SedObjective(SedObjective&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedObjective.
+ */
+SedObjective&
+SedObjective::operator=(SedObjective&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedObjective object.
  */
@@ -115,6 +115,27 @@ public:
   SedObjective& operator=(const SedObjective& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedObjective.
+   *
+   * @param orig the SedObjective instance to move from; it is left empty.
+   */
+  SedObjective(SedObjective&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedObjective.
+   *
+   * @param rhs the SedObjective object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedObjective& operator=(SedObjective&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedObjective object.
    *
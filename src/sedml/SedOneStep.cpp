@@ -55,7 +55,6 @@ SedOneStep::SedOneStep(unsigned int level, unsigned int version)
   , mStep (util_NaN())
   , mIsSetStep (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -99,6 +98,34 @@ SedOneStep::operator=(const SedOneStep& rhs)
 }
 
 
+/*
+ * Move constructor for SedOneStep.
+ */
+SedOneStep::SedOneStep(SedOneStep&& orig) noexcept
+  : SedSimulation( std::move(orig) )
+  , mStep ( std::move(orig.mStep) )
+  , mIsSetStep ( std::move(orig.mIsSetStep) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedOneStep.
+ */
+SedOneStep&
+SedOneStep::operator=(SedOneStep&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+    mStep = std::move(rhs.mStep);
+    mIsSetStep = std::move(rhs.mIsSetStep);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedOneStep object.
  */
@@ -113,6 +113,27 @@ public:
   SedOneStep& operator=(const SedOneStep& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedOneStep.
+   *
+   * @param orig the SedOneStep instance to move from; it is left empty.
+   */
+  SedOneStep(SedOneStep&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedOneStep.
+   *
+   * @param rhs the SedOneStep object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedOneStep& operator=(SedOneStep&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedOneStep object.
    *
@@ -61,7 +61,6 @@ SedOutput::SedOutput(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mElementName("output")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
 }
@@ -106,6 +105,32 @@ SedOutput::operator=(const SedOutput& rhs)
 }
 
 
+/*
+ * Move constructor for SedOutput.
+ */
+SedOutput::SedOutput(SedOutput&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedOutput.
+ */
+SedOutput&
+SedOutput::operator=(SedOutput&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedOutput object.
  */
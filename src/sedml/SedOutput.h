@@ -117,6 +117,27 @@ public:
   SedOutput& operator=(const SedOutput& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedOutput.
+   *
+   * @param orig the SedOutput instance to move from; it is left empty.
+   */
+  SedOutput(SedOutput&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedOutput.
+   *
+   * @param rhs the SedOutput object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedOutput& operator=(SedOutput&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedOutput object.
    *
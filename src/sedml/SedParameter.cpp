@@ -57,7 +57,6 @@ SedParameter::SedParameter(unsigned int level, unsigned int version)
   , mValue (util_NaN())
   , mIsSetValue (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
 }
@@ -105,6 +104,34 @@ SedParameter::operator=(const SedParameter& rhs)
 }
 
 
+/*
+ * Move constructor for SedParameter.
+ */
+SedParameter::SedParameter(SedParameter&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mValue ( std::move(orig.mValue) )
+  , mIsSetValue ( std::move(orig.mIsSetValue) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedParameter.
+ */
+SedParameter&
+SedParameter::operator=(SedParameter&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mValue = std::move(rhs.mValue);
+    mIsSetValue = std::move(rhs.mIsSetValue);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameter object.
  */
@@ -114,6 +114,27 @@ public:
   SedParameter& operator=(const SedParameter& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedParameter.
+   *
+   * @param orig the SedParameter instance to move from; it is left empty.
+   */
+  SedParameter(SedParameter&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedParameter.
+   *
+   * @param rhs the SedParameter object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedParameter& operator=(SedParameter&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameter object.
    *
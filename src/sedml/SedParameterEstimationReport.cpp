@@ -57,7 +57,6 @@ SedParameterEstimationReport::SedParameterEstimationReport(unsigned int level,
   : SedOutput(level, version)
   , mTaskReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -102,6 +101,32 @@ SedParameterEstimationReport::operator=(const SedParameterEstimationReport&
 }
 
 
+/*
+ * Move constructor for SedParameterEstimationReport.
+ */
+SedParameterEstimationReport::SedParameterEstimationReport(SedParameterEstimationReport&& orig) noexcept
+  : SedOutput( std::move(orig) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedParameterEstimationReport.
+ */
+SedParameterEstimationReport&
+SedParameterEstimationReport::operator=(SedParameterEstimationReport&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mTaskReference = std::move(rhs.mTaskReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameterEstimationReport object.
  */
@@ -155,6 +180,7 @@ SedParameterEstimationReport::setTaskReference(const std::string& taskReference)
   }
   else
   {
+    sIdRefChanged(mTaskReference, taskReference);
     mTaskReference = taskReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -168,6 +194,7 @@ SedParameterEstimationReport::setTaskReference(const std::string& taskReference)
 int
 SedParameterEstimationReport::unsetTaskReference()
 {
+  sIdRefChanged(mTaskReference, std::string());
   mTaskReference.erase();
 
   if (mTaskReference.empty() == true)
@@ -195,6 +222,19 @@ SedParameterEstimationReport::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedParameterEstimationReport to refs.
+ */
+void
+SedParameterEstimationReport::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(mTaskReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedParameterEstimationReport object.
  */
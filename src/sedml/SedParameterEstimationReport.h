@@ -114,6 +114,27 @@ public:
     rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedParameterEstimationReport.
+   *
+   * @param orig the SedParameterEstimationReport instance to move from; it is left empty.
+   */
+  SedParameterEstimationReport(SedParameterEstimationReport&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedParameterEstimationReport.
+   *
+   * @param rhs the SedParameterEstimationReport object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedParameterEstimationReport& operator=(SedParameterEstimationReport&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameterEstimationReport
    * object.
@@ -181,6 +202,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedParameterEstimationReport object.
    *
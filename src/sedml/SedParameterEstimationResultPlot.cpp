@@ -59,7 +59,6 @@ SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(
   : SedPlot(level, version)
   , mTaskReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -104,6 +103,32 @@ SedParameterEstimationResultPlot::operator=(const
 }
 
 
+/*
+ * Move constructor for SedParameterEstimationResultPlot.
+ */
+SedParameterEstimationResultPlot::SedParameterEstimationResultPlot(SedParameterEstimationResultPlot&& orig) noexcept
+  : SedPlot( std::move(orig) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedParameterEstimationResultPlot.
+ */
+SedParameterEstimationResultPlot&
+SedParameterEstimationResultPlot::operator=(SedParameterEstimationResultPlot&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mTaskReference = std::move(rhs.mTaskReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameterEstimationResultPlot
  * object.
@@ -158,6 +183,7 @@ SedParameterEstimationResultPlot::setTaskReference(const std::string& taskRefere
   }
   else
   {
+    sIdRefChanged(mTaskReference, taskReference);
     mTaskReference = taskReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -171,6 +197,7 @@ SedParameterEstimationResultPlot::setTaskReference(const std::string& taskRefere
 int
 SedParameterEstimationResultPlot::unsetTaskReference()
 {
+  sIdRefChanged(mTaskReference, std::string());
   mTaskReference.erase();
 
   if (mTaskReference.empty() == true)
@@ -198,6 +225,19 @@ SedParameterEstimationResultPlot::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedParameterEstimationResultPlot to refs.
+ */
+void
+SedParameterEstimationResultPlot::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(mTaskReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedParameterEstimationResultPlot
  * object.
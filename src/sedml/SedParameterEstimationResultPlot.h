@@ -117,6 +117,27 @@ public:
     SedParameterEstimationResultPlot& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedParameterEstimationResultPlot.
+   *
+   * @param orig the SedParameterEstimationResultPlot instance to move from; it is left empty.
+   */
+  SedParameterEstimationResultPlot(SedParameterEstimationResultPlot&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedParameterEstimationResultPlot.
+   *
+   * @param rhs the SedParameterEstimationResultPlot object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedParameterEstimationResultPlot& operator=(SedParameterEstimationResultPlot&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameterEstimationResultPlot
    * object.
@@ -184,6 +205,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedParameterEstimationResultPlot
    * object.
@@ -61,7 +61,6 @@ SedParameterEstimationTask::SedParameterEstimationTask(unsigned int level,
   , mAdjustableParameters (level, version)
   , mFitExperiments (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -145,6 +144,47 @@ SedParameterEstimationTask::operator=(const SedParameterEstimationTask& rhs)
 }
 
 
+/*
+ * Move constructor for SedParameterEstimationTask.
+ */
+SedParameterEstimationTask::SedParameterEstimationTask(SedParameterEstimationTask&& orig) noexcept
+  : SedAbstractTask( std::move(orig) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mObjective ( orig.mObjective )
+  , mAdjustableParameters ( std::move(orig.mAdjustableParameters) )
+  , mFitExperiments ( std::move(orig.mFitExperiments) )
+{
+  orig.mAlgorithm = NULL;
+  orig.mObjective = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedParameterEstimationTask.
+ */
+SedParameterEstimationTask&
+SedParameterEstimationTask::operator=(SedParameterEstimationTask&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+    delete mObjective;
+    mObjective = rhs.mObjective;
+    rhs.mObjective = NULL;
+    mAdjustableParameters = std::move(rhs.mAdjustableParameters);
+    mFitExperiments = std::move(rhs.mFitExperiments);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedParameterEstimationTask object.
  */
@@ -1347,6 +1387,32 @@ SedParameterEstimationTask::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedParameterEstimationTask
+ */
+void
+SedParameterEstimationTask::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mAlgorithm != NULL)
+  {
+    visit(mAlgorithm, data);
+  }
+
+  if (mObjective != NULL)
+  {
+    visit(mObjective, data);
+  }
+
+  visit(&mAdjustableParameters, data);
+
+  visit(&mFitExperiments, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
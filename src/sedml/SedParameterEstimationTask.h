@@ -120,6 +120,27 @@ public:
   SedParameterEstimationTask& operator=(const SedParameterEstimationTask& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedParameterEstimationTask.
+   *
+   * @param orig the SedParameterEstimationTask instance to move from; it is left empty.
+   */
+  SedParameterEstimationTask(SedParameterEstimationTask&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedParameterEstimationTask.
+   *
+   * @param rhs the SedParameterEstimationTask object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedParameterEstimationTask& operator=(SedParameterEstimationTask&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedParameterEstimationTask object.
    *
@@ -1161,6 +1182,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedParameterEstimationTask.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -61,7 +61,6 @@ SedPlot::SedPlot(unsigned int level, unsigned int version)
   , mXAxis (NULL)
   , mYAxis (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -155,6 +154,55 @@ SedPlot::operator=(const SedPlot& rhs)
 }
 
 
+/*
+ * Move constructor for SedPlot.
+ */
+SedPlot::SedPlot(SedPlot&& orig) noexcept
+  : SedOutput( std::move(orig) )
+  , mLegend ( std::move(orig.mLegend) )
+  , mIsSetLegend ( std::move(orig.mIsSetLegend) )
+  , mHeight ( std::move(orig.mHeight) )
+  , mIsSetHeight ( std::move(orig.mIsSetHeight) )
+  , mWidth ( std::move(orig.mWidth) )
+  , mIsSetWidth ( std::move(orig.mIsSetWidth) )
+  , mXAxis ( orig.mXAxis )
+  , mYAxis ( orig.mYAxis )
+{
+  orig.mXAxis = NULL;
+  orig.mYAxis = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedPlot.
+ */
+SedPlot&
+SedPlot::operator=(SedPlot&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mLegend = std::move(rhs.mLegend);
+    mIsSetLegend = std::move(rhs.mIsSetLegend);
+    mHeight = std::move(rhs.mHeight);
+    mIsSetHeight = std::move(rhs.mIsSetHeight);
+    mWidth = std::move(rhs.mWidth);
+    mIsSetWidth = std::move(rhs.mIsSetWidth);
+    delete mXAxis;
+    mXAxis = rhs.mXAxis;
+    rhs.mXAxis = NULL;
+    delete mYAxis;
+    mYAxis = rhs.mYAxis;
+    rhs.mYAxis = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedPlot object.
  */
@@ -1136,6 +1184,28 @@ SedPlot::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedPlot
+ */
+void
+SedPlot::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mXAxis != NULL)
+  {
+    visit(mXAxis, data);
+  }
+
+  if (mYAxis != NULL)
+  {
+    visit(mYAxis, data);
+  }
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
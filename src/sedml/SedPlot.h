@@ -118,6 +118,27 @@ public:
   SedPlot& operator=(const SedPlot& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedPlot.
+   *
+   * @param orig the SedPlot instance to move from; it is left empty.
+   */
+  SedPlot(SedPlot&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedPlot.
+   *
+   * @param rhs the SedPlot object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedPlot& operator=(SedPlot&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedPlot object.
    *
@@ -812,6 +833,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedPlot.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -58,7 +58,6 @@ SedPlot2D::SedPlot2D(unsigned int level, unsigned int version)
   , mAbstractCurves (level, version)
   , mRightYAxis (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -120,6 +119,40 @@ SedPlot2D::operator=(const SedPlot2D& rhs)
 }
 
 
+/*
+ * Move constructor for SedPlot2D.
+ */
+SedPlot2D::SedPlot2D(SedPlot2D&& orig) noexcept
+  : SedPlot( std::move(orig) )
+  , mAbstractCurves ( std::move(orig.mAbstractCurves) )
+  , mRightYAxis ( orig.mRightYAxis )
+{
+  orig.mRightYAxis = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedPlot2D.
+ */
+SedPlot2D&
+SedPlot2D::operator=(SedPlot2D&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mAbstractCurves = std::move(rhs.mAbstractCurves);
+    delete mRightYAxis;
+    mRightYAxis = rhs.mRightYAxis;
+    rhs.mRightYAxis = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedPlot2D object.
  */
@@ -1004,6 +1037,27 @@ SedPlot2D::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedPlot2D
+ */
+void
+SedPlot2D::visitChildren(ChildVisitor visit, void* data)
+{
+  SedPlot::visitChildren(visit, data);
+
+  if (mRightYAxis != NULL)
+  {
+    visit(mRightYAxis, data);
+  }
+
+  visit(&mAbstractCurves, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -114,6 +114,27 @@ public:
   SedPlot2D& operator=(const SedPlot2D& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedPlot2D.
+   *
+   * @param orig the SedPlot2D instance to move from; it is left empty.
+   */
+  SedPlot2D(SedPlot2D&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedPlot2D.
+   *
+   * @param rhs the SedPlot2D object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedPlot2D& operator=(SedPlot2D&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedPlot2D object.
    *
@@ -935,6 +956,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedPlot2D.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -55,7 +55,6 @@ SedPlot3D::SedPlot3D(unsigned int level, unsigned int version)
   , mSurfaces (level, version)
   , mZAxis (NULL)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -117,6 +116,40 @@ SedPlot3D::operator=(const SedPlot3D& rhs)
 }
 
 
+/*
+ * Move constructor for SedPlot3D.
+ */
+SedPlot3D::SedPlot3D(SedPlot3D&& orig) noexcept
+  : SedPlot( std::move(orig) )
+  , mSurfaces ( std::move(orig.mSurfaces) )
+  , mZAxis ( orig.mZAxis )
+{
+  orig.mZAxis = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedPlot3D.
+ */
+SedPlot3D&
+SedPlot3D::operator=(SedPlot3D&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mSurfaces = std::move(rhs.mSurfaces);
+    delete mZAxis;
+    mZAxis = rhs.mZAxis;
+    rhs.mZAxis = NULL;
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedPlot3D object.
  */
@@ -1003,6 +1036,27 @@ SedPlot3D::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedPlot3D
+ */
+void
+SedPlot3D::visitChildren(ChildVisitor visit, void* data)
+{
+  SedPlot::visitChildren(visit, data);
+
+  if (mZAxis != NULL)
+  {
+    visit(mZAxis, data);
+  }
+
+  visit(&mSurfaces, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
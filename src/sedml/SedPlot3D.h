@@ -114,6 +114,27 @@ public:
   SedPlot3D& operator=(const SedPlot3D& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedPlot3D.
+   *
+   * @param orig the SedPlot3D instance to move from; it is left empty.
+   */
+  SedPlot3D(SedPlot3D&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedPlot3D.
+   *
+   * @param rhs the SedPlot3D object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedPlot3D& operator=(SedPlot3D&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedPlot3D object.
    *
@@ -971,6 +992,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedPlot3D.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
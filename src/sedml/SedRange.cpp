@@ -60,7 +60,6 @@ SedRange::SedRange(unsigned int level, unsigned int version)
   : SedBase(level, version)
   , mElementName("range")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mIdAllowedPreV4 = true;
 }
 
@@ -103,6 +102,32 @@ SedRange::operator=(const SedRange& rhs)
 }
 
 
+/*
+ * Move constructor for SedRange.
+ */
+SedRange::SedRange(SedRange&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mElementName ( std::move(orig.mElementName) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedRange.
+ */
+SedRange&
+SedRange::operator=(SedRange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mElementName = std::move(rhs.mElementName);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedRange object.
  */
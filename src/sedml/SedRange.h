@@ -115,6 +115,27 @@ public:
   SedRange& operator=(const SedRange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedRange.
+   *
+   * @param orig the SedRange instance to move from; it is left empty.
+   */
+  SedRange(SedRange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedRange.
+   *
+   * @param rhs the SedRange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedRange& operator=(SedRange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedRange object.
    *
@@ -0,0 +1,764 @@
+/**
+ * @file SedRangeExpansion.cpp
+ * @brief Implementation of the SedRangeExpansion class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <sedml/SedRangeExpansion.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedUniformRange.h>
+#include <sedml/SedVectorRange.h>
+#include <sedml/SedFunctionalRange.h>
+#include <sedml/SedDataRange.h>
+#include <sedml/SedSubTask.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <limits>
+
+
+using namespace std;
+LIBSBML_CPP_NAMESPACE_USE
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+/** @cond doxygenLibsedmlInternal */
+
+static double
+notANumber()
+{
+  return numeric_limits<double>::quiet_NaN();
+}
+
+
+/*
+ * Adds the names referred to in the given math to names.
+ */
+static void
+collectNames(const ASTNode* node, vector<string>& names)
+{
+  if (node == NULL)
+  {
+    return;
+  }
+
+  if (node->getType() == AST_NAME && node->getName() != NULL)
+  {
+    names.push_back(node->getName());
+  }
+
+  for (unsigned int i = 0; i < node->getNumChildren(); ++i)
+  {
+    collectNames(node->getChild(i), names);
+  }
+}
+
+/** @endcond */
+
+
+/*
+ * Destructor.
+ */
+SedRangeResolver::~SedRangeResolver()
+{
+}
+
+
+/*
+ * Returns the number of values of the given SedDataRange.
+ */
+unsigned int
+SedRangeResolver::getNumDataValues(const SedDataRange&)
+{
+  return 0;
+}
+
+
+/*
+ * Returns the value of the given SedDataRange at the given index.
+ */
+double
+SedRangeResolver::getDataValue(const SedDataRange&, unsigned int)
+{
+  return notANumber();
+}
+
+
+/*
+ * Returns the value of the given SedVariable in the given iteration.
+ */
+double
+SedRangeResolver::getVariableValue(const SedVariable&, unsigned int)
+{
+  return notANumber();
+}
+
+
+/*
+ * Creates a new, empty SedRangeStep.
+ */
+SedRangeStep::SedRangeStep()
+  : mTask (NULL)
+  , mLevels ()
+{
+}
+
+
+/*
+ * Returns the task to be run in this step.
+ */
+const SedAbstractTask*
+SedRangeStep::getTask() const
+{
+  return mTask;
+}
+
+
+/*
+ * Returns the number of repeated tasks enclosing the task of this step.
+ */
+unsigned int
+SedRangeStep::getNumLevels() const
+{
+  return (unsigned int)(mLevels.size());
+}
+
+
+/*
+ * Returns the expansion of the repeated task at the given level.
+ */
+const SedRangeExpansion*
+SedRangeStep::getExpansion(unsigned int level) const
+{
+  return (level < mLevels.size()) ? mLevels[level].first : NULL;
+}
+
+
+/*
+ * Returns the iteration of the repeated task at the given level.
+ */
+unsigned int
+SedRangeStep::getIteration(unsigned int level) const
+{
+  return (level < mLevels.size()) ? mLevels[level].second : 0;
+}
+
+
+/*
+ * Returns the value in this step of the range with the given id.
+ */
+double
+SedRangeStep::getValue(const std::string& rangeId) const
+{
+  for (size_t level = mLevels.size(); level-- > 0; )
+  {
+    int n = mLevels[level].first->getRangeIndex(rangeId);
+    if (n >= 0)
+    {
+      return mLevels[level].first->getValue(mLevels[level].second,
+                                            (unsigned int)n);
+    }
+  }
+
+  return notANumber();
+}
+
+
+/*
+ * Creates a new SedRangeExpansion of the given SedRepeatedTask.
+ */
+SedRangeExpansion::SedRangeExpansion(const SedRepeatedTask& task,
+                                     SedRangeResolver* resolver)
+  : mTask (task)
+  , mResolver (resolver)
+  , mRanges ()
+  , mRangeIndex ()
+  , mCyclic ()
+  , mNumValues ()
+  , mNumIterations (0)
+  , mMath ()
+  , mMathRanges ()
+  , mSubTasks ()
+  , mSubTaskTasks ()
+  , mSubExpansions ()
+  , mStepOffsets ()
+{
+  vector<const SedRepeatedTask*> enclosing;
+  expand(enclosing);
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Creates the expansion of a SedRepeatedTask nested in the given ones.
+ */
+SedRangeExpansion::SedRangeExpansion(const SedRepeatedTask& task,
+                                     SedRangeResolver* resolver,
+                                     vector<const SedRepeatedTask*>& enclosing)
+  : mTask (task)
+  , mResolver (resolver)
+  , mRanges ()
+  , mRangeIndex ()
+  , mCyclic ()
+  , mNumValues ()
+  , mNumIterations (0)
+  , mMath ()
+  , mMathRanges ()
+  , mSubTasks ()
+  , mSubTaskTasks ()
+  , mSubExpansions ()
+  , mStepOffsets ()
+{
+  expand(enclosing);
+}
+/** @endcond */
+
+
+/*
+ * Destructor for SedRangeExpansion.
+ */
+SedRangeExpansion::~SedRangeExpansion()
+{
+}
+
+
+/*
+ * Returns the SedRepeatedTask expanded by this SedRangeExpansion.
+ */
+const SedRepeatedTask&
+SedRangeExpansion::getRepeatedTask() const
+{
+  return mTask;
+}
+
+
+/*
+ * Returns the number of ranges of the SedRepeatedTask.
+ */
+unsigned int
+SedRangeExpansion::getNumRanges() const
+{
+  return (unsigned int)(mRanges.size());
+}
+
+
+/*
+ * Returns the nth range of the SedRepeatedTask.
+ */
+const SedRange*
+SedRangeExpansion::getRange(unsigned int n) const
+{
+  return (n < mRanges.size()) ? mRanges[n] : NULL;
+}
+
+
+/*
+ * Returns the index of the range with the given id.
+ */
+int
+SedRangeExpansion::getRangeIndex(const std::string& rangeId) const
+{
+  unordered_map<string, unsigned int>::const_iterator it =
+    mRangeIndex.find(rangeId);
+
+  return (it != mRangeIndex.end()) ? (int)(it->second) : -1;
+}
+
+
+/*
+ * Returns the number of iterations.
+ */
+unsigned int
+SedRangeExpansion::getNumIterations() const
+{
+  return mNumIterations;
+}
+
+
+/*
+ * Returns the value of the nth range in the given iteration.
+ */
+double
+SedRangeExpansion::getValue(unsigned int iteration, unsigned int n) const
+{
+  if (n >= mRanges.size() || mCyclic[n] || iteration >= mNumValues[n])
+  {
+    return notANumber();
+  }
+
+  const SedRange* range = mRanges[n];
+
+  switch (range->getTypeCode())
+  {
+  case SEDML_RANGE_UNIFORMRANGE:
+  {
+    const SedUniformRange* uniform = static_cast<const SedUniformRange*>(range);
+    int numSteps = uniform->getNumberOfSteps();
+    double start = uniform->getStart();
+    double end = uniform->getEnd();
+
+    // the last value is the end exactly, whatever the rounding
+    if (numSteps == 0)
+    {
+      return start;
+    }
+    if (iteration == (unsigned int)numSteps)
+    {
+      return end;
+    }
+
+    double fraction = (double)iteration / numSteps;
+    const std::string& type = uniform->getType();
+    if (type == "log" || type == "logarithmic")
+    {
+      return start * pow(end / start, fraction);
+    }
+    return start + fraction * (end - start);
+  }
+
+  case SEDML_RANGE_VECTORRANGE:
+    return static_cast<const SedVectorRange*>(range)->getValuesData()[iteration];
+
+  case SEDML_DATA_RANGE:
+    return mResolver->getDataValue(*static_cast<const SedDataRange*>(range),
+                                   iteration);
+
+  case SEDML_RANGE_FUNCTIONALRANGE:
+  {
+    return evaluate(n, iteration);
+  }
+
+  default:
+    return notANumber();
+  }
+}
+
+
+/*
+ * Returns the value of the range with the given id in the given iteration.
+ */
+double
+SedRangeExpansion::getValue(unsigned int iteration,
+                            const std::string& rangeId) const
+{
+  int n = getRangeIndex(rangeId);
+  return (n >= 0) ? getValue(iteration, (unsigned int)n) : notANumber();
+}
+
+
+/*
+ * Returns the given iteration.
+ */
+SedRangeExpansion::Iteration
+SedRangeExpansion::getIteration(unsigned int iteration) const
+{
+  return Iteration(this, iteration);
+}
+
+
+/*
+ * Returns an iterator to the first iteration.
+ */
+SedRangeExpansion::const_iterator
+SedRangeExpansion::begin() const
+{
+  return const_iterator(this, 0);
+}
+
+
+/*
+ * Returns an iterator past the last iteration.
+ */
+SedRangeExpansion::const_iterator
+SedRangeExpansion::end() const
+{
+  return const_iterator(this, mNumIterations);
+}
+
+
+/*
+ * Returns the number of sub-tasks run in each iteration.
+ */
+unsigned int
+SedRangeExpansion::getNumSubTasks() const
+{
+  return (unsigned int)(mSubTasks.size());
+}
+
+
+/*
+ * Returns the nth sub-task in execution order.
+ */
+const SedSubTask*
+SedRangeExpansion::getSubTask(unsigned int n) const
+{
+  return (n < mSubTasks.size()) ? mSubTasks[n] : NULL;
+}
+
+
+/*
+ * Returns the expansion of the nth sub-task.
+ */
+const SedRangeExpansion*
+SedRangeExpansion::getSubExpansion(unsigned int n) const
+{
+  return (n < mSubExpansions.size()) ? mSubExpansions[n].get() : NULL;
+}
+
+
+/*
+ * Returns the total number of steps.
+ */
+size_t
+SedRangeExpansion::getNumSteps() const
+{
+  return mNumIterations * mStepOffsets.back();
+}
+
+
+/*
+ * Fills step with the task and iterations of the given step.
+ */
+void
+SedRangeExpansion::getStep(size_t index, SedRangeStep& step) const
+{
+  step.mTask = NULL;
+  step.mLevels.clear();
+
+  if (index < getNumSteps())
+  {
+    addStep(index, step);
+  }
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+
+/*
+ * Indexes the ranges and expands the sub-tasks.
+ */
+void
+SedRangeExpansion::expand(vector<const SedRepeatedTask*>& enclosing)
+{
+  unsigned int numRanges = mTask.getNumRanges();
+  for (unsigned int n = 0; n < numRanges; ++n)
+  {
+    const SedRange* range = mTask.getRange(n);
+    mRanges.push_back(range);
+    if (range->isSetId())
+    {
+      mRangeIndex.insert(make_pair(range->getId(), n));
+    }
+  }
+
+  // this also parses the math of the functional ranges and indexes their
+  // parameters and variables, which would otherwise happen on first use,
+  // possibly from several threads
+  vector<int> state(numRanges, 0);
+  mCyclic.assign(numRanges, false);
+  for (unsigned int n = 0; n < numRanges; ++n)
+  {
+    findCycle(n, state);
+  }
+
+  mMath.resize(numRanges);
+  mMathRanges.resize(numRanges);
+  for (unsigned int n = 0; n < numRanges; ++n)
+  {
+    compile(n);
+  }
+
+  // functional ranges take their number of values from the range they
+  // refer to, which may come later in the list
+  mNumValues.assign(numRanges, 0);
+  for (unsigned int n = 0; n < numRanges; ++n)
+  {
+    mNumValues[n] = countValues(n);
+  }
+
+  int master = getRangeIndex(mTask.getRangeId());
+  if (master >= 0 && mNumValues[master] != UINT_MAX)
+  {
+    mNumIterations = mNumValues[master];
+  }
+
+  mTask.getSubTasksInOrder(mSubTasks);
+  mStepOffsets.push_back(0);
+
+  const SedDocument* doc = mTask.getSedDocument();
+  enclosing.push_back(&mTask);
+
+  for (size_t i = 0; i < mSubTasks.size(); ++i)
+  {
+    const SedAbstractTask* task =
+      (doc != NULL) ? doc->getTask(mSubTasks[i]->getTask()) : NULL;
+    SedRangeExpansion* expansion = NULL;
+    size_t numSteps = (task != NULL) ? 1 : 0;
+
+    if (task != NULL && task->getTypeCode() == SEDML_TASK_REPEATEDTASK)
+    {
+      const SedRepeatedTask* repeated =
+        static_cast<const SedRepeatedTask*>(task);
+
+      // a repeated task that runs itself would never end
+      numSteps = 0;
+      if (find(enclosing.begin(), enclosing.end(), repeated) ==
+          enclosing.end())
+      {
+        expansion = new SedRangeExpansion(*repeated, mResolver, enclosing);
+        numSteps = expansion->getNumSteps();
+      }
+    }
+
+    mSubTaskTasks.push_back(task);
+    mSubExpansions.push_back(unique_ptr<SedRangeExpansion>(expansion));
+    mStepOffsets.push_back(mStepOffsets.back() + numSteps);
+  }
+
+  enclosing.pop_back();
+}
+
+
+/*
+ * Returns true if the nth range depends on itself, marking it and all
+ * ranges depending on it in mCyclic; state holds 1 for ranges being
+ * visited and 2 for those done.
+ */
+bool
+SedRangeExpansion::findCycle(unsigned int n, vector<int>& state)
+{
+  if (state[n] == 1)
+  {
+    return true;
+  }
+  if (state[n] == 2)
+  {
+    return mCyclic[n];
+  }
+
+  state[n] = 1;
+  bool cyclic = false;
+
+  if (mRanges[n]->getTypeCode() == SEDML_RANGE_FUNCTIONALRANGE)
+  {
+    const SedFunctionalRange* functional =
+      static_cast<const SedFunctionalRange*>(mRanges[n]);
+
+    vector<string> names;
+    if (functional->isSetRange())
+    {
+      names.push_back(functional->getRange());
+    }
+    collectNames(functional->getMath(), names);
+
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+      // parameters and variables take precedence over ranges
+      if (functional->getParameter(names[i]) != NULL ||
+          functional->getVariable(names[i]) != NULL)
+      {
+        continue;
+      }
+
+      int other = getRangeIndex(names[i]);
+      if (other >= 0 && findCycle((unsigned int)other, state))
+      {
+        cyclic = true;
+      }
+    }
+  }
+
+  state[n] = 2;
+  mCyclic[n] = cyclic;
+  return cyclic;
+}
+
+
+/*
+ * Returns the number of values of the nth range.
+ */
+unsigned int
+SedRangeExpansion::countValues(unsigned int n) const
+{
+  const SedRange* range = mRanges[n];
+
+  switch (range->getTypeCode())
+  {
+  case SEDML_RANGE_UNIFORMRANGE:
+  {
+    const SedUniformRange* uniform = static_cast<const SedUniformRange*>(range);
+    if (!uniform->isSetNumberOfSteps() || uniform->getNumberOfSteps() < 0)
+    {
+      return 0;
+    }
+    return (unsigned int)(uniform->getNumberOfSteps()) + 1;
+  }
+
+  case SEDML_RANGE_VECTORRANGE:
+    return static_cast<const SedVectorRange*>(range)->getNumValues();
+
+  case SEDML_DATA_RANGE:
+    return (mResolver != NULL) ? mResolver->getNumDataValues(
+      *static_cast<const SedDataRange*>(range)) : 0;
+
+  case SEDML_RANGE_FUNCTIONALRANGE:
+  {
+    if (mCyclic[n])
+    {
+      return 0;
+    }
+
+    int other = getRangeIndex(
+      static_cast<const SedFunctionalRange*>(range)->getRange());
+    return (other >= 0) ? countValues((unsigned int)other) : UINT_MAX;
+  }
+
+  default:
+    return 0;
+  }
+}
+
+
+/*
+ * Compiles the math of the nth range if it is a functional range; the
+ * names in it that are neither parameters nor variables are bound to the
+ * slots after the variables.
+ */
+void
+SedRangeExpansion::compile(unsigned int n)
+{
+  if (mRanges[n]->getTypeCode() != SEDML_RANGE_FUNCTIONALRANGE || mCyclic[n])
+  {
+    return;
+  }
+
+  const SedFunctionalRange* functional =
+    static_cast<const SedFunctionalRange*>(mRanges[n]);
+
+  vector<string> names;
+  collectNames(functional->getMath(), names);
+
+  vector<string> slotNames;
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    if (functional->getParameter(names[i]) != NULL ||
+        functional->getVariable(names[i]) != NULL ||
+        find(slotNames.begin(), slotNames.end(), names[i]) != slotNames.end())
+    {
+      continue;
+    }
+
+    // names that are not ranges either evaluate to NaN
+    slotNames.push_back(names[i]);
+    mMathRanges[n].push_back(getRangeIndex(names[i]));
+  }
+
+  mMath[n].compile(*functional, slotNames);
+}
+
+
+/*
+ * Evaluates the compiled math of the nth range in the given iteration.
+ */
+double
+SedRangeExpansion::evaluate(unsigned int n, unsigned int iteration) const
+{
+  const SedCompiledMath& math = mMath[n];
+  if (!math.isCompiled())
+  {
+    return notANumber();
+  }
+
+  // most functional ranges refer to a few values only, which then need no
+  // allocation
+  const unsigned int numSlots = math.getNumSlots();
+  double buffer[16];
+  vector<double> heap;
+  double* slots = buffer;
+  if (numSlots > sizeof(buffer) / sizeof(buffer[0]))
+  {
+    heap.resize(numSlots);
+    slots = &heap[0];
+  }
+
+  const SedFunctionalRange* functional =
+    static_cast<const SedFunctionalRange*>(mRanges[n]);
+  const vector<int>& ranges = mMathRanges[n];
+  const unsigned int numVariables = numSlots - (unsigned int)(ranges.size());
+
+  for (unsigned int i = 0; i < numVariables; ++i)
+  {
+    slots[i] = (mResolver != NULL) ? mResolver->getVariableValue(
+      *functional->getVariable(i), iteration) : notANumber();
+  }
+  for (unsigned int i = numVariables; i < numSlots; ++i)
+  {
+    int other = ranges[i - numVariables];
+    slots[i] = (other >= 0)
+      ? getValue(iteration, (unsigned int)other) : notANumber();
+  }
+
+  return math.evaluate(slots);
+}
+
+
+/*
+ * Adds the levels and task of the given step within one expansion.
+ */
+void
+SedRangeExpansion::addStep(size_t index, SedRangeStep& step) const
+{
+  size_t perIteration = mStepOffsets.back();
+  size_t offset = index % perIteration;
+  step.mLevels.push_back(make_pair(this, (unsigned int)(index / perIteration)));
+
+  // sub-tasks without steps share their offset with the next one
+  size_t n = (size_t)(upper_bound(mStepOffsets.begin(), mStepOffsets.end(),
+                                  offset) - mStepOffsets.begin()) - 1;
+
+  if (mSubExpansions[n] != NULL)
+  {
+    mSubExpansions[n]->addStep(offset - mStepOffsets[n], step);
+  }
+  else
+  {
+    step.mTask = mSubTaskTasks[n];
+  }
+}
+
+/** @endcond */
+
+
+LIBSEDML_CPP_NAMESPACE_END
@@ -0,0 +1,500 @@
+/**
+ * @file SedRangeExpansion.h
+ * @brief Definition of the SedRangeExpansion class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedRangeExpansion
+ * @sbmlbrief{sedml} The iterations of a SedRepeatedTask.
+ *
+ * A SedRangeExpansion computes the values that the ranges of a
+ * SedRepeatedTask take in each iteration.  The master range, named by the
+ * "range" attribute of the task, determines the number of iterations, and
+ * the other ranges are evaluated for the same iteration index, functional
+ * ranges with the values of the ranges they refer to.
+ *
+ * Values are computed on demand for any iteration, rather than generated
+ * and stored in advance.  The sub-tasks of nested repeated tasks are
+ * expanded as well: getStep() returns the task to run, and the iteration of
+ * every enclosing repeated task, for any step of the whole expansion, so
+ * that the steps can be split up between workers without enumerating
+ * them.  All const methods may be called from several threads at once,
+ * provided the SedRangeResolver, if any, allows it.
+ *
+ * The SedRepeatedTask, and the SedDocument it belongs to, must not be
+ * modified while a SedRangeExpansion of it is in use.
+ *
+ * @class SedRangeResolver
+ * @sbmlbrief{sedml} Supplies the values a SedRangeExpansion cannot compute
+ * itself.
+ *
+ * The values of a SedDataRange come from a data file, and the variables of
+ * a SedFunctionalRange refer to the state of a model; a simulator passes a
+ * subclass of SedRangeResolver to SedRangeExpansion to supply them.
+ *
+ * @class SedRangeStep
+ * @sbmlbrief{sedml} One step of a SedRangeExpansion.
+ */
+
+
+#ifndef SedRangeExpansion_H__
+#define SedRangeExpansion_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sedml/SedRepeatedTask.h>
+#include <sedml/SedCompiledMath.h>
+#include <sbml/common/libsbml-namespace.h>
+#include <sbml/math/ASTNode.h>
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSEDML_EXTERN SedRangeResolver
+{
+public:
+
+  /**
+   * Destructor.
+   */
+  virtual ~SedRangeResolver();
+
+
+  /**
+   * Returns the number of values of the given SedDataRange.
+   *
+   * The default implementation returns @c 0.
+   */
+  virtual unsigned int getNumDataValues(const SedDataRange& range);
+
+
+  /**
+   * Returns the value of the given SedDataRange at @p index.
+   *
+   * The default implementation returns NaN.
+   */
+  virtual double getDataValue(const SedDataRange& range, unsigned int index);
+
+
+  /**
+   * Returns the value of the given SedVariable of a SedFunctionalRange in
+   * the iteration @p iteration of its SedRepeatedTask.
+   *
+   * The default implementation returns NaN.
+   */
+  virtual double getVariableValue(const SedVariable& variable,
+                                  unsigned int iteration);
+};
+
+
+class SedRangeExpansion;
+
+
+class LIBSEDML_EXTERN SedRangeStep
+{
+public:
+
+  /**
+   * Creates a new, empty SedRangeStep, to be filled in by
+   * SedRangeExpansion::getStep().
+   */
+  SedRangeStep();
+
+
+  /**
+   * Returns the task to be run in this step, which is never a
+   * SedRepeatedTask, or @c NULL if the step does not exist.
+   */
+  const SedAbstractTask* getTask() const;
+
+
+  /**
+   * Returns the number of repeated tasks enclosing the task of this step,
+   * the outermost one at level @c 0.
+   */
+  unsigned int getNumLevels() const;
+
+
+  /**
+   * Returns the expansion of the repeated task at the given level, or
+   * @c NULL if there is no such level.
+   */
+  const SedRangeExpansion* getExpansion(unsigned int level) const;
+
+
+  /**
+   * Returns the iteration of the repeated task at the given level.
+   */
+  unsigned int getIteration(unsigned int level) const;
+
+
+  /**
+   * Returns the value in this step of the range with the given id, looked
+   * up from the innermost repeated task outwards, or NaN if there is none.
+   */
+  double getValue(const std::string& rangeId) const;
+
+
+private:
+
+  /** @cond doxygenLibsedmlInternal */
+
+  friend class SedRangeExpansion;
+
+  const SedAbstractTask* mTask;
+  std::vector<std::pair<const SedRangeExpansion*, unsigned int> > mLevels;
+
+  /** @endcond */
+};
+
+
+class LIBSEDML_EXTERN SedRangeExpansion
+{
+public:
+
+  /**
+   * The values of the ranges in one iteration of a SedRangeExpansion.
+   */
+  class LIBSEDML_EXTERN Iteration
+  {
+  public:
+
+    Iteration(const SedRangeExpansion* expansion, unsigned int index)
+      : mExpansion (expansion)
+      , mIndex (index)
+    {
+    }
+
+    /**
+     * Returns the index of this iteration.
+     */
+    unsigned int getIndex() const { return mIndex; }
+
+    /**
+     * Returns the value of the nth range in this iteration.
+     */
+    double getValue(unsigned int n) const
+    {
+      return mExpansion->getValue(mIndex, n);
+    }
+
+    /**
+     * Returns the value of the range with the given id in this iteration.
+     */
+    double getValue(const std::string& rangeId) const
+    {
+      return mExpansion->getValue(mIndex, rangeId);
+    }
+
+  private:
+
+    const SedRangeExpansion* mExpansion;
+    unsigned int mIndex;
+  };
+
+
+  /**
+   * Iterates over the iterations of a SedRangeExpansion, computing the
+   * values of the ranges as they are asked for.
+   */
+  class LIBSEDML_EXTERN const_iterator
+  {
+  public:
+
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef Iteration value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Iteration* pointer;
+    typedef Iteration reference;
+
+    const_iterator(const SedRangeExpansion* expansion, unsigned int index)
+      : mExpansion (expansion)
+      , mIndex (index)
+    {
+    }
+
+    Iteration operator*() const { return Iteration(mExpansion, mIndex); }
+
+    Iteration operator[](difference_type n) const
+    {
+      return Iteration(mExpansion, (unsigned int)(mIndex + n));
+    }
+
+    const_iterator& operator++() { ++mIndex; return *this; }
+    const_iterator operator++(int) { return const_iterator(mExpansion, mIndex++); }
+    const_iterator& operator--() { --mIndex; return *this; }
+    const_iterator operator--(int) { return const_iterator(mExpansion, mIndex--); }
+
+    const_iterator& operator+=(difference_type n)
+    {
+      mIndex = (unsigned int)(mIndex + n);
+      return *this;
+    }
+
+    const_iterator& operator-=(difference_type n)
+    {
+      mIndex = (unsigned int)(mIndex - n);
+      return *this;
+    }
+
+    const_iterator operator+(difference_type n) const
+    {
+      return const_iterator(mExpansion, (unsigned int)(mIndex + n));
+    }
+
+    const_iterator operator-(difference_type n) const
+    {
+      return const_iterator(mExpansion, (unsigned int)(mIndex - n));
+    }
+
+    difference_type operator-(const const_iterator& other) const
+    {
+      return (difference_type)mIndex - (difference_type)other.mIndex;
+    }
+
+    bool operator==(const const_iterator& other) const { return mIndex == other.mIndex; }
+    bool operator!=(const const_iterator& other) const { return mIndex != other.mIndex; }
+    bool operator<(const const_iterator& other) const { return mIndex < other.mIndex; }
+
+  private:
+
+    const SedRangeExpansion* mExpansion;
+    unsigned int mIndex;
+  };
+
+
+  /**
+   * Creates a new SedRangeExpansion of the given SedRepeatedTask.
+   *
+   * @param task the SedRepeatedTask to expand; its sub-tasks are looked up
+   * in the SedDocument it belongs to.
+   *
+   * @param resolver the SedRangeResolver supplying the values of data
+   * ranges and of the variables of functional ranges, or @c NULL, in which
+   * case those values are NaN.
+   */
+  SedRangeExpansion(const SedRepeatedTask& task,
+                    SedRangeResolver* resolver = NULL);
+
+
+  /**
+   * Destructor for SedRangeExpansion.
+   */
+  ~SedRangeExpansion();
+
+
+  /**
+   * Returns the SedRepeatedTask expanded by this SedRangeExpansion.
+   */
+  const SedRepeatedTask& getRepeatedTask() const;
+
+
+  /**
+   * Returns the number of ranges of the SedRepeatedTask.
+   */
+  unsigned int getNumRanges() const;
+
+
+  /**
+   * Returns the nth range of the SedRepeatedTask, or @c NULL if there is
+   * none.
+   */
+  const SedRange* getRange(unsigned int n) const;
+
+
+  /**
+   * Returns the index of the range with the given id, or @c -1 if there is
+   * none.
+   */
+  int getRangeIndex(const std::string& rangeId) const;
+
+
+  /**
+   * Returns the number of iterations, that is, the number of values of the
+   * master range.
+   */
+  unsigned int getNumIterations() const;
+
+
+  /**
+   * Returns the value of the nth range in the given iteration.
+   *
+   * @return the value, or NaN if @p iteration or @p n is out of bounds, the
+   * range has fewer values, or its value cannot be computed, as when a
+   * functional range refers to itself.
+   */
+  double getValue(unsigned int iteration, unsigned int n) const;
+
+
+  /**
+   * Returns the value of the range with the given id in the given
+   * iteration, or NaN if there is no such range.
+   */
+  double getValue(unsigned int iteration, const std::string& rangeId) const;
+
+
+  /**
+   * Returns the given iteration.
+   */
+  Iteration getIteration(unsigned int iteration) const;
+
+
+  /**
+   * Returns an iterator to the first iteration.
+   */
+  const_iterator begin() const;
+
+
+  /**
+   * Returns an iterator past the last iteration.
+   */
+  const_iterator end() const;
+
+
+  /**
+   * Returns the number of sub-tasks run in each iteration.
+   */
+  unsigned int getNumSubTasks() const;
+
+
+  /**
+   * Returns the nth sub-task in the order in which they are run, or
+   * @c NULL if there is none.
+   */
+  const SedSubTask* getSubTask(unsigned int n) const;
+
+
+  /**
+   * Returns the expansion of the nth sub-task if it refers to a
+   * SedRepeatedTask, or @c NULL otherwise.
+   */
+  const SedRangeExpansion* getSubExpansion(unsigned int n) const;
+
+
+  /**
+   * Returns the total number of steps, that is, of runs of tasks other than
+   * repeated tasks, over all iterations of this and the nested repeated
+   * tasks.
+   *
+   * Sub-tasks that refer to tasks which do not exist, or to a repeated task
+   * enclosing them, contribute no steps.
+   */
+  size_t getNumSteps() const;
+
+
+  /**
+   * Fills @p step with the task to run in the given step and the
+   * iterations of the repeated tasks enclosing it.
+   *
+   * Steps are numbered in the order in which they run, so that any range of
+   * steps can be run independently of the others if the tasks do not
+   * depend on each other.
+   *
+   * @param index the index of the step, less than getNumSteps().
+   *
+   * @param step the SedRangeStep to fill; it has no task if @p index is out
+   * of bounds.
+   */
+  void getStep(size_t index, SedRangeStep& step) const;
+
+
+private:
+
+  /** @cond doxygenLibsedmlInternal */
+
+  SedRangeExpansion(const SedRepeatedTask& task, SedRangeResolver* resolver,
+                    std::vector<const SedRepeatedTask*>& enclosing);
+
+  SedRangeExpansion(const SedRangeExpansion&);
+  SedRangeExpansion& operator=(const SedRangeExpansion&);
+
+  void expand(std::vector<const SedRepeatedTask*>& enclosing);
+
+  bool findCycle(unsigned int n, std::vector<int>& state);
+
+  unsigned int countValues(unsigned int n) const;
+
+  void compile(unsigned int n);
+
+  double evaluate(unsigned int n, unsigned int iteration) const;
+
+  void addStep(size_t index, SedRangeStep& step) const;
+
+  const SedRepeatedTask& mTask;
+  SedRangeResolver* mResolver;
+
+  // the ranges, the index of each by id, whether each depends on itself
+  // through functional ranges, and the number of values of each (UINT_MAX
+  // for functional ranges not bound to another range)
+  std::vector<const SedRange*> mRanges;
+  std::unordered_map<std::string, unsigned int> mRangeIndex;
+  std::vector<bool> mCyclic;
+  std::vector<unsigned int> mNumValues;
+  unsigned int mNumIterations;
+
+  // the compiled math of each functional range and, for each of its slots
+  // after those of its variables, the range bound to it (-1 if none)
+  std::vector<SedCompiledMath> mMath;
+  std::vector<std::vector<int> > mMathRanges;
+
+  // the sub-tasks in execution order with their tasks, the expansions of
+  // those that are repeated tasks, and the index of the first step of each
+  // within an iteration (with the number of steps per iteration last)
+  std::vector<const SedSubTask*> mSubTasks;
+  std::vector<const SedAbstractTask*> mSubTaskTasks;
+  std::vector<std::unique_ptr<SedRangeExpansion> > mSubExpansions;
+  std::vector<size_t> mStepOffsets;
+
+  /** @endcond */
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedRangeExpansion_H__ */
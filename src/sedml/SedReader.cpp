@@ -36,8 +36,10 @@
 #include <sbml/xml/XMLError.h>
 #include <sbml/xml/XMLErrorLog.h>
 #include <sbml/xml/XMLInputStream.h>
+#include <cstring>
 
 #include <sedml/SedErrorLog.h>
+#include <sedml/SedMappedFile.h>
 #include <sedml/SedVisitor.h>
 #include <sedml/SedDocument.h>
 #include <sedml/SedError.h>
@@ -60,6 +62,13 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
  * Creates a new SedReader and returns it. 
  */
 SedReader::SedReader ()
+  : mUseArena (false)
+  , mUseMemoryMap (false)
+  , mStreamHandler (NULL)
+  , mListsToRead ()
+  , mKeepSkippedLists (false)
+  , mMaxErrors (0)
+  , mFailFastSeverity (LIBSEDML_SEV_NOT_APPLICABLE)
 {
 }
 
@@ -97,6 +106,15 @@ SedReader::~SedReader ()
 SedDocument*
 SedReader::readSedML (const std::string& filename)
 {
+  if (mUseMemoryMap)
+  {
+    SedDocument* d = readMappedFile(filename);
+    if (d != NULL)
+    {
+      return d;
+    }
+  }
+
   return readInternal(filename.c_str(), true);
 }
 
@@ -107,6 +125,15 @@ SedReader::readSedML (const std::string& filename)
 SedDocument*
 SedReader::readSedMLFromFile (const std::string& filename)
 {
+  if (mUseMemoryMap)
+  {
+    SedDocument* d = readMappedFile(filename);
+    if (d != NULL)
+    {
+      return d;
+    }
+  }
+
   return readInternal(filename.c_str(), true);
 }
 
@@ -114,12 +141,11 @@ SedReader::readSedMLFromFile (const std::string& filename)
 /*
  * Reads an Sed document from the given XML string.
  *
- * If the string does not begin with XML declaration:
+ * If the string does not begin with XML declaration, it is read as if it
+ * started with:
  *
  *   <?xml version='1.0' encoding='UTF-8'?>
  *
- * it will be prepended.
- *
  * This method will log a fatal error if the XML string is not Sed.  See
  * the method documentation for readSedML(filename) for example error
  * checking code.
@@ -129,17 +155,60 @@ SedReader::readSedMLFromFile (const std::string& filename)
 SedDocument*
 SedReader::readSedMLFromString (const std::string& xml)
 {
-  const static string dummy_xml ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");  
-  
-  if (!strncmp(xml.c_str(), dummy_xml.c_str(), 14))
+  return readSedMLFromString(xml.c_str());
+}
+
+
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Returns true if the given text starts with an XML declaration.
+ */
+static bool
+startsWithXMLDeclaration (const char* xml)
+{
+  return strncmp(xml, "<?xml version=", 14) == 0;
+}
+/** @endcond */
+
+
+/*
+ * Reads an Sed document from the given NUL-terminated text in place.
+ *
+ * Text without an XML declaration is read as if it started with
+ *
+ *   <?xml version='1.0' encoding='UTF-8'?>
+ */
+SedDocument*
+SedReader::readSedMLFromString (const char* xml)
+{
+  if (xml == NULL)
   {
-    return readInternal(xml.c_str(), false);
+    xml = "";
   }
-  else
+
+  return readInternal(xml, false, startsWithXMLDeclaration(xml));
+}
+
+
+/*
+ * Reads an Sed document from the first length characters of the given
+ * buffer.
+ */
+SedDocument*
+SedReader::readSedMLFromString (const char* xml, size_t length)
+{
+  if (xml == NULL || length == 0)
+  {
+    return readSedMLFromString("");
+  }
+
+  if (memchr(xml, '\0', length) != NULL)
   {
-    const std::string temp = (dummy_xml + xml);
-    return readInternal(temp.c_str(), false);
+    return readSedMLFromString(xml);
   }
+
+  const std::string terminated(xml, length);
+  return readSedMLFromString(terminated.c_str());
 }
 
 
@@ -169,6 +238,155 @@ SedReader::hasBzip2()
 }
 
 
+/*
+ * Reads an Sed document from the given file, streaming its top-level
+ * elements to the given handler.
+ */
+SedDocument*
+SedReader::streamSedML (const std::string& filename, SedStreamHandler& handler)
+{
+  mStreamHandler = &handler;
+  SedDocument* d = readSedML(filename);
+  mStreamHandler = NULL;
+  return d;
+}
+
+
+/*
+ * Reads an Sed document from the given XML string, streaming its top-level
+ * elements to the given handler.
+ */
+SedDocument*
+SedReader::streamSedMLFromString (const std::string& xml,
+                                  SedStreamHandler& handler)
+{
+  mStreamHandler = &handler;
+  SedDocument* d = readSedMLFromString(xml);
+  mStreamHandler = NULL;
+  return d;
+}
+
+
+/*
+ * Sets whether documents read by this SedReader use a SedArena.
+ */
+void
+SedReader::setUseArena (bool useArena)
+{
+  mUseArena = useArena;
+}
+
+
+/*
+ * Returns whether documents read by this SedReader use a SedArena.
+ */
+bool
+SedReader::getUseArena () const
+{
+  return mUseArena;
+}
+
+
+/*
+ * Restricts the top-level lists read by this SedReader.
+ */
+void
+SedReader::setListsToRead (const std::set<std::string>& listNames)
+{
+  mListsToRead = listNames;
+}
+
+
+/*
+ * Returns the names of the top-level lists read by this SedReader.
+ */
+const std::set<std::string>&
+SedReader::getListsToRead () const
+{
+  return mListsToRead;
+}
+
+
+/*
+ * Sets whether the XML of skipped top-level lists is kept.
+ */
+void
+SedReader::setKeepSkippedLists (bool keepSkippedLists)
+{
+  mKeepSkippedLists = keepSkippedLists;
+}
+
+
+/*
+ * Returns whether the XML of skipped top-level lists is kept.
+ */
+bool
+SedReader::getKeepSkippedLists () const
+{
+  return mKeepSkippedLists;
+}
+
+
+/*
+ * Sets whether this SedReader memory-maps the files it reads.
+ */
+void
+SedReader::setUseMemoryMap (bool useMemoryMap)
+{
+  mUseMemoryMap = useMemoryMap;
+}
+
+
+/*
+ * Returns whether this SedReader memory-maps the files it reads.
+ */
+bool
+SedReader::getUseMemoryMap () const
+{
+  return mUseMemoryMap;
+}
+
+
+/*
+ * Sets the number of errors after which this SedReader stops reading.
+ */
+void
+SedReader::setMaxErrors (unsigned int maxErrors)
+{
+  mMaxErrors = maxErrors;
+}
+
+
+/*
+ * Returns the number of errors after which this SedReader stops reading.
+ */
+unsigned int
+SedReader::getMaxErrors () const
+{
+  return mMaxErrors;
+}
+
+
+/*
+ * Sets the severity of the errors on which this SedReader stops reading.
+ */
+void
+SedReader::setFailFastSeverity (unsigned int severity)
+{
+  mFailFastSeverity = severity;
+}
+
+
+/*
+ * Returns the severity of the errors on which this SedReader stops reading.
+ */
+unsigned int
+SedReader::getFailFastSeverity () const
+{
+  return mFailFastSeverity;
+}
+
+
 /** @cond doxygenLibsedmlInternal */
 static bool
 isCriticalError(const unsigned int errorId)
@@ -202,14 +420,64 @@ isCriticalError(const unsigned int errorId)
 /** @endcond */
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Returns true if the given file name has one of the suffixes used for
+ * compressed files.
+ */
+static bool
+isCompressedFileName (const std::string& filename)
+{
+  static const char* suffixes[] = { ".gz", ".zip", ".bz2" };
+
+  for (size_t i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); ++i)
+  {
+    const size_t len = strlen(suffixes[i]);
+    if (filename.length() > len &&
+        strcmp_insensitive(filename.c_str() + filename.length() - len,
+                           suffixes[i]) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*
+ * Used by readSedML() when memory-mapping is enabled.
+ */
+SedDocument*
+SedReader::readMappedFile (const std::string& filename)
+{
+  if (isCompressedFileName(filename))
+  {
+    return NULL;
+  }
+
+  SedMappedFile file(filename);
+  const char* text = file.getText();
+  if (text == NULL)
+  {
+    return NULL;
+  }
+
+  return readInternal(text, false, true, filename);
+}
+/** @endcond */
+
+
 /** @cond doxygenLibsedmlInternal */
 /*
  * Used by readSedML() and readSedMLFromString().
  */
 SedDocument*
-SedReader::readInternal (const char* content, bool isFile)
+SedReader::readInternal (const char* content, bool isFile,
+                         bool hasXMLDeclaration, const std::string& location)
 {
   SedDocument* d = new SedDocument();
+  d->setLocationURI(isFile && content != NULL ? content : location);
 
   if (isFile && content != NULL && (util_file_exists(content) == false))
   {
@@ -226,7 +494,21 @@ SedReader::readInternal (const char* content, bool isFile)
 	  return d;
     }
 	
+    // streamed elements are deleted as they are read, there is no point in
+    // keeping their memory in an arena until the end
+    if (mUseArena && mStreamHandler == NULL)
+    {
+      d->enableArena();
+    }
+
+    SedArena::Scope scope(d->getArena());
+    d->setStreamHandler(mStreamHandler);
+    d->setListsToRead(&mListsToRead, mKeepSkippedLists);
+    d->setErrorLimits(mMaxErrors, mFailFastSeverity);
     d->read(stream);
+    d->setErrorLimits(0, LIBSEDML_SEV_NOT_APPLICABLE);
+    d->setListsToRead(NULL, false);
+    d->setStreamHandler(NULL);
     
     if (stream.isError())
     {
@@ -243,12 +525,7 @@ SedReader::readInternal (const char* content, bool isFile)
           // If we find even one critical error, all other errors are
           // suspect and may be bogus.  Remove them.
 
-          for (int n = (int)d->getNumErrors()-1; n >= 0; --n)
-            if (!isCriticalError(d->getError((unsigned int)n)->getErrorId()))
-            {
-              d->getErrorLog()->remove(d->getError((unsigned int)n)->getErrorId());
-            }
-
+          d->getErrorLog()->removeAllExcept(isCriticalError);
           break;
         }
       }
@@ -259,22 +536,27 @@ SedReader::readInternal (const char* content, bool isFile)
       // before we even attempt to interpret the content as Sed.  Here
       // we want to start checking some basic Sed-level errors.
 
-      if (stream.getEncoding() == "")
+      // text read from a string without an XML declaration is taken to
+      // be UTF-8 encoded XML 1.0, so there is nothing to check
+      if (hasXMLDeclaration)
       {
-        d->getErrorLog()->logError(MissingXMLEncoding);
-      }
-      else if (strcmp_insensitive(stream.getEncoding().c_str(), "UTF-8") != 0)
-      {
-        d->getErrorLog()->logError(SedNotUTF8);
-      }
+        if (stream.getEncoding() == "")
+        {
+          d->getErrorLog()->logError(MissingXMLEncoding);
+        }
+        else if (strcmp_insensitive(stream.getEncoding().c_str(), "UTF-8") != 0)
+        {
+          d->getErrorLog()->logError(SedNotUTF8);
+        }
 
-      if (stream.getVersion() == "")
-      {
-        d->getErrorLog()->logError(BadXMLDecl);
-      }
-      else if (strcmp_insensitive(stream.getVersion().c_str(), "1.0") != 0)
-      {
-        d->getErrorLog()->logError(BadXMLDecl);
+        if (stream.getVersion() == "")
+        {
+          d->getErrorLog()->logError(BadXMLDecl);
+        }
+        else if (strcmp_insensitive(stream.getVersion().c_str(), "1.0") != 0)
+        {
+          d->getErrorLog()->logError(BadXMLDecl);
+        }
       }
     }
   }
@@ -48,10 +48,12 @@
 
 
 #include <string>
+#include <set>
 
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 class SedDocument;
+class SedStreamHandler;
 
 
 class LIBSEDML_EXTERN SedReader
@@ -116,6 +118,230 @@ public:
   SedDocument* readSedMLFromString (const std::string& xml);
 
 
+#ifndef SWIG
+
+  /**
+   * Reads a SED-ML document from the NUL-terminated text @p xml in place,
+   * without copying it.
+   *
+   * As with readSedMLFromString(const std::string& xml), the text does not
+   * need to start with an XML declaration.
+   *
+   * @param xml a NUL-terminated string containing a full Sed model
+   *
+   * @return a pointer to the SedDocument created from the Sed content.
+   */
+  SedDocument* readSedMLFromString (const char* xml);
+
+
+  /**
+   * Reads a SED-ML document from the first @p length characters of @p xml,
+   * for instance a document held inside a larger in-memory archive.
+   *
+   * The underlying XML parser only accepts NUL-terminated text, so the
+   * buffer is copied once, unless it is NUL-terminated within its first
+   * @p length characters (or @p length is zero), in which case it is read
+   * in place.  Callers holding NUL-terminated text should use
+   * readSedMLFromString(const char* xml) instead.
+   *
+   * @param xml a buffer containing a full Sed model
+   * @param length the number of characters of @p xml to read
+   *
+   * @return a pointer to the SedDocument created from the Sed content.
+   */
+  SedDocument* readSedMLFromString (const char* xml, size_t length);
+
+#endif /* !SWIG */
+
+
+  /**
+   * Reads the SED-ML document in the file @p filename, handing each of its
+   * top-level elements to @p handler rather than keeping them.
+   *
+   * Each top-level element (such as a model, simulation, task, data
+   * generator or output) is passed to SedStreamHandler::element() as soon
+   * as it has been read, and deleted afterwards, so that only one of them
+   * is held in memory at a time.  Reading stops early if the handler
+   * returns @c false.
+   *
+   * @param filename the name or full pathname of the file to be read.
+   * @param handler the SedStreamHandler receiving the elements.
+   *
+   * @return a pointer to a SedDocument holding the attributes of the
+   * document and any errors found, but none of its elements.  The caller
+   * owns the returned object and is responsible for deleting it.
+   */
+  SedDocument* streamSedML (const std::string& filename,
+                            SedStreamHandler& handler);
+
+
+  /**
+   * Reads the SED-ML document in the string @p xml, handing each of its
+   * top-level elements to @p handler rather than keeping them.
+   *
+   * @param xml a string containing a full Sed model
+   * @param handler the SedStreamHandler receiving the elements.
+   *
+   * @return a pointer to a SedDocument holding the attributes of the
+   * document and any errors found, but none of its elements.
+   *
+   * @see streamSedML(const std::string& filename, SedStreamHandler& handler)
+   */
+  SedDocument* streamSedMLFromString (const std::string& xml,
+                                      SedStreamHandler& handler);
+
+
+  /**
+   * Sets whether the SedDocument objects returned by this SedReader place
+   * their elements in a SedArena.
+   *
+   * Documents read in this mode release the memory of all their elements
+   * at once when they are deleted, which makes loading and discarding many
+   * short-lived documents cheaper.  Elements of such a document must not be
+   * used after the document has been deleted.
+   *
+   * @param useArena @c true to read documents into an arena, @c false (the
+   * default) to allocate their elements on the heap.
+   *
+   * @see SedDocument::enableArena()
+   */
+  void setUseArena (bool useArena);
+
+
+  /**
+   * Returns whether the SedDocument objects returned by this SedReader
+   * place their elements in a SedArena.
+   *
+   * @return @c true if documents are read into an arena, @c false otherwise.
+   *
+   * @see setUseArena(bool useArena)
+   */
+  bool getUseArena () const;
+
+
+  /**
+   * Restricts the top-level lists of the documents read by this SedReader
+   * to those named in @p listNames.
+   *
+   * The XML of the other top-level lists is skipped without creating any
+   * objects for it, so that reading takes time in proportion to the
+   * selected lists only.  Use setKeepSkippedLists() to keep the skipped
+   * XML, so that the document can still be written back out in full.
+   *
+   * @param listNames the element names of the lists to read, such as
+   * "listOfModels" or "listOfOutputs"; an empty set (the default) reads all
+   * of them.
+   *
+   * @see SedDocument::getSkippedList()
+   */
+  void setListsToRead (const std::set<std::string>& listNames);
+
+
+  /**
+   * Returns the names of the top-level lists read by this SedReader.
+   *
+   * @return the element names of the lists read, or an empty set if all of
+   * them are read.
+   */
+  const std::set<std::string>& getListsToRead () const;
+
+
+  /**
+   * Sets whether the XML of the top-level lists skipped because of
+   * setListsToRead() is kept in the documents read.
+   *
+   * @param keepSkippedLists @c true to keep the XML of skipped lists,
+   * @c false (the default) to discard it.
+   */
+  void setKeepSkippedLists (bool keepSkippedLists);
+
+
+  /**
+   * Returns whether the XML of skipped top-level lists is kept in the
+   * documents read by this SedReader.
+   *
+   * @return @c true if the XML of skipped lists is kept, @c false otherwise.
+   */
+  bool getKeepSkippedLists () const;
+
+
+  /**
+   * Sets whether this SedReader memory-maps the files it reads.
+   *
+   * In this mode, uncompressed files are mapped into memory and parsed
+   * directly from the mapping rather than read through a buffer, which
+   * lowers the memory use and the number of read calls for large files,
+   * and lets processes reading the same file share its pages.  Compressed
+   * files, and files that cannot be mapped, are read as usual.
+   *
+   * @param useMemoryMap @c true to memory-map files, @c false (the
+   * default) to read them through a buffer.
+   */
+  void setUseMemoryMap (bool useMemoryMap);
+
+
+  /**
+   * Returns whether this SedReader memory-maps the files it reads.
+   *
+   * @return @c true if files are memory-mapped, @c false otherwise.
+   *
+   * @see setUseMemoryMap(bool useMemoryMap)
+   */
+  bool getUseMemoryMap () const;
+
+
+  /**
+   * Sets the number of errors after which this SedReader stops reading.
+   *
+   * Once that many errors of severity @c LIBSEDML_SEV_ERROR or
+   * @c LIBSEDML_SEV_FATAL have been logged, reading stops at the next
+   * element, and the document returned holds the elements read so far
+   * along with the errors logged for them.
+   *
+   * @param maxErrors the number of errors to stop at, or @c 0 (the
+   * default) to read the whole document regardless.
+   *
+   * @see setFailFastSeverity(unsigned int severity)
+   */
+  void setMaxErrors (unsigned int maxErrors);
+
+
+  /**
+   * Returns the number of errors after which this SedReader stops reading.
+   *
+   * @return the number of errors to stop at, or @c 0 if reading does not
+   * stop on a number of errors.
+   */
+  unsigned int getMaxErrors () const;
+
+
+  /**
+   * Sets the severity of the errors on the first of which this SedReader
+   * stops reading.
+   *
+   * Once an error of at least this severity has been logged, reading stops
+   * at the next element, and the document returned holds the elements read
+   * so far along with the errors logged for them.
+   *
+   * @param severity a severity code such as @c LIBSEDML_SEV_ERROR, or
+   * @c LIBSEDML_SEV_NOT_APPLICABLE (the default) to read the whole
+   * document regardless.
+   *
+   * @see setMaxErrors(unsigned int maxErrors)
+   */
+  void setFailFastSeverity (unsigned int severity);
+
+
+  /**
+   * Returns the severity of the errors on the first of which this
+   * SedReader stops reading.
+   *
+   * @return the severity code to stop at, or @c LIBSEDML_SEV_NOT_APPLICABLE
+   * if reading does not stop on a severity.
+   */
+  unsigned int getFailFastSeverity () const;
+
+
   /**
    * Static method; returns @c true if this copy of libSEDML supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -143,9 +369,26 @@ public:
 protected:
   /** @cond doxygenLibsedmlInternal */
   /**
-   * Used by readSedML() and readSedMLFromString().
+   * Used by readSedML() and readSedMLFromString(); @p location names the
+   * file text read from memory came from, if any.
+   */
+  SedDocument* readInternal (const char* content, bool isFile = true,
+                             bool hasXMLDeclaration = true,
+                             const std::string& location = "");
+
+  /**
+   * Used by readSedML() when memory-mapping is enabled; returns @c NULL if
+   * @p filename cannot be memory-mapped.
    */
-  SedDocument* readInternal (const char* content, bool isFile = true);
+  SedDocument* readMappedFile (const std::string& filename);
+
+  bool mUseArena;
+  bool mUseMemoryMap;
+  SedStreamHandler* mStreamHandler;
+  std::set<std::string> mListsToRead;
+  bool mKeepSkippedLists;
+  unsigned int mMaxErrors;
+  unsigned int mFailFastSeverity;
 
   /** @endcond */
 };
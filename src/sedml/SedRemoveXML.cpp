@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedRemoveXML::SedRemoveXML(unsigned int level, unsigned int version)
   : SedChange(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -92,6 +91,30 @@ SedRemoveXML::operator=(const SedRemoveXML& rhs)
 }
 
 
+/*
+ * Move constructor for SedRemoveXML.
+ */
+SedRemoveXML::SedRemoveXML(SedRemoveXML&& orig) noexcept
+  : SedChange( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedRemoveXML.
+ */
+SedRemoveXML&
+SedRemoveXML::operator=(SedRemoveXML&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedChange::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedRemoveXML object.
  */
@@ -106,6 +106,27 @@ public:
   SedRemoveXML& operator=(const SedRemoveXML& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedRemoveXML.
+   *
+   * @param orig the SedRemoveXML instance to move from; it is left empty.
+   */
+  SedRemoveXML(SedRemoveXML&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedRemoveXML.
+   *
+   * @param rhs the SedRemoveXML object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedRemoveXML& operator=(SedRemoveXML&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedRemoveXML object.
    *
@@ -39,6 +39,8 @@
 #include <sedml/SedFunctionalRange.h>
 #include <sedml/SedDataRange.h>
 
+#include <algorithm>
+
 
 using namespace std;
 
@@ -67,7 +69,6 @@ SedRepeatedTask::SedRepeatedTask(unsigned int level, unsigned int version)
   , mSetValues (level, version)
   , mSubTasks (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -134,6 +135,48 @@ SedRepeatedTask::operator=(const SedRepeatedTask& rhs)
 }
 
 
+/*
+ * Move constructor for SedRepeatedTask.
+ */
+SedRepeatedTask::SedRepeatedTask(SedRepeatedTask&& orig) noexcept
+  : SedAbstractTask( std::move(orig) )
+  , mRange ( std::move(orig.mRange) )
+  , mResetModel ( std::move(orig.mResetModel) )
+  , mIsSetResetModel ( std::move(orig.mIsSetResetModel) )
+  , mConcatenate ( std::move(orig.mConcatenate) )
+  , mIsSetConcatenate ( std::move(orig.mIsSetConcatenate) )
+  , mRanges ( std::move(orig.mRanges) )
+  , mSetValues ( std::move(orig.mSetValues) )
+  , mSubTasks ( std::move(orig.mSubTasks) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedRepeatedTask.
+ */
+SedRepeatedTask&
+SedRepeatedTask::operator=(SedRepeatedTask&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    mRange = std::move(rhs.mRange);
+    mResetModel = std::move(rhs.mResetModel);
+    mIsSetResetModel = std::move(rhs.mIsSetResetModel);
+    mConcatenate = std::move(rhs.mConcatenate);
+    mIsSetConcatenate = std::move(rhs.mIsSetConcatenate);
+    mRanges = std::move(rhs.mRanges);
+    mSetValues = std::move(rhs.mSetValues);
+    mSubTasks = std::move(rhs.mSubTasks);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedRepeatedTask object.
  */
@@ -227,6 +270,7 @@ SedRepeatedTask::setRangeId(const std::string& rangeId)
   }
   else
   {
+    sIdRefChanged(mRange, rangeId);
     mRange = rangeId;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -267,6 +311,7 @@ SedRepeatedTask::setConcatenate(bool concatenate)
 int
 SedRepeatedTask::unsetRangeId()
 {
+  sIdRefChanged(mRange, std::string());
   mRange.erase();
 
   if (mRange.empty() == true)
@@ -867,6 +912,42 @@ SedRepeatedTask::removeSubTask(unsigned int n)
 }
 
 
+/** @cond doxygenLibsedmlInternal */
+/*
+ * Orders sub-tasks by their "order" attribute, unset orders last.
+ */
+static bool
+precedes(const SedSubTask* subTask, const SedSubTask* other)
+{
+  if (!other->isSetOrder())
+  {
+    return subTask->isSetOrder();
+  }
+
+  return subTask->isSetOrder() && subTask->getOrder() < other->getOrder();
+}
+/** @endcond */
+
+
+/*
+ * Returns the SedSubTask objects of this SedRepeatedTask in execution order.
+ */
+void
+SedRepeatedTask::getSubTasksInOrder(std::vector<const SedSubTask*>& subTasks)
+  const
+{
+  subTasks.clear();
+  subTasks.reserve(getNumSubTasks());
+
+  for (unsigned int i = 0; i < getNumSubTasks(); ++i)
+  {
+    subTasks.push_back(getSubTask(i));
+  }
+
+  std::stable_sort(subTasks.begin(), subTasks.end(), precedes);
+}
+
+
 /*
  * @copydoc doc_renamesidref_common
  */
@@ -881,6 +962,19 @@ SedRepeatedTask::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedRepeatedTask to refs.
+ */
+void
+SedRepeatedTask::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetRangeId())
+  {
+    refs.push_back(mRange);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedRepeatedTask object.
  */
@@ -1556,6 +1650,24 @@ SedRepeatedTask::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedRepeatedTask
+ */
+void
+SedRepeatedTask::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mRanges, data);
+
+  visit(&mSetValues, data);
+
+  visit(&mSubTasks, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -48,6 +48,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <sedml/SedAbstractTask.h>
@@ -123,6 +124,27 @@ public:
   SedRepeatedTask& operator=(const SedRepeatedTask& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedRepeatedTask.
+   *
+   * @param orig the SedRepeatedTask instance to move from; it is left empty.
+   */
+  SedRepeatedTask(SedRepeatedTask&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedRepeatedTask.
+   *
+   * @param rhs the SedRepeatedTask object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedRepeatedTask& operator=(SedRepeatedTask&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedRepeatedTask object.
    *
@@ -943,6 +965,20 @@ public:
   SedSubTask* removeSubTask(unsigned int n);
 
 
+  /**
+   * Fills @p subTasks with the SedSubTask objects of this SedRepeatedTask in
+   * the order in which they are to be executed.
+   *
+   * Sub-tasks are sorted by ascending "order" attribute; those without one
+   * follow all others, and sub-tasks of the same order keep the order in
+   * which they are listed.
+   *
+   * @param subTasks the vector to fill; its previous contents are
+   * discarded.
+   */
+  void getSubTasksInOrder(std::vector<const SedSubTask*>& subTasks) const;
+
+
   /**
    * @copydoc doc_renamesidref_common
    */
@@ -950,6 +986,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedRepeatedTask object.
    *
@@ -1396,6 +1438,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedRepeatedTask.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
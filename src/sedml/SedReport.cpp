@@ -54,7 +54,6 @@ SedReport::SedReport(unsigned int level, unsigned int version)
   : SedOutput(level, version)
   , mDataSets (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -99,6 +98,34 @@ SedReport::operator=(const SedReport& rhs)
 }
 
 
+/*
+ * Move constructor for SedReport.
+ */
+SedReport::SedReport(SedReport&& orig) noexcept
+  : SedOutput( std::move(orig) )
+  , mDataSets ( std::move(orig.mDataSets) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedReport.
+ */
+SedReport&
+SedReport::operator=(SedReport&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedOutput::operator=(std::move(rhs));
+    mDataSets = std::move(rhs.mDataSets);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedReport object.
  */
@@ -770,6 +797,20 @@ SedReport::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedReport
+ */
+void
+SedReport::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mDataSets, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -112,6 +112,27 @@ public:
   SedReport& operator=(const SedReport& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedReport.
+   *
+   * @param orig the SedReport instance to move from; it is left empty.
+   */
+  SedReport(SedReport&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedReport.
+   *
+   * @param rhs the SedReport object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedReport& operator=(SedReport&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedReport object.
    *
@@ -824,6 +845,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedReport.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
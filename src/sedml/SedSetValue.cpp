@@ -32,6 +32,7 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedSetValue.h>
+#include <sedml/SedDocument.h>
 #include <sedml/SedListOfSetValues.h>
 #include <sbml/xml/XMLInputStream.h>
 #include <sbml/math/MathML.h>
@@ -59,11 +60,10 @@ SedSetValue::SedSetValue(unsigned int level, unsigned int version)
   , mSymbol ("")
   , mTarget ("")
   , mRange ("")
-  , mMath (NULL)
+  , mMath ()
   , mVariables (level, version)
   , mParameters (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -77,7 +77,7 @@ SedSetValue::SedSetValue(SedNamespaces *sedmlns)
   , mSymbol ("")
   , mTarget ("")
   , mRange ("")
-  , mMath (NULL)
+  , mMath ()
   , mVariables (sedmlns)
   , mParameters (sedmlns)
 {
@@ -95,15 +95,10 @@ SedSetValue::SedSetValue(const SedSetValue& orig)
   , mSymbol ( orig.mSymbol )
   , mTarget ( orig.mTarget )
   , mRange ( orig.mRange )
-  , mMath ( NULL )
+  , mMath ( orig.mMath )
   , mVariables ( orig.mVariables )
   , mParameters ( orig.mParameters )
 {
-  if (orig.mMath != NULL)
-  {
-    mMath = orig.mMath->deepCopy();
-  }
-
   connectToChild();
 }
 
@@ -123,16 +118,48 @@ SedSetValue::operator=(const SedSetValue& rhs)
     mRange = rhs.mRange;
     mVariables = rhs.mVariables;
     mParameters = rhs.mParameters;
-    delete mMath;
-    if (rhs.mMath != NULL)
-    {
-      mMath = rhs.mMath->deepCopy();
-    }
-    else
-    {
-      mMath = NULL;
-    }
+    mMath = rhs.mMath;
+
+    connectToChild();
+  }
+
+  return *this;
+}
+
 
+/*
+ * Move constructor for SedSetValue.
+ */
+SedSetValue::SedSetValue(SedSetValue&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mSymbol ( std::move(orig.mSymbol) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mRange ( std::move(orig.mRange) )
+  , mMath ( std::move(orig.mMath) )
+  , mVariables ( std::move(orig.mVariables) )
+  , mParameters ( std::move(orig.mParameters) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedSetValue.
+ */
+SedSetValue&
+SedSetValue::operator=(SedSetValue&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mModelReference = std::move(rhs.mModelReference);
+    mSymbol = std::move(rhs.mSymbol);
+    mTarget = std::move(rhs.mTarget);
+    mRange = std::move(rhs.mRange);
+    mMath = std::move(rhs.mMath);
+    mVariables = std::move(rhs.mVariables);
+    mParameters = std::move(rhs.mParameters);
     connectToChild();
   }
 
@@ -155,8 +182,6 @@ SedSetValue::clone() const
  */
 SedSetValue::~SedSetValue()
 {
-  delete mMath;
-  mMath = NULL;
 }
 
 
@@ -253,6 +278,7 @@ SedSetValue::setModelReference(const std::string& modelReference)
   }
   else
   {
+    sIdRefChanged(mModelReference, modelReference);
     mModelReference = modelReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -293,6 +319,7 @@ SedSetValue::setRange(const std::string& range)
   }
   else
   {
+    sIdRefChanged(mRange, range);
     mRange = range;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -305,6 +332,7 @@ SedSetValue::setRange(const std::string& range)
 int
 SedSetValue::unsetModelReference()
 {
+  sIdRefChanged(mModelReference, std::string());
   mModelReference.erase();
 
   if (mModelReference.empty() == true)
@@ -362,6 +390,7 @@ SedSetValue::unsetTarget()
 int
 SedSetValue::unsetRange()
 {
+  sIdRefChanged(mRange, std::string());
   mRange.erase();
 
   if (mRange.empty() == true)
@@ -381,7 +410,7 @@ SedSetValue::unsetRange()
 const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedSetValue::getMath() const
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -391,7 +420,7 @@ SedSetValue::getMath() const
 LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode*
 SedSetValue::getMath()
 {
-  return mMath;
+  return mMath.get(mSed != NULL ? mSed->getErrorLog() : NULL);
 }
 
 
@@ -401,7 +430,7 @@ SedSetValue::getMath()
 bool
 SedSetValue::isSetMath() const
 {
-  return (mMath != NULL);
+  return mMath.isSet();
 }
 
 
@@ -411,14 +440,13 @@ SedSetValue::isSetMath() const
 int
 SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 {
-  if (mMath == math)
+  if (mMath.owns(math))
   {
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (math == NULL)
   {
-    delete mMath;
-    mMath = NULL;
+    mMath.set(NULL);
     return LIBSEDML_OPERATION_SUCCESS;
   }
   else if (!(math->isWellFormedASTNode()))
@@ -427,8 +455,7 @@ SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
   }
   else
   {
-    delete mMath;
-    mMath = (math != NULL) ? math->deepCopy() : NULL;
+    mMath.set(math->deepCopy());
     return LIBSEDML_OPERATION_SUCCESS;
   }
 }
@@ -440,8 +467,7 @@ SedSetValue::setMath(const LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math)
 int
 SedSetValue::unsetMath()
 {
-  delete mMath;
-  mMath = NULL;
+  mMath.set(NULL);
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
@@ -818,9 +844,30 @@ SedSetValue::renameSIdRefs(const std::string& oldid, const std::string& newid)
     setRange(newid);
   }
 
-  if (isSetMath())
+  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* math = getMath();
+
+  // math that fails to parse has no references to rename
+  if (math != NULL)
+  {
+    math->renameSIdRefs(oldid, newid);
+  }
+}
+
+
+/*
+ * Appends the values of the set SIdRef attributes of this SedSetValue to refs.
+ */
+void
+SedSetValue::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetModelReference())
   {
-    mMath->renameSIdRefs(oldid, newid);
+    refs.push_back(mModelReference);
+  }
+
+  if (isSetRange())
+  {
+    refs.push_back(mRange);
   }
 }
 
@@ -876,10 +923,8 @@ SedSetValue::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 {
   SedBase::writeElements(stream);
 
-  if (isSetMath() == true)
-  {
-    writeMathML(getMath(), stream, NULL);
-  }
+  // math that does not parse is still written back as it was read
+  mMath.write(stream);
 
   if (getNumVariables() > 0)
   {
@@ -1414,6 +1459,22 @@ SedSetValue::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedSetValue
+ */
+void
+SedSetValue::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mVariables, data);
+
+  visit(&mParameters, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -1648,8 +1709,7 @@ SedSetValue::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
   {
     const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken elem = stream.peek();
     const std::string prefix = checkMathMLNamespace(elem);
-    delete mMath;
-    mMath = readMathML(stream, prefix);
+    mMath.read(stream, prefix);
     read = true;
   }
 
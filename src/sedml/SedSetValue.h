@@ -52,6 +52,7 @@
 
 #include <sedml/SedBase.h>
 #include <sbml/math/ASTNode.h>
+#include <sedml/SedLazyMath.h>
 #include <sedml/SedListOfVariables.h>
 #include <sedml/SedListOfParameters.h>
 #include <sbml/common/libsbml-namespace.h>
@@ -70,7 +71,7 @@ protected:
   std::string mSymbol;
   std::string mTarget;
   std::string mRange;
-  LIBSBML_CPP_NAMESPACE_QUALIFIER ASTNode* mMath;
+  SedLazyMath mMath;
   SedListOfVariables mVariables;
   SedListOfParameters mParameters;
 
@@ -121,6 +122,27 @@ public:
   SedSetValue& operator=(const SedSetValue& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSetValue.
+   *
+   * @param orig the SedSetValue instance to move from; it is left empty.
+   */
+  SedSetValue(SedSetValue&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSetValue.
+   *
+   * @param rhs the SedSetValue object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSetValue& operator=(SedSetValue&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSetValue object.
    *
@@ -870,6 +892,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedSetValue object.
    *
@@ -1307,6 +1335,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedSetValue.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -56,7 +56,6 @@ SedShadedArea::SedShadedArea(unsigned int level, unsigned int version)
   , mYDataReferenceFrom ("")
   , mYDataReferenceTo ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -100,6 +99,34 @@ SedShadedArea::operator=(const SedShadedArea& rhs)
 }
 
 
+/*
+ * Move constructor for SedShadedArea.
+ */
+SedShadedArea::SedShadedArea(SedShadedArea&& orig) noexcept
+  : SedAbstractCurve( std::move(orig) )
+  , mYDataReferenceFrom ( std::move(orig.mYDataReferenceFrom) )
+  , mYDataReferenceTo ( std::move(orig.mYDataReferenceTo) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedShadedArea.
+ */
+SedShadedArea&
+SedShadedArea::operator=(SedShadedArea&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedAbstractCurve::operator=(std::move(rhs));
+    mYDataReferenceFrom = std::move(rhs.mYDataReferenceFrom);
+    mYDataReferenceTo = std::move(rhs.mYDataReferenceTo);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedShadedArea object.
  */
@@ -173,6 +200,7 @@ SedShadedArea::setYDataReferenceFrom(const std::string& yDataReferenceFrom)
   }
   else
   {
+    sIdRefChanged(mYDataReferenceFrom, yDataReferenceFrom);
     mYDataReferenceFrom = yDataReferenceFrom;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -191,6 +219,7 @@ SedShadedArea::setYDataReferenceTo(const std::string& yDataReferenceTo)
   }
   else
   {
+    sIdRefChanged(mYDataReferenceTo, yDataReferenceTo);
     mYDataReferenceTo = yDataReferenceTo;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -204,6 +233,7 @@ SedShadedArea::setYDataReferenceTo(const std::string& yDataReferenceTo)
 int
 SedShadedArea::unsetYDataReferenceFrom()
 {
+  sIdRefChanged(mYDataReferenceFrom, std::string());
   mYDataReferenceFrom.erase();
 
   if (mYDataReferenceFrom.empty() == true)
@@ -223,6 +253,7 @@ SedShadedArea::unsetYDataReferenceFrom()
 int
 SedShadedArea::unsetYDataReferenceTo()
 {
+  sIdRefChanged(mYDataReferenceTo, std::string());
   mYDataReferenceTo.erase();
 
   if (mYDataReferenceTo.empty() == true)
@@ -243,6 +274,8 @@ void
 SedShadedArea::renameSIdRefs(const std::string& oldid,
                              const std::string& newid)
 {
+  SedAbstractCurve::renameSIdRefs(oldid, newid);
+
   if (isSetYDataReferenceFrom() && mYDataReferenceFrom == oldid)
   {
     setYDataReferenceFrom(newid);
@@ -255,6 +288,26 @@ SedShadedArea::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedShadedArea to refs.
+ */
+void
+SedShadedArea::getSIdRefs(std::vector<std::string>& refs) const
+{
+  SedAbstractCurve::getSIdRefs(refs);
+
+  if (isSetYDataReferenceFrom())
+  {
+    refs.push_back(mYDataReferenceFrom);
+  }
+
+  if (isSetYDataReferenceTo())
+  {
+    refs.push_back(mYDataReferenceTo);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedShadedArea object.
  */
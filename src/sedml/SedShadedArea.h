@@ -114,6 +114,27 @@ public:
   SedShadedArea& operator=(const SedShadedArea& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedShadedArea.
+   *
+   * @param orig the SedShadedArea instance to move from; it is left empty.
+   */
+  SedShadedArea(SedShadedArea&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedShadedArea.
+   *
+   * @param rhs the SedShadedArea object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedShadedArea& operator=(SedShadedArea&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedShadedArea object.
    *
@@ -226,6 +247,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedShadedArea object.
    *
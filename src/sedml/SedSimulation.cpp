@@ -62,7 +62,6 @@ SedSimulation::SedSimulation(unsigned int level, unsigned int version)
   , mAlgorithm (NULL)
   , mElementName("simulation")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -128,6 +127,40 @@ SedSimulation::operator=(const SedSimulation& rhs)
 }
 
 
+/*
+ * Move constructor for SedSimulation.
+ */
+SedSimulation::SedSimulation(SedSimulation&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mAlgorithm ( orig.mAlgorithm )
+  , mElementName ( std::move(orig.mElementName) )
+{
+  orig.mAlgorithm = NULL;
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedSimulation.
+ */
+SedSimulation&
+SedSimulation::operator=(SedSimulation&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    delete mAlgorithm;
+    mAlgorithm = rhs.mAlgorithm;
+    rhs.mAlgorithm = NULL;
+    mElementName = std::move(rhs.mElementName);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSimulation object.
  */
@@ -811,6 +844,23 @@ SedSimulation::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedSimulation
+ */
+void
+SedSimulation::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mAlgorithm != NULL)
+  {
+    visit(mAlgorithm, data);
+  }
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
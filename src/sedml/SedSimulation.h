@@ -120,6 +120,27 @@ public:
   SedSimulation& operator=(const SedSimulation& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSimulation.
+   *
+   * @param orig the SedSimulation instance to move from; it is left empty.
+   */
+  SedSimulation(SedSimulation&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSimulation.
+   *
+   * @param rhs the SedSimulation object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSimulation& operator=(SedSimulation&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSimulation object.
    *
@@ -693,6 +714,16 @@ public:
    * restriction imposed.
    */
   virtual List* getAllElements(SedElementFilter * filter = NULL);
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedSimulation.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
   
 protected:
 
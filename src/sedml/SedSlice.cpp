@@ -61,7 +61,6 @@ SedSlice::SedSlice(unsigned int level, unsigned int version)
   , mEndIndex (SEDML_INT_MAX)
   , mIsSetEndIndex (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -120,6 +119,44 @@ SedSlice::operator=(const SedSlice& rhs)
 }
 
 
+/*
+ * Move constructor for SedSlice.
+ */
+SedSlice::SedSlice(SedSlice&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mReference ( std::move(orig.mReference) )
+  , mValue ( std::move(orig.mValue) )
+  , mIndex ( std::move(orig.mIndex) )
+  , mStartIndex ( std::move(orig.mStartIndex) )
+  , mIsSetStartIndex ( std::move(orig.mIsSetStartIndex) )
+  , mEndIndex ( std::move(orig.mEndIndex) )
+  , mIsSetEndIndex ( std::move(orig.mIsSetEndIndex) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedSlice.
+ */
+SedSlice&
+SedSlice::operator=(SedSlice&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mReference = std::move(rhs.mReference);
+    mValue = std::move(rhs.mValue);
+    mIndex = std::move(rhs.mIndex);
+    mStartIndex = std::move(rhs.mStartIndex);
+    mIsSetStartIndex = std::move(rhs.mIsSetStartIndex);
+    mEndIndex = std::move(rhs.mEndIndex);
+    mIsSetEndIndex = std::move(rhs.mIsSetEndIndex);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSlice object.
  */
@@ -251,6 +288,7 @@ SedSlice::setReference(const std::string& reference)
   }
   else
   {
+    sIdRefChanged(mReference, reference);
     mReference = reference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -280,6 +318,7 @@ SedSlice::setIndex(const std::string& index)
   }
   else
   {
+    sIdRefChanged(mIndex, index);
     mIndex = index;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -316,6 +355,7 @@ SedSlice::setEndIndex(int endIndex)
 int
 SedSlice::unsetReference()
 {
+  sIdRefChanged(mReference, std::string());
   mReference.erase();
 
   if (mReference.empty() == true)
@@ -354,6 +394,7 @@ SedSlice::unsetValue()
 int
 SedSlice::unsetIndex()
 {
+  sIdRefChanged(mIndex, std::string());
   mIndex.erase();
 
   if (mIndex.empty() == true)
@@ -425,6 +466,24 @@ SedSlice::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedSlice to refs.
+ */
+void
+SedSlice::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetReference())
+  {
+    refs.push_back(mReference);
+  }
+
+  if (isSetIndex())
+  {
+    refs.push_back(mIndex);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedSlice object.
  */
@@ -116,6 +116,27 @@ public:
   SedSlice& operator=(const SedSlice& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSlice.
+   *
+   * @param orig the SedSlice instance to move from; it is left empty.
+   */
+  SedSlice(SedSlice&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSlice.
+   *
+   * @param rhs the SedSlice object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSlice& operator=(SedSlice&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSlice object.
    *
@@ -345,6 +366,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedSlice object.
    *
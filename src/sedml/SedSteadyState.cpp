@@ -54,7 +54,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedSteadyState::SedSteadyState(unsigned int level, unsigned int version)
   : SedSimulation(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -93,6 +92,30 @@ SedSteadyState::operator=(const SedSteadyState& rhs)
 }
 
 
+/*
+ * Move constructor for SedSteadyState.
+ */
+SedSteadyState::SedSteadyState(SedSteadyState&& orig) noexcept
+  : SedSimulation( std::move(orig) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedSteadyState.
+ */
+SedSteadyState&
+SedSteadyState::operator=(SedSteadyState&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSteadyState object.
  */
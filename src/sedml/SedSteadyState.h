@@ -106,6 +106,27 @@ public:
   SedSteadyState& operator=(const SedSteadyState& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSteadyState.
+   *
+   * @param orig the SedSteadyState instance to move from; it is left empty.
+   */
+  SedSteadyState(SedSteadyState&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSteadyState.
+   *
+   * @param rhs the SedSteadyState object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSteadyState& operator=(SedSteadyState&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSteadyState object.
    *
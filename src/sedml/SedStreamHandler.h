@@ -0,0 +1,110 @@
+/**
+ * @file SedStreamHandler.h
+ * @brief Definition of the SedStreamHandler class.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSEDML. Please visit http://sed-ml.org for more
+ * information about SED-ML. The latest version of libSEDML can be found on
+ * github: https://github.com/fbergmann/libSEDML/
+ * 
+
+ * Copyright (c) 2013-2019, Frank T. Bergmann
+ * All rights reserved.
+ * 
+
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class SedStreamHandler
+ * @sbmlbrief{} Receives the top-level elements of a SED-ML document as
+ * SedReader streams through it.
+ *
+ * A SedStreamHandler is passed to SedReader::streamSedML() or
+ * SedReader::streamSedMLFromString().  Instead of collecting all elements
+ * in a SedDocument, the reader hands each top-level element (model,
+ * simulation, task, data generator, output, style, ...) to element() as
+ * soon as it has been read completely, and deletes it afterwards, so that
+ * memory use stays bounded by the size of the largest element.
+ */
+
+
+#ifndef SedStreamHandler_H__
+#define SedStreamHandler_H__
+
+
+#include <sedml/common/extern.h>
+#include <sedml/common/sedmlfwd.h>
+
+
+#ifdef __cplusplus
+
+
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+
+class SedBase;
+class SedDocument;
+
+
+class LIBSEDML_EXTERN SedStreamHandler
+{
+public:
+
+  /**
+   * Destructor for SedStreamHandler.
+   */
+  virtual ~SedStreamHandler ();
+
+
+  /**
+   * Called once the attributes of the &lt;sedML&gt; element have been read.
+   *
+   * @param doc the SedDocument being read; it holds the level, version and
+   * namespaces of the document, but none of its elements.
+   *
+   * @return @c true to continue reading, @c false to stop.
+   */
+  virtual bool startDocument (const SedDocument& doc);
+
+
+  /**
+   * Called for each top-level element of the document, in document order,
+   * once it has been read completely.
+   *
+   * The element has been removed from its list, and is deleted as soon as
+   * this method returns; use SedBase::clone() to keep it.
+   *
+   * @param element the element read; its type code tells which list of the
+   * document it was found in.
+   *
+   * @return @c true to continue reading, @c false to stop.
+   */
+  virtual bool element (const SedBase& element);
+};
+
+
+LIBSEDML_CPP_NAMESPACE_END
+
+
+#endif /* __cplusplus */
+
+
+#endif /* !SedStreamHandler_H__ */
+
+
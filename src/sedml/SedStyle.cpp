@@ -35,6 +35,8 @@
 #include <sedml/SedListOfStyles.h>
 #include <sbml/xml/XMLInputStream.h>
 
+#include <atomic>
+
 
 using namespace std;
 
@@ -48,6 +50,15 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 #ifdef __cplusplus
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+// source of the revisions of all SedStyle objects, so that a style never
+// gets the revision of another one, not even one it replaces in memory
+static std::atomic<unsigned long> sedmlStyleRevision(0);
+
+/** @endcond */
+
+
 /*
  * Creates a new SedStyle using the given SED-ML Level and @ p version values.
  */
@@ -57,8 +68,8 @@ SedStyle::SedStyle(unsigned int level, unsigned int version)
   , mLineStyle (NULL)
   , mMarkerStyle (NULL)
   , mFillStyle (NULL)
+  , mRevision (++sedmlStyleRevision)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
 }
 
@@ -72,6 +83,7 @@ SedStyle::SedStyle(SedNamespaces *sedmlns)
   , mLineStyle (NULL)
   , mMarkerStyle (NULL)
   , mFillStyle (NULL)
+  , mRevision (++sedmlStyleRevision)
 {
   setElementNamespace(sedmlns->getURI());
   connectToChild();
@@ -87,6 +99,7 @@ SedStyle::SedStyle(const SedStyle& orig)
   , mLineStyle ( NULL )
   , mMarkerStyle ( NULL )
   , mFillStyle ( NULL )
+  , mRevision (++sedmlStyleRevision)
 {
   if (orig.mLineStyle != NULL)
   {
@@ -147,6 +160,55 @@ SedStyle::operator=(const SedStyle& rhs)
       mFillStyle = NULL;
     }
 
+    styleChanged();
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move constructor for SedStyle.
+ */
+SedStyle::SedStyle(SedStyle&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mBaseStyle ( std::move(orig.mBaseStyle) )
+  , mLineStyle ( orig.mLineStyle )
+  , mMarkerStyle ( orig.mMarkerStyle )
+  , mFillStyle ( orig.mFillStyle )
+  , mRevision (++sedmlStyleRevision)
+{
+  orig.mLineStyle = NULL;
+  orig.mMarkerStyle = NULL;
+  orig.mFillStyle = NULL;
+  orig.styleChanged();
+
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedStyle.
+ */
+SedStyle&
+SedStyle::operator=(SedStyle&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mBaseStyle = std::move(rhs.mBaseStyle);
+    delete mLineStyle;
+    mLineStyle = rhs.mLineStyle;
+    rhs.mLineStyle = NULL;
+    delete mMarkerStyle;
+    mMarkerStyle = rhs.mMarkerStyle;
+    rhs.mMarkerStyle = NULL;
+    delete mFillStyle;
+    mFillStyle = rhs.mFillStyle;
+    rhs.mFillStyle = NULL;
+    rhs.styleChanged();
+    styleChanged();
     connectToChild();
   }
 
@@ -204,12 +266,15 @@ SedStyle::isSetBaseStyle() const
 int
 SedStyle::setBaseStyle(const std::string& baseStyle)
 {
+  styleChanged();
+
   if (!(SyntaxChecker::isValidInternalSId(baseStyle)))
   {
     return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
   }
   else
   {
+    sIdRefChanged(mBaseStyle, baseStyle);
     mBaseStyle = baseStyle;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -222,6 +287,9 @@ SedStyle::setBaseStyle(const std::string& baseStyle)
 int
 SedStyle::unsetBaseStyle()
 {
+  styleChanged();
+
+  sIdRefChanged(mBaseStyle, std::string());
   mBaseStyle.erase();
 
   if (mBaseStyle.empty() == true)
@@ -331,6 +399,8 @@ SedStyle::isSetFillStyle() const
 int
 SedStyle::setLineStyle(const SedLine* lineStyle)
 {
+  styleChanged();
+
   if (mLineStyle == lineStyle)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -361,6 +431,8 @@ SedStyle::setLineStyle(const SedLine* lineStyle)
 int
 SedStyle::setMarkerStyle(const SedMarker* markerStyle)
 {
+  styleChanged();
+
   if (mMarkerStyle == markerStyle)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -391,6 +463,8 @@ SedStyle::setMarkerStyle(const SedMarker* markerStyle)
 int
 SedStyle::setFillStyle(const SedFill* fillStyle)
 {
+  styleChanged();
+
   if (mFillStyle == fillStyle)
   {
     return LIBSEDML_OPERATION_SUCCESS;
@@ -422,6 +496,8 @@ SedStyle::setFillStyle(const SedFill* fillStyle)
 SedLine*
 SedStyle::createLineStyle()
 {
+  styleChanged();
+
   if (mLineStyle != NULL)
   {
     delete mLineStyle;
@@ -443,6 +519,8 @@ SedStyle::createLineStyle()
 SedMarker*
 SedStyle::createMarkerStyle()
 {
+  styleChanged();
+
   if (mMarkerStyle != NULL)
   {
     delete mMarkerStyle;
@@ -464,6 +542,8 @@ SedStyle::createMarkerStyle()
 SedFill*
 SedStyle::createFillStyle()
 {
+  styleChanged();
+
   if (mFillStyle != NULL)
   {
     delete mFillStyle;
@@ -484,6 +564,8 @@ SedStyle::createFillStyle()
 int
 SedStyle::unsetLineStyle()
 {
+  styleChanged();
+
   delete mLineStyle;
   mLineStyle = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -496,6 +578,8 @@ SedStyle::unsetLineStyle()
 int
 SedStyle::unsetMarkerStyle()
 {
+  styleChanged();
+
   delete mMarkerStyle;
   mMarkerStyle = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -508,6 +592,8 @@ SedStyle::unsetMarkerStyle()
 int
 SedStyle::unsetFillStyle()
 {
+  styleChanged();
+
   delete mFillStyle;
   mFillStyle = NULL;
   return LIBSEDML_OPERATION_SUCCESS;
@@ -527,6 +613,19 @@ SedStyle::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedStyle to refs.
+ */
+void
+SedStyle::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetBaseStyle())
+  {
+    refs.push_back(mBaseStyle);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedStyle object.
  */
@@ -1162,6 +1261,33 @@ SedStyle::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedStyle
+ */
+void
+SedStyle::visitChildren(ChildVisitor visit, void* data)
+{
+  if (mLineStyle != NULL)
+  {
+    visit(mLineStyle, data);
+  }
+
+  if (mMarkerStyle != NULL)
+  {
+    visit(mMarkerStyle, data);
+  }
+
+  if (mFillStyle != NULL)
+  {
+    visit(mFillStyle, data);
+  }
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
@@ -1215,6 +1341,11 @@ SedStyle::createObject(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream& stream)
     obj = mFillStyle;
   }
 
+  if (obj != NULL)
+  {
+    styleChanged();
+  }
+
   connectToChild();
 
   return obj;
@@ -1360,6 +1491,31 @@ SedStyle::writeAttributes(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the revision of this SedStyle
+ */
+unsigned long
+SedStyle::getRevision() const
+{
+  return mRevision;
+}
+
+
+/*
+ * Gives this SedStyle a new revision after it has been modified
+ */
+void
+SedStyle::styleChanged()
+{
+  mRevision = ++sedmlStyleRevision;
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
@@ -71,6 +71,10 @@ protected:
   SedMarker* mMarkerStyle;
   SedFill* mFillStyle;
 
+  // changes with every modification of this style, including its line,
+  // marker and fill styles; see getRevision()
+  unsigned long mRevision;
+
   /** @endcond */
 
 public:
@@ -116,6 +120,27 @@ public:
   SedStyle& operator=(const SedStyle& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedStyle.
+   *
+   * @param orig the SedStyle instance to move from; it is left empty.
+   */
+  SedStyle(SedStyle&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedStyle.
+   *
+   * @param rhs the SedStyle object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedStyle& operator=(SedStyle&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedStyle object.
    *
@@ -354,6 +379,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedStyle object.
    *
@@ -439,6 +470,28 @@ public:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Returns the revision of this SedStyle.
+   *
+   * The revision changes whenever this SedStyle or its line, marker or fill
+   * style is modified, and no two SedStyle objects ever have the same
+   * revision, so that SedDocument::getResolvedStyle() can tell whether a
+   * resolved style is still current.
+   */
+  unsigned long getRevision() const;
+
+
+  /**
+   * Gives this SedStyle a new revision after it has been modified
+   */
+  void styleChanged();
+
+  /** @endcond */
+
+
+
 
   #ifndef SWIG
 
@@ -791,6 +844,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedStyle.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -63,7 +63,6 @@ SedSubPlot::SedSubPlot(unsigned int level, unsigned int version)
   , mColSpan (SEDML_INT_MAX)
   , mIsSetColSpan (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -128,6 +127,48 @@ SedSubPlot::operator=(const SedSubPlot& rhs)
 }
 
 
+/*
+ * Move constructor for SedSubPlot.
+ */
+SedSubPlot::SedSubPlot(SedSubPlot&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mPlot ( std::move(orig.mPlot) )
+  , mRow ( std::move(orig.mRow) )
+  , mIsSetRow ( std::move(orig.mIsSetRow) )
+  , mCol ( std::move(orig.mCol) )
+  , mIsSetCol ( std::move(orig.mIsSetCol) )
+  , mRowSpan ( std::move(orig.mRowSpan) )
+  , mIsSetRowSpan ( std::move(orig.mIsSetRowSpan) )
+  , mColSpan ( std::move(orig.mColSpan) )
+  , mIsSetColSpan ( std::move(orig.mIsSetColSpan) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedSubPlot.
+ */
+SedSubPlot&
+SedSubPlot::operator=(SedSubPlot&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mPlot = std::move(rhs.mPlot);
+    mRow = std::move(rhs.mRow);
+    mIsSetRow = std::move(rhs.mIsSetRow);
+    mCol = std::move(rhs.mCol);
+    mIsSetCol = std::move(rhs.mIsSetCol);
+    mRowSpan = std::move(rhs.mRowSpan);
+    mIsSetRowSpan = std::move(rhs.mIsSetRowSpan);
+    mColSpan = std::move(rhs.mColSpan);
+    mIsSetColSpan = std::move(rhs.mIsSetColSpan);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSubPlot object.
  */
@@ -258,6 +299,7 @@ SedSubPlot::setPlot(const std::string& plot)
   }
   else
   {
+    sIdRefChanged(mPlot, plot);
     mPlot = plot;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -318,6 +360,7 @@ SedSubPlot::setColSpan(int colSpan)
 int
 SedSubPlot::unsetPlot()
 {
+  sIdRefChanged(mPlot, std::string());
   mPlot.erase();
 
   if (mPlot.empty() == true)
@@ -424,6 +467,19 @@ SedSubPlot::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedSubPlot to refs.
+ */
+void
+SedSubPlot::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetPlot())
+  {
+    refs.push_back(mPlot);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedSubPlot object.
  */
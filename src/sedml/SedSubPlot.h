@@ -120,6 +120,27 @@ public:
   SedSubPlot& operator=(const SedSubPlot& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSubPlot.
+   *
+   * @param orig the SedSubPlot instance to move from; it is left empty.
+   */
+  SedSubPlot(SedSubPlot&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSubPlot.
+   *
+   * @param rhs the SedSubPlot object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSubPlot& operator=(SedSubPlot&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSubPlot object.
    *
@@ -345,6 +366,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedSubPlot object.
    *
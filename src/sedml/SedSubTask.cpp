@@ -58,7 +58,6 @@ SedSubTask::SedSubTask(unsigned int level, unsigned int version)
   , mTask ("")
   , mSetValues (level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -108,6 +107,38 @@ SedSubTask::operator=(const SedSubTask& rhs)
 }
 
 
+/*
+ * Move constructor for SedSubTask.
+ */
+SedSubTask::SedSubTask(SedSubTask&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mOrder ( std::move(orig.mOrder) )
+  , mIsSetOrder ( std::move(orig.mIsSetOrder) )
+  , mTask ( std::move(orig.mTask) )
+  , mSetValues ( std::move(orig.mSetValues) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedSubTask.
+ */
+SedSubTask&
+SedSubTask::operator=(SedSubTask&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mOrder = std::move(rhs.mOrder);
+    mIsSetOrder = std::move(rhs.mIsSetOrder);
+    mTask = std::move(rhs.mTask);
+    mSetValues = std::move(rhs.mSetValues);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSubTask object.
  */
@@ -190,6 +221,7 @@ SedSubTask::setTask(const std::string& task)
   }
   else
   {
+    sIdRefChanged(mTask, task);
     mTask = task;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -222,6 +254,7 @@ SedSubTask::unsetOrder()
 int
 SedSubTask::unsetTask()
 {
+  sIdRefChanged(mTask, std::string());
   mTask.erase();
 
   if (mTask.empty() == true)
@@ -436,6 +469,19 @@ SedSubTask::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedSubTask to refs.
+ */
+void
+SedSubTask::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetTask())
+  {
+    refs.push_back(mTask);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedSubTask object.
  */
@@ -709,6 +755,20 @@ SedSubTask::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedSubTask
+ */
+void
+SedSubTask::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mSetValues, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
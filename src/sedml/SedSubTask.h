@@ -116,6 +116,27 @@ public:
   SedSubTask& operator=(const SedSubTask& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSubTask.
+   *
+   * @param orig the SedSubTask instance to move from; it is left empty.
+   */
+  SedSubTask(SedSubTask&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSubTask.
+   *
+   * @param rhs the SedSubTask object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSubTask& operator=(SedSubTask&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSubTask object.
    *
@@ -457,6 +478,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedSubTask object.
    *
@@ -895,6 +922,16 @@ public:
   virtual List* getAllElements(SedElementFilter* filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedSubTask.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
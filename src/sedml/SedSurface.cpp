@@ -67,7 +67,6 @@ SedSurface::SedSurface(unsigned int level, unsigned int version)
   , mOrder (SEDML_INT_MAX)
   , mIsSetOrder (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   mNameAllowedPreV4 = true;
   mIdAllowedPreV4 = true;
 }
@@ -148,6 +147,56 @@ SedSurface::operator=(const SedSurface& rhs)
 }
 
 
+/*
+ * Move constructor for SedSurface.
+ */
+SedSurface::SedSurface(SedSurface&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mXDataReference ( std::move(orig.mXDataReference) )
+  , mYDataReference ( std::move(orig.mYDataReference) )
+  , mZDataReference ( std::move(orig.mZDataReference) )
+  , mType ( std::move(orig.mType) )
+  , mStyle ( std::move(orig.mStyle) )
+  , mLogX ( std::move(orig.mLogX) )
+  , mIsSetLogX ( std::move(orig.mIsSetLogX) )
+  , mLogY ( std::move(orig.mLogY) )
+  , mIsSetLogY ( std::move(orig.mIsSetLogY) )
+  , mLogZ ( std::move(orig.mLogZ) )
+  , mIsSetLogZ ( std::move(orig.mIsSetLogZ) )
+  , mOrder ( std::move(orig.mOrder) )
+  , mIsSetOrder ( std::move(orig.mIsSetOrder) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedSurface.
+ */
+SedSurface&
+SedSurface::operator=(SedSurface&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mXDataReference = std::move(rhs.mXDataReference);
+    mYDataReference = std::move(rhs.mYDataReference);
+    mZDataReference = std::move(rhs.mZDataReference);
+    mType = std::move(rhs.mType);
+    mStyle = std::move(rhs.mStyle);
+    mLogX = std::move(rhs.mLogX);
+    mIsSetLogX = std::move(rhs.mIsSetLogX);
+    mLogY = std::move(rhs.mLogY);
+    mIsSetLogY = std::move(rhs.mIsSetLogY);
+    mLogZ = std::move(rhs.mLogZ);
+    mIsSetLogZ = std::move(rhs.mIsSetLogZ);
+    mOrder = std::move(rhs.mOrder);
+    mIsSetOrder = std::move(rhs.mIsSetOrder);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedSurface object.
  */
@@ -372,6 +421,7 @@ SedSurface::setXDataReference(const std::string& xDataReference)
   }
   else
   {
+    sIdRefChanged(mXDataReference, xDataReference);
     mXDataReference = xDataReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -390,6 +440,7 @@ SedSurface::setYDataReference(const std::string& yDataReference)
   }
   else
   {
+    sIdRefChanged(mYDataReference, yDataReference);
     mYDataReference = yDataReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -408,6 +459,7 @@ SedSurface::setZDataReference(const std::string& zDataReference)
   }
   else
   {
+    sIdRefChanged(mZDataReference, zDataReference);
     mZDataReference = zDataReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -462,6 +514,7 @@ SedSurface::setStyle(const std::string& style)
   }
   else
   {
+    sIdRefChanged(mStyle, style);
     mStyle = style;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -522,6 +575,7 @@ SedSurface::setOrder(int order)
 int
 SedSurface::unsetXDataReference()
 {
+  sIdRefChanged(mXDataReference, std::string());
   mXDataReference.erase();
 
   if (mXDataReference.empty() == true)
@@ -541,6 +595,7 @@ SedSurface::unsetXDataReference()
 int
 SedSurface::unsetYDataReference()
 {
+  sIdRefChanged(mYDataReference, std::string());
   mYDataReference.erase();
 
   if (mYDataReference.empty() == true)
@@ -560,6 +615,7 @@ SedSurface::unsetYDataReference()
 int
 SedSurface::unsetZDataReference()
 {
+  sIdRefChanged(mZDataReference, std::string());
   mZDataReference.erase();
 
   if (mZDataReference.empty() == true)
@@ -590,6 +646,7 @@ SedSurface::unsetType()
 int
 SedSurface::unsetStyle()
 {
+  sIdRefChanged(mStyle, std::string());
   mStyle.erase();
 
   if (mStyle.empty() == true)
@@ -711,6 +768,34 @@ SedSurface::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedSurface to refs.
+ */
+void
+SedSurface::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetXDataReference())
+  {
+    refs.push_back(mXDataReference);
+  }
+
+  if (isSetYDataReference())
+  {
+    refs.push_back(mYDataReference);
+  }
+
+  if (isSetZDataReference())
+  {
+    refs.push_back(mZDataReference);
+  }
+
+  if (isSetStyle())
+  {
+    refs.push_back(mStyle);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedSurface object.
  */
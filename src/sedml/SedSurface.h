@@ -160,6 +160,27 @@ public:
   SedSurface& operator=(const SedSurface& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedSurface.
+   *
+   * @param orig the SedSurface instance to move from; it is left empty.
+   */
+  SedSurface(SedSurface&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedSurface.
+   *
+   * @param rhs the SedSurface object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedSurface& operator=(SedSurface&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedSurface object.
    *
@@ -605,6 +626,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedSurface object.
    *
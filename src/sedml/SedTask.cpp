@@ -55,7 +55,6 @@ SedTask::SedTask(unsigned int level, unsigned int version)
   , mModelReference ("")
   , mSimulationReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -99,6 +98,34 @@ SedTask::operator=(const SedTask& rhs)
 }
 
 
+/*
+ * Move constructor for SedTask.
+ */
+SedTask::SedTask(SedTask&& orig) noexcept
+  : SedAbstractTask( std::move(orig) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mSimulationReference ( std::move(orig.mSimulationReference) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedTask.
+ */
+SedTask&
+SedTask::operator=(SedTask&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedAbstractTask::operator=(std::move(rhs));
+    mModelReference = std::move(rhs.mModelReference);
+    mSimulationReference = std::move(rhs.mSimulationReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedTask object.
  */
@@ -171,6 +198,7 @@ SedTask::setModelReference(const std::string& modelReference)
   }
   else
   {
+    sIdRefChanged(mModelReference, modelReference);
     mModelReference = modelReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -189,6 +217,7 @@ SedTask::setSimulationReference(const std::string& simulationReference)
   }
   else
   {
+    sIdRefChanged(mSimulationReference, simulationReference);
     mSimulationReference = simulationReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -201,6 +230,7 @@ SedTask::setSimulationReference(const std::string& simulationReference)
 int
 SedTask::unsetModelReference()
 {
+  sIdRefChanged(mModelReference, std::string());
   mModelReference.erase();
 
   if (mModelReference.empty() == true)
@@ -220,6 +250,7 @@ SedTask::unsetModelReference()
 int
 SedTask::unsetSimulationReference()
 {
+  sIdRefChanged(mSimulationReference, std::string());
   mSimulationReference.erase();
 
   if (mSimulationReference.empty() == true)
@@ -251,6 +282,24 @@ SedTask::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedTask to refs.
+ */
+void
+SedTask::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetModelReference())
+  {
+    refs.push_back(mModelReference);
+  }
+
+  if (isSetSimulationReference())
+  {
+    refs.push_back(mSimulationReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedTask object.
  */
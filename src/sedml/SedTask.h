@@ -111,6 +111,27 @@ public:
   SedTask& operator=(const SedTask& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedTask.
+   *
+   * @param orig the SedTask instance to move from; it is left empty.
+   */
+  SedTask(SedTask&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedTask.
+   *
+   * @param rhs the SedTask object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedTask& operator=(SedTask&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedTask object.
    *
@@ -218,6 +239,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedTask object.
    *
@@ -105,7 +105,12 @@
 #include <sedml/SedParameterEstimationReport.h>
 
 #include <sedml/SedReader.h>
+#include <sedml/SedStreamHandler.h>
 #include <sedml/SedWriter.h>
+#include <sedml/SedKisao.h>
+#include <sedml/SedRangeExpansion.h>
+#include <sedml/SedCompiledMath.h>
+#include <sedml/SedExecutionPlan.h>
 
 #include <sbml/math/FormulaFormatter.h>  
 
@@ -61,7 +61,6 @@ SedUniformRange::SedUniformRange(unsigned int level, unsigned int version)
   , mIsSetNumberOfSteps (false)
   , mType ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -121,6 +120,44 @@ SedUniformRange::operator=(const SedUniformRange& rhs)
 }
 
 
+/*
+ * Move constructor for SedUniformRange.
+ */
+SedUniformRange::SedUniformRange(SedUniformRange&& orig) noexcept
+  : SedRange( std::move(orig) )
+  , mStart ( std::move(orig.mStart) )
+  , mIsSetStart ( std::move(orig.mIsSetStart) )
+  , mEnd ( std::move(orig.mEnd) )
+  , mIsSetEnd ( std::move(orig.mIsSetEnd) )
+  , mNumberOfSteps ( std::move(orig.mNumberOfSteps) )
+  , mIsSetNumberOfSteps ( std::move(orig.mIsSetNumberOfSteps) )
+  , mType ( std::move(orig.mType) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedUniformRange.
+ */
+SedUniformRange&
+SedUniformRange::operator=(SedUniformRange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mStart = std::move(rhs.mStart);
+    mIsSetStart = std::move(rhs.mIsSetStart);
+    mEnd = std::move(rhs.mEnd);
+    mIsSetEnd = std::move(rhs.mIsSetEnd);
+    mNumberOfSteps = std::move(rhs.mNumberOfSteps);
+    mIsSetNumberOfSteps = std::move(rhs.mIsSetNumberOfSteps);
+    mType = std::move(rhs.mType);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedUniformRange object.
  */
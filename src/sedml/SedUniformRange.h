@@ -119,6 +119,27 @@ public:
   SedUniformRange& operator=(const SedUniformRange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedUniformRange.
+   *
+   * @param orig the SedUniformRange instance to move from; it is left empty.
+   */
+  SedUniformRange(SedUniformRange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedUniformRange.
+   *
+   * @param rhs the SedUniformRange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedUniformRange& operator=(SedUniformRange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedUniformRange object.
    *
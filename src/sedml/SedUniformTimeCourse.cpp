@@ -63,7 +63,6 @@ SedUniformTimeCourse::SedUniformTimeCourse(unsigned int level,
   , mNumberOfSteps (SEDML_INT_MAX)
   , mIsSetNumberOfSteps (false)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -126,6 +125,46 @@ SedUniformTimeCourse::operator=(const SedUniformTimeCourse& rhs)
 }
 
 
+/*
+ * Move constructor for SedUniformTimeCourse.
+ */
+SedUniformTimeCourse::SedUniformTimeCourse(SedUniformTimeCourse&& orig) noexcept
+  : SedSimulation( std::move(orig) )
+  , mInitialTime ( std::move(orig.mInitialTime) )
+  , mIsSetInitialTime ( std::move(orig.mIsSetInitialTime) )
+  , mOutputStartTime ( std::move(orig.mOutputStartTime) )
+  , mIsSetOutputStartTime ( std::move(orig.mIsSetOutputStartTime) )
+  , mOutputEndTime ( std::move(orig.mOutputEndTime) )
+  , mIsSetOutputEndTime ( std::move(orig.mIsSetOutputEndTime) )
+  , mNumberOfSteps ( std::move(orig.mNumberOfSteps) )
+  , mIsSetNumberOfSteps ( std::move(orig.mIsSetNumberOfSteps) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedUniformTimeCourse.
+ */
+SedUniformTimeCourse&
+SedUniformTimeCourse::operator=(SedUniformTimeCourse&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedSimulation::operator=(std::move(rhs));
+    mInitialTime = std::move(rhs.mInitialTime);
+    mIsSetInitialTime = std::move(rhs.mIsSetInitialTime);
+    mOutputStartTime = std::move(rhs.mOutputStartTime);
+    mIsSetOutputStartTime = std::move(rhs.mIsSetOutputStartTime);
+    mOutputEndTime = std::move(rhs.mOutputEndTime);
+    mIsSetOutputEndTime = std::move(rhs.mIsSetOutputEndTime);
+    mNumberOfSteps = std::move(rhs.mNumberOfSteps);
+    mIsSetNumberOfSteps = std::move(rhs.mIsSetNumberOfSteps);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedUniformTimeCourse object.
  */
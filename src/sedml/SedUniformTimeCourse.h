@@ -120,6 +120,27 @@ public:
   SedUniformTimeCourse& operator=(const SedUniformTimeCourse& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedUniformTimeCourse.
+   *
+   * @param orig the SedUniformTimeCourse instance to move from; it is left empty.
+   */
+  SedUniformTimeCourse(SedUniformTimeCourse&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedUniformTimeCourse.
+   *
+   * @param rhs the SedUniformTimeCourse object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedUniformTimeCourse& operator=(SedUniformTimeCourse&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedUniformTimeCourse object.
    *
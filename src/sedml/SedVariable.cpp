@@ -64,7 +64,6 @@ SedVariable::SedVariable(unsigned int level, unsigned int version)
   , mTarget2 ("")
   , mDimensionTerm ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
   connectToChild();
   mIdAllowedPreV4 = true;
   mNameAllowedPreV4 = true;
@@ -137,6 +136,50 @@ SedVariable::operator=(const SedVariable& rhs)
 }
 
 
+/*
+ * Move constructor for SedVariable.
+ */
+SedVariable::SedVariable(SedVariable&& orig) noexcept
+  : SedBase( std::move(orig) )
+  , mSymbol ( std::move(orig.mSymbol) )
+  , mTarget ( std::move(orig.mTarget) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+  , mModelReference ( std::move(orig.mModelReference) )
+  , mAppliedDimensions ( std::move(orig.mAppliedDimensions) )
+  , mTerm ( std::move(orig.mTerm) )
+  , mSymbol2 ( std::move(orig.mSymbol2) )
+  , mTarget2 ( std::move(orig.mTarget2) )
+  , mDimensionTerm ( std::move(orig.mDimensionTerm) )
+{
+  connectToChild();
+}
+
+
+/*
+ * Move assignment operator for SedVariable.
+ */
+SedVariable&
+SedVariable::operator=(SedVariable&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedBase::operator=(std::move(rhs));
+    mSymbol = std::move(rhs.mSymbol);
+    mTarget = std::move(rhs.mTarget);
+    mTaskReference = std::move(rhs.mTaskReference);
+    mModelReference = std::move(rhs.mModelReference);
+    mAppliedDimensions = std::move(rhs.mAppliedDimensions);
+    mTerm = std::move(rhs.mTerm);
+    mSymbol2 = std::move(rhs.mSymbol2);
+    mTarget2 = std::move(rhs.mTarget2);
+    mDimensionTerm = std::move(rhs.mDimensionTerm);
+    connectToChild();
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedVariable object.
  */
@@ -354,6 +397,7 @@ SedVariable::setTaskReference(const std::string& taskReference)
   }
   else
   {
+    sIdRefChanged(mTaskReference, taskReference);
     mTaskReference = taskReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -372,6 +416,7 @@ SedVariable::setModelReference(const std::string& modelReference)
   }
   else
   {
+    sIdRefChanged(mModelReference, modelReference);
     mModelReference = modelReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -466,6 +511,7 @@ SedVariable::unsetTarget()
 int
 SedVariable::unsetTaskReference()
 {
+  sIdRefChanged(mTaskReference, std::string());
   mTaskReference.erase();
 
   if (mTaskReference.empty() == true)
@@ -485,6 +531,7 @@ SedVariable::unsetTaskReference()
 int
 SedVariable::unsetModelReference()
 {
+  sIdRefChanged(mModelReference, std::string());
   mModelReference.erase();
 
   if (mModelReference.empty() == true)
@@ -757,6 +804,24 @@ SedVariable::renameSIdRefs(const std::string& oldid, const std::string& newid)
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedVariable to refs.
+ */
+void
+SedVariable::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(mTaskReference);
+  }
+
+  if (isSetModelReference())
+  {
+    refs.push_back(mModelReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedVariable object.
  */
@@ -1378,6 +1443,20 @@ SedVariable::getAllElements(SedElementFilter* filter)
 }
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Calls visit on each child of this SedVariable
+ */
+void
+SedVariable::visitChildren(ChildVisitor visit, void* data)
+{
+  visit(&mAppliedDimensions, data);
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenLibSEDMLInternal */
 
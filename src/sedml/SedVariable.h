@@ -121,6 +121,27 @@ public:
   SedVariable& operator=(const SedVariable& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedVariable.
+   *
+   * @param orig the SedVariable instance to move from; it is left empty.
+   */
+  SedVariable(SedVariable&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedVariable.
+   *
+   * @param rhs the SedVariable object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedVariable& operator=(SedVariable&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedVariable object.
    *
@@ -708,6 +729,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedVariable object.
    *
@@ -1145,6 +1172,16 @@ public:
   virtual List* getAllElements(SedElementFilter * filter = NULL);
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Calls @p visit on each child of this SedVariable.
+   */
+  virtual void visitChildren(ChildVisitor visit, void* data);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -32,7 +32,17 @@
  * ------------------------------------------------------------------------ -->
  */
 #include <sedml/SedVectorRange.h>
+#include <sedml/SedDocument.h>
+#include <sedml/SedMappedFile.h>
 #include <sbml/xml/XMLInputStream.h>
+#include <sbml/util/util.h>
+
+#include <cctype>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 
 
 using namespace std;
@@ -47,6 +57,166 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 #ifdef __cplusplus
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * The namespace of the <binaryValues> element libSEDML writes in place of
+ * the "value" elements when the values are stored in binary.
+ */
+static const char* const BINARY_VALUES_URI =
+  "http://sed-ml.org/libsedml/binaryValues";
+static const char* const BINARY_VALUES_PREFIX = "libsedml";
+
+
+/*
+ * Returns true if doubles are stored little-endian on this machine, so that
+ * binary values can be used without conversion.
+ */
+static bool
+isLittleEndian()
+{
+  const double one = 1.0;
+  return reinterpret_cast<const unsigned char*>(&one)[sizeof(double) - 1] != 0;
+}
+
+
+/*
+ * Appends count doubles, stored little-endian at data, to values.
+ */
+static void
+appendLittleEndian(std::vector<double>& values, const char* data, size_t count)
+{
+  size_t start = values.size();
+  values.resize(start + count);
+  memcpy(&values[start], data, count * sizeof(double));
+
+  if (!isLittleEndian())
+  {
+    char* bytes = reinterpret_cast<char*>(&values[start]);
+    for (size_t i = 0; i < count; ++i, bytes += sizeof(double))
+    {
+      for (size_t j = 0; j < sizeof(double) / 2; ++j)
+      {
+        std::swap(bytes[j], bytes[sizeof(double) - 1 - j]);
+      }
+    }
+  }
+}
+
+
+/*
+ * Returns the given doubles as little-endian bytes.
+ */
+static std::string
+toLittleEndian(const double* values, size_t count)
+{
+  std::string bytes(reinterpret_cast<const char*>(values),
+                    count * sizeof(double));
+
+  if (!isLittleEndian())
+  {
+    for (size_t i = 0; i < bytes.size(); i += sizeof(double))
+    {
+      for (size_t j = 0; j < sizeof(double) / 2; ++j)
+      {
+        std::swap(bytes[i + j], bytes[i + sizeof(double) - 1 - j]);
+      }
+    }
+  }
+
+  return bytes;
+}
+
+
+static const char BASE64_DIGITS[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+
+/*
+ * Returns the base64 encoding of the given bytes.
+ */
+static std::string
+encodeBase64(const std::string& bytes)
+{
+  std::string text;
+  text.reserve((bytes.size() + 2) / 3 * 4);
+
+  size_t i = 0;
+  for (; i + 2 < bytes.size(); i += 3)
+  {
+    unsigned long group = ((unsigned long)(unsigned char)bytes[i] << 16)
+      | ((unsigned long)(unsigned char)bytes[i + 1] << 8)
+      | (unsigned long)(unsigned char)bytes[i + 2];
+    text += BASE64_DIGITS[(group >> 18) & 63];
+    text += BASE64_DIGITS[(group >> 12) & 63];
+    text += BASE64_DIGITS[(group >> 6) & 63];
+    text += BASE64_DIGITS[group & 63];
+  }
+
+  if (i < bytes.size())
+  {
+    unsigned long group = (unsigned long)(unsigned char)bytes[i] << 16;
+    if (i + 1 < bytes.size())
+    {
+      group |= (unsigned long)(unsigned char)bytes[i + 1] << 8;
+    }
+    text += BASE64_DIGITS[(group >> 18) & 63];
+    text += BASE64_DIGITS[(group >> 12) & 63];
+    text += (i + 1 < bytes.size()) ? BASE64_DIGITS[(group >> 6) & 63] : '=';
+    text += '=';
+  }
+
+  return text;
+}
+
+
+/*
+ * Decodes base64 text, ignoring whitespace; returns false if the text holds
+ * anything else that is not base64.
+ */
+static bool
+decodeBase64(const std::string& text, std::string& bytes)
+{
+  unsigned long group = 0;
+  int bits = 0;
+
+  bytes.clear();
+  bytes.reserve(text.size() / 4 * 3);
+
+  for (std::string::const_iterator it = text.begin(); it != text.end(); ++it)
+  {
+    const char c = *it;
+    if (c == '=')
+    {
+      break;
+    }
+    if (isspace((unsigned char)(c)))
+    {
+      continue;
+    }
+
+    const char* digit = strchr(BASE64_DIGITS, c);
+    if (digit == NULL || c == '\0')
+    {
+      return false;
+    }
+
+    group = (group << 6) | (unsigned long)(digit - BASE64_DIGITS);
+    bits += 6;
+    if (bits >= 8)
+    {
+      bits -= 8;
+      bytes += (char)((group >> bits) & 0xFF);
+    }
+  }
+
+  return true;
+}
+
+/** @endcond */
+
+
+
 /*
  * Creates a new SedVectorRange using the given SED-ML Level and @ p version
  * values.
@@ -54,8 +224,10 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 SedVectorRange::SedVectorRange(unsigned int level, unsigned int version)
   : SedRange(level, version)
   , mValue ()
+  , mValuesEncoding (SEDML_VALUESENCODING_TEXT)
+  , mValuesSource ("")
+  , mValuesFile ()
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -66,6 +238,9 @@ SedVectorRange::SedVectorRange(unsigned int level, unsigned int version)
 SedVectorRange::SedVectorRange(SedNamespaces *sedmlns)
   : SedRange(sedmlns)
   , mValue ()
+  , mValuesEncoding (SEDML_VALUESENCODING_TEXT)
+  , mValuesSource ("")
+  , mValuesFile ()
 {
   setElementNamespace(sedmlns->getURI());
 }
@@ -77,6 +252,9 @@ SedVectorRange::SedVectorRange(SedNamespaces *sedmlns)
 SedVectorRange::SedVectorRange(const SedVectorRange& orig)
   : SedRange( orig )
   , mValue ( orig.mValue )
+  , mValuesEncoding ( orig.mValuesEncoding )
+  , mValuesSource ( orig.mValuesSource )
+  , mValuesFile ( orig.mValuesFile )
 {
 }
 
@@ -91,6 +269,41 @@ SedVectorRange::operator=(const SedVectorRange& rhs)
   {
     SedRange::operator=(rhs);
     mValue = rhs.mValue;
+    mValuesEncoding = rhs.mValuesEncoding;
+    mValuesSource = rhs.mValuesSource;
+    mValuesFile = rhs.mValuesFile;
+  }
+
+  return *this;
+}
+
+
+/*
+ * Move constructor for SedVectorRange.
+ */
+SedVectorRange::SedVectorRange(SedVectorRange&& orig) noexcept
+  : SedRange( std::move(orig) )
+  , mValue ( std::move(orig.mValue) )
+  , mValuesEncoding ( std::move(orig.mValuesEncoding) )
+  , mValuesSource ( std::move(orig.mValuesSource) )
+  , mValuesFile ( std::move(orig.mValuesFile) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedVectorRange.
+ */
+SedVectorRange&
+SedVectorRange::operator=(SedVectorRange&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedRange::operator=(std::move(rhs));
+    mValue = std::move(rhs.mValue);
+    mValuesEncoding = std::move(rhs.mValuesEncoding);
+    mValuesSource = std::move(rhs.mValuesSource);
+    mValuesFile = std::move(rhs.mValuesFile);
   }
 
   return *this;
@@ -121,10 +334,26 @@ SedVectorRange::~SedVectorRange()
 const std::vector<double>&
 SedVectorRange::getValues() const
 {
+  materializeValues();
   return mValue;
 }
 
 
+/*
+ * Returns the values of this SedVectorRange as an array.
+ */
+const double*
+SedVectorRange::getValuesData() const
+{
+  if (mValuesFile != NULL)
+  {
+    return reinterpret_cast<const double*>(mValuesFile->getData());
+  }
+
+  return mValue.empty() ? NULL : &mValue[0];
+}
+
+
 /*
  * Predicate returning @c true if this SedVectorRange's "value" attribute is
  * set.
@@ -132,7 +361,7 @@ SedVectorRange::getValues() const
 bool
 SedVectorRange::hasValues() const
 {
-  return mValue.size() > 0;
+  return getNumValues() > 0;
 }
 
 
@@ -142,6 +371,11 @@ SedVectorRange::hasValues() const
 unsigned int
 SedVectorRange::getNumValues() const
 {
+  if (mValuesFile != NULL)
+  {
+    return (unsigned int)(mValuesFile->getSize() / sizeof(double));
+  }
+
   return (unsigned int)(mValue.size());
 }
 
@@ -152,17 +386,153 @@ SedVectorRange::getNumValues() const
 int
 SedVectorRange::setValues(const std::vector<double>& value)
 {
+  detachValuesSource();
   mValue = value;
   return LIBSEDML_OPERATION_SUCCESS;
 }
 
 
+/*
+ * Sets the value of the "value" attribute of this SedVectorRange, taking over
+ * the storage of the given vector.
+ */
+int
+SedVectorRange::setValues(std::vector<double>&& value)
+{
+  detachValuesSource();
+  mValue = std::move(value);
+  value.clear();
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "value" attribute of this SedVectorRange from an
+ * array of doubles.
+ */
+int
+SedVectorRange::setValues(const double* values, unsigned int numValues)
+{
+  if (values == NULL && numValues > 0)
+  {
+    return LIBSEDML_INVALID_OBJECT;
+  }
+
+  detachValuesSource();
+  mValue.assign(values, values + numValues);
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns the encoding used when writing the values of this SedVectorRange.
+ */
+ValuesEncoding_t
+SedVectorRange::getValuesEncoding() const
+{
+  return mValuesEncoding;
+}
+
+
+/*
+ * Sets the encoding used when writing the values of this SedVectorRange.
+ */
+int
+SedVectorRange::setValuesEncoding(ValuesEncoding_t encoding)
+{
+  if (ValuesEncoding_isValid(encoding) == 0)
+  {
+    return LIBSEDML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  if (encoding == SEDML_VALUESENCODING_EXTERNAL && !isSetValuesSource())
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  mValuesEncoding = encoding;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Returns the name of the binary file holding the values.
+ */
+const std::string&
+SedVectorRange::getValuesSource() const
+{
+  return mValuesSource;
+}
+
+
+/*
+ * Predicate returning @c true if the values are held in a binary file.
+ */
+bool
+SedVectorRange::isSetValuesSource() const
+{
+  return !mValuesSource.empty();
+}
+
+
+/*
+ * Makes this SedVectorRange use the values held in a binary file.
+ */
+int
+SedVectorRange::setValuesSource(const std::string& filename)
+{
+  if (filename.empty() || !mapValuesFile(filename))
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Writes the values to a binary file and makes this SedVectorRange refer to
+ * it.
+ */
+int
+SedVectorRange::writeValuesFile(const std::string& filename)
+{
+  if (filename.empty())
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  const std::string bytes = toLittleEndian(getValuesData(), getNumValues());
+
+  FILE* file = fopen(resolveValuesFile(filename).c_str(), "wb");
+  if (file == NULL)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  const bool written =
+    fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+  if (fclose(file) != 0 || !written)
+  {
+    return LIBSEDML_OPERATION_FAILED;
+  }
+
+  // the values stay in memory; the file is only mapped when read back
+  materializeValues();
+  mValuesFile.reset();
+  mValuesSource = filename;
+  mValuesEncoding = SEDML_VALUESENCODING_EXTERNAL;
+  return LIBSEDML_OPERATION_SUCCESS;
+}
+
+
 /*
  * Adds another value to the "value" attribute of this SedVectorRange.
  */
 int
 SedVectorRange::addValue(double value)
 {
+  detachValuesSource();
   mValue.push_back(value);
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -174,6 +544,7 @@ SedVectorRange::addValue(double value)
 int
 SedVectorRange::clearValues()
 {
+  detachValuesSource();
   mValue.clear();
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -225,14 +596,29 @@ SedVectorRange::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 {
   SedRange::writeElements(stream);
 
-  if (hasValues())
+  if (mValuesEncoding != SEDML_VALUESENCODING_TEXT)
   {
+    writeBinaryValues(stream);
+  }
+  else if (hasValues())
+  {
+    materializeValues();
+
+    // each value is formatted into a local buffer and written as a single
+    // string, rather than going through the stream's own double formatting
+    char buffer[34];
+    buffer[0] = ' ';
+
     for (std::vector<double>::const_iterator it = mValue.begin(); it !=
       mValue.end(); ++it)
     {
+      size_t length = formatValue(*it, buffer + 1);
+      buffer[length + 1] = ' ';
+      buffer[length + 2] = '\0';
+
       stream.startElement("value");
       stream.setAutoIndent(false);
-      stream << " " << *it << " ";
+      stream << buffer;
       stream.endElement("value");
       stream.setAutoIndent(true);
     }
@@ -243,6 +629,96 @@ SedVectorRange::writeElements(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Parses a single number independent of the current C locale.
+ */
+bool
+SedVectorRange::parseValue(const char* text, double& value)
+{
+  if (text == NULL)
+  {
+    return false;
+  }
+
+  while (isspace((unsigned char)(*text)))
+  {
+    ++text;
+  }
+
+  // strtod honours the decimal point of the current locale; only take the
+  // slower locale-switching route when that is not '.'
+  char* end = NULL;
+  const char* point = localeconv()->decimal_point;
+  if (point != NULL && point[0] == '.' && point[1] == '\0')
+  {
+    value = strtod(text, &end);
+  }
+  else
+  {
+    value = c_locale_strtod(text, &end);
+  }
+
+  return end != NULL && end != text;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Formats a double as the shortest text that reads back to the same value.
+ */
+size_t
+SedVectorRange::formatValue(double value, char* buffer)
+{
+  if (util_isNaN(value))
+  {
+    strcpy(buffer, "NaN");
+    return 3;
+  }
+
+  if (util_isInf(value))
+  {
+    strcpy(buffer, value > 0 ? "INF" : "-INF");
+    return value > 0 ? 3 : 4;
+  }
+
+  // 17 significant digits always round-trip; try the shorter forms first so
+  // that values such as 0.1 are written as they were read
+  const char* decimalPoint = localeconv()->decimal_point;
+  int length = 0;
+  for (int precision = 15; precision <= 17; ++precision)
+  {
+    length = snprintf(buffer, 32, "%.*g", precision, value);
+
+    if (decimalPoint != NULL && decimalPoint[0] != '.'
+      && decimalPoint[0] != '\0' && decimalPoint[1] == '\0')
+    {
+      char* point = strchr(buffer, decimalPoint[0]);
+      if (point != NULL)
+      {
+        *point = '.';
+      }
+    }
+
+    double check;
+    if (precision == 17 || (parseValue(buffer, check) && check == value))
+    {
+      break;
+    }
+  }
+
+  return (size_t)(length);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
@@ -584,19 +1060,26 @@ SedVectorRange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
   stream)
 {
   bool read = false;
+  string text;
+
+  if (stream.peek().getName() == "binaryValues"
+    && stream.peek().getURI() == BINARY_VALUES_URI)
+  {
+    readBinaryValues(stream);
+    read = true;
+  }
 
   while (stream.peek().getName() == "value")
   {
     stream.next();
-    stringstream text;
+    text.clear();
     while (stream.isGood() && stream.peek().isText())
     {
-      text << stream.next().getCharacters();
+      text += stream.next().getCharacters();
     }
 
     double value;
-    text >> value;
-    if (!text.fail())
+    if (parseValue(text.c_str(), value))
     {
       mValue.push_back(value);
     }
@@ -617,6 +1100,242 @@ SedVectorRange::readOtherXML(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Reads a <libsedml:binaryValues> element
+ */
+void
+SedVectorRange::readBinaryValues(LIBSBML_CPP_NAMESPACE_QUALIFIER
+  XMLInputStream& stream)
+{
+  const LIBSBML_CPP_NAMESPACE_QUALIFIER XMLToken element = stream.next();
+  const std::string source = element.getAttrValue("source");
+  const std::string count = element.getAttrValue("count");
+  std::string details;
+
+  if (!source.empty())
+  {
+    if (!mapValuesFile(source))
+    {
+      details = "The binary values file '" + source + "' of the "
+        "<vectorRange> could not be read.";
+    }
+  }
+  else
+  {
+    std::string text;
+    while (stream.isGood() && stream.peek().isText())
+    {
+      text += stream.next().getCharacters();
+    }
+
+    std::string bytes;
+    if (!decodeBase64(text, bytes) || bytes.size() % sizeof(double) != 0)
+    {
+      details = "The <libsedml:binaryValues> of the <vectorRange> do not "
+        "hold base64-encoded doubles.";
+    }
+    else
+    {
+      detachValuesSource();
+      mValue.clear();
+      appendLittleEndian(mValue, bytes.data(), bytes.size() / sizeof(double));
+      mValuesEncoding = SEDML_VALUESENCODING_BASE64;
+    }
+  }
+
+  if (details.empty() && !count.empty()
+    && strtoul(count.c_str(), NULL, 10) != getNumValues())
+  {
+    details = "The <libsedml:binaryValues> of the <vectorRange> hold a "
+      "different number of values than their 'count' of " + count + ".";
+  }
+
+  if (!details.empty())
+  {
+    logError(SedmlVectorRangeValueMustBeString, getLevel(), getVersion(),
+      details, element.getLine(), element.getColumn());
+  }
+
+  stream.skipPastEnd(element);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Writes the values as a <libsedml:binaryValues> element
+ */
+void
+SedVectorRange::writeBinaryValues(LIBSBML_CPP_NAMESPACE_QUALIFIER
+  XMLOutputStream& stream) const
+{
+  const bool external = mValuesEncoding == SEDML_VALUESENCODING_EXTERNAL
+    && isSetValuesSource();
+
+  stream.startElement("binaryValues", BINARY_VALUES_PREFIX);
+  stream.writeAttribute(std::string("xmlns:") + BINARY_VALUES_PREFIX,
+    std::string(BINARY_VALUES_URI));
+  stream.writeAttribute("count", std::to_string(getNumValues()));
+
+  if (external)
+  {
+    stream.writeAttribute("source", mValuesSource);
+  }
+  else
+  {
+    stream.writeAttribute("encoding",
+      std::string(ValuesEncoding_toString(SEDML_VALUESENCODING_BASE64)));
+    stream.setAutoIndent(false);
+    stream << encodeBase64(toLittleEndian(getValuesData(), getNumValues()));
+  }
+
+  stream.endElement("binaryValues", BINARY_VALUES_PREFIX);
+  stream.setAutoIndent(true);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Maps the given values file, replacing the current values
+ */
+bool
+SedVectorRange::mapValuesFile(const std::string& filename)
+{
+  std::shared_ptr<SedMappedFile> file =
+    std::make_shared<SedMappedFile>(resolveValuesFile(filename));
+
+  if (file->getData() == NULL || file->getSize() % sizeof(double) != 0)
+  {
+    return false;
+  }
+
+  mValue.clear();
+  mValuesSource = filename;
+  mValuesEncoding = SEDML_VALUESENCODING_EXTERNAL;
+
+  // mapped memory is page-aligned, so the doubles can be used in place
+  // unless they need swapping
+  if (isLittleEndian())
+  {
+    mValuesFile = file;
+  }
+  else
+  {
+    mValuesFile.reset();
+    appendLittleEndian(mValue, file->getData(),
+      file->getSize() / sizeof(double));
+  }
+
+  return true;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns filename resolved against the location of the parent SedDocument
+ */
+std::string
+SedVectorRange::resolveValuesFile(const std::string& filename) const
+{
+  const SedDocument* doc = getSedDocument();
+  if (doc == NULL || doc->getLocationURI().empty() || filename.empty()
+    || filename[0] == '/' || filename[0] == '\\'
+    || (filename.size() > 1 && filename[1] == ':'))
+  {
+    return filename;
+  }
+
+  const std::string& location = doc->getLocationURI();
+  const std::string::size_type pos = location.find_last_of("/\\");
+  if (pos == std::string::npos)
+  {
+    return filename;
+  }
+
+  return location.substr(0, pos + 1) + filename;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Serializes materializing values, which const getters do on ranges that
+ * may be shared by copy-on-write clones used from several threads.
+ */
+static std::mutex&
+materializeMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+
+/*
+ * Copies mapped values into mValue
+ */
+void
+SedVectorRange::materializeValues() const
+{
+  if (mValuesFile == NULL)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(materializeMutex());
+
+  if (mValue.empty())
+  {
+    appendLittleEndian(mValue, mValuesFile->getData(),
+      mValuesFile->getSize() / sizeof(double));
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Detaches the values from the values file before they are modified
+ */
+void
+SedVectorRange::detachValuesSource()
+{
+  if (!isSetValuesSource())
+  {
+    return;
+  }
+
+  materializeValues();
+  mValuesFile.reset();
+  mValuesSource.clear();
+  if (mValuesEncoding == SEDML_VALUESENCODING_EXTERNAL)
+  {
+    mValuesEncoding = SEDML_VALUESENCODING_TEXT;
+  }
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
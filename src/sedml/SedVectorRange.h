@@ -42,11 +42,13 @@
 
 #include <sedml/common/extern.h>
 #include <sedml/common/sedmlfwd.h>
+#include <sedml/common/SedmlEnumerations.h>
 
 
 #ifdef __cplusplus
 
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -58,13 +60,22 @@
 LIBSEDML_CPP_NAMESPACE_BEGIN
 
 
+class SedMappedFile;
+
+
 class LIBSEDML_EXTERN SedVectorRange : public SedRange
 {
 protected:
 
   /** @cond doxygenLibSEDMLInternal */
 
-  std::vector<double> mValue;
+  // materialized from mValuesFile on demand by getValues()
+  mutable std::vector<double> mValue;
+  ValuesEncoding_t mValuesEncoding;
+  std::string mValuesSource;
+  // the mapping of mValuesSource, shared between copies, for as long as the
+  // values have not been materialized or modified
+  std::shared_ptr<SedMappedFile> mValuesFile;
 
   /** @endcond */
 
@@ -114,6 +125,27 @@ public:
   SedVectorRange& operator=(const SedVectorRange& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedVectorRange.
+   *
+   * @param orig the SedVectorRange instance to move from; it is left empty.
+   */
+  SedVectorRange(SedVectorRange&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedVectorRange.
+   *
+   * @param rhs the SedVectorRange object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedVectorRange& operator=(SedVectorRange&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedVectorRange object.
    *
@@ -131,12 +163,28 @@ public:
   /**
    * Returns the value of the "value" attribute of this SedVectorRange.
    *
+   * Values held in a memory-mapped binary file are copied into the vector
+   * on the first call; use getValuesData() to read them in place.
+   *
    * @return the value of the "value" attribute of this SedVectorRange as a
    * vector.
    */
   const std::vector<double>& getValues() const;
 
 
+  /**
+   * Returns the values of this SedVectorRange as an array of
+   * getNumValues() doubles, pointing into the memory-mapped binary file
+   * if the values are held in one.
+   *
+   * The pointer is invalidated by any change to the values.
+   *
+   * @return the values of this SedVectorRange, or @c NULL if there are
+   * none.
+   */
+  const double* getValuesData() const;
+
+
   /**
    * Predicate returning @c true if this SedVectorRange's "value" attribute is
    * set.
@@ -166,6 +214,126 @@ public:
   int setValues(const std::vector<double>& value);
 
 
+#ifndef SWIG
+
+  /**
+   * Sets the value of the "value" attribute of this SedVectorRange, taking
+   * over the storage of the given vector instead of copying it.
+   *
+   * @param value std::vector<double> value of the "value" attribute to be set;
+   * it is left empty.
+   *
+   * @copydetails doc_returns_one_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   */
+  int setValues(std::vector<double>&& value);
+
+#endif /* !SWIG */
+
+
+  /**
+   * Sets the value of the "value" attribute of this SedVectorRange from an
+   * array of doubles.
+   *
+   * @param values pointer to the first of @p numValues doubles to be set.
+   * @param numValues the number of doubles in @p values.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_OBJECT, OperationReturnValues_t}
+   */
+  int setValues(const double* values, unsigned int numValues);
+
+
+  /**
+   * Returns the encoding used when writing the values of this
+   * SedVectorRange.
+   *
+   * @return the encoding of the values of this SedVectorRange as a
+   * #ValuesEncoding_t; @sbmlconstant{SEDML_VALUESENCODING_TEXT,
+   * ValuesEncoding_t} unless set otherwise or read in a binary form.
+   */
+  ValuesEncoding_t getValuesEncoding() const;
+
+
+  /**
+   * Sets the encoding used when writing the values of this SedVectorRange.
+   *
+   * @sbmlconstant{SEDML_VALUESENCODING_TEXT, ValuesEncoding_t} writes the
+   * SED-ML "value" elements.  The binary encodings write a
+   * &lt;libsedml:binaryValues&gt; element instead, which only libSEDML
+   * reads: with @sbmlconstant{SEDML_VALUESENCODING_BASE64, ValuesEncoding_t}
+   * the little-endian doubles are embedded as base64 text, with
+   * @sbmlconstant{SEDML_VALUESENCODING_EXTERNAL, ValuesEncoding_t} the
+   * element refers to the file set by setValuesSource() or
+   * writeValuesFile().
+   *
+   * @param encoding the #ValuesEncoding_t to use.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if @p encoding is @sbmlconstant{SEDML_VALUESENCODING_EXTERNAL,
+   * ValuesEncoding_t} and no values file is set.
+   */
+  int setValuesEncoding(ValuesEncoding_t encoding);
+
+
+  /**
+   * Returns the name of the binary file holding the values of this
+   * SedVectorRange.
+   *
+   * @return the name of the values file, as written to the document, or an
+   * empty string if there is none.
+   */
+  const std::string& getValuesSource() const;
+
+
+  /**
+   * Predicate returning @c true if the values of this SedVectorRange are
+   * held in a binary file.
+   *
+   * @return @c true if a values file is set, otherwise @c false.
+   */
+  bool isSetValuesSource() const;
+
+
+  /**
+   * Makes this SedVectorRange use the values held in a binary file of
+   * little-endian doubles, memory-mapping the file.
+   *
+   * A relative @p filename is resolved against the location of the parent
+   * SedDocument.  The values are written by reference to the file until
+   * they are modified, after which they are written as text again.
+   *
+   * @param filename the name of the file.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   * if the file cannot be read or does not hold a whole number of doubles.
+   */
+  int setValuesSource(const std::string& filename);
+
+
+  /**
+   * Writes the values of this SedVectorRange to a binary file of
+   * little-endian doubles and makes the SedVectorRange refer to it.
+   *
+   * A relative @p filename is resolved against the location of the parent
+   * SedDocument.
+   *
+   * @param filename the name of the file.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sedmlconstant{LIBSEDML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sedmlconstant{LIBSEDML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int writeValuesFile(const std::string& filename);
+
+
   /**
    * Adds another value to the "value" attribute of this SedVectorRange.
    *
@@ -237,6 +405,36 @@ public:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Parses a single number from the text of a "value" element, independent
+   * of the current C locale.  Leading whitespace is skipped, and "INF",
+   * "-INF" and "NaN" are accepted.
+   *
+   * @return @c true if a number was read, @c false otherwise.
+   */
+  static bool parseValue(const char* text, double& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Formats @p value into @p buffer using the shortest representation that
+   * reads back to the identical double, independent of the current C
+   * locale.  The buffer must hold at least 32 characters.
+   *
+   * @return the number of characters written, excluding the terminating NUL.
+   */
+  static size_t formatValue(double value, char* buffer);
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -552,6 +750,77 @@ protected:
 
 
 
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Reads a &lt;libsedml:binaryValues&gt; element
+   */
+  void readBinaryValues(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLInputStream&
+    stream);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Writes the values as a &lt;libsedml:binaryValues&gt; element
+   */
+  void writeBinaryValues(LIBSBML_CPP_NAMESPACE_QUALIFIER XMLOutputStream&
+    stream) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Maps the given values file, replacing the current values; returns
+   * @c false, changing nothing, if that fails.
+   */
+  bool mapValuesFile(const std::string& filename);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Returns @p filename resolved against the location of the parent
+   * SedDocument
+   */
+  std::string resolveValuesFile(const std::string& filename) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Copies mapped values into mValue, making them modifiable
+   */
+  void materializeValues() const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibSEDMLInternal */
+
+  /**
+   * Called before the values are modified: detaches them from the values
+   * file, if any
+   */
+  void detachValuesSource();
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibSEDMLInternal */
 
   /**
@@ -55,7 +55,6 @@ SedWaterfallPlot::SedWaterfallPlot(unsigned int level, unsigned int version)
   : SedPlot(level, version)
   , mTaskReference ("")
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -97,6 +96,32 @@ SedWaterfallPlot::operator=(const SedWaterfallPlot& rhs)
 }
 
 
+/*
+ * Move constructor for SedWaterfallPlot.
+ */
+SedWaterfallPlot::SedWaterfallPlot(SedWaterfallPlot&& orig) noexcept
+  : SedPlot( std::move(orig) )
+  , mTaskReference ( std::move(orig.mTaskReference) )
+{
+}
+
+
+/*
+ * Move assignment operator for SedWaterfallPlot.
+ */
+SedWaterfallPlot&
+SedWaterfallPlot::operator=(SedWaterfallPlot&& rhs) noexcept
+{
+  if (&rhs != this)
+  {
+    SedPlot::operator=(std::move(rhs));
+    mTaskReference = std::move(rhs.mTaskReference);
+  }
+
+  return *this;
+}
+
+
 /*
  * Creates and returns a deep copy of this SedWaterfallPlot object.
  */
@@ -148,6 +173,7 @@ SedWaterfallPlot::setTaskReference(const std::string& taskReference)
   }
   else
   {
+    sIdRefChanged(mTaskReference, taskReference);
     mTaskReference = taskReference;
     return LIBSEDML_OPERATION_SUCCESS;
   }
@@ -160,6 +186,7 @@ SedWaterfallPlot::setTaskReference(const std::string& taskReference)
 int
 SedWaterfallPlot::unsetTaskReference()
 {
+  sIdRefChanged(mTaskReference, std::string());
   mTaskReference.erase();
 
   if (mTaskReference.empty() == true)
@@ -187,6 +214,19 @@ SedWaterfallPlot::renameSIdRefs(const std::string& oldid,
 }
 
 
+/*
+ * Appends the values of the set SIdRef attributes of this SedWaterfallPlot to refs.
+ */
+void
+SedWaterfallPlot::getSIdRefs(std::vector<std::string>& refs) const
+{
+  if (isSetTaskReference())
+  {
+    refs.push_back(mTaskReference);
+  }
+}
+
+
 /*
  * Returns the XML element name of this SedWaterfallPlot object.
  */
@@ -113,6 +113,27 @@ public:
   SedWaterfallPlot& operator=(const SedWaterfallPlot& rhs);
 
 
+#ifndef SWIG
+
+  /**
+   * Move constructor for SedWaterfallPlot.
+   *
+   * @param orig the SedWaterfallPlot instance to move from; it is left empty.
+   */
+  SedWaterfallPlot(SedWaterfallPlot&& orig) noexcept;
+
+
+  /**
+   * Move assignment operator for SedWaterfallPlot.
+   *
+   * @param rhs the SedWaterfallPlot object whose contents are moved into this one; it
+   * is left empty.
+   */
+  SedWaterfallPlot& operator=(SedWaterfallPlot&& rhs) noexcept;
+
+#endif /* !SWIG */
+
+
   /**
    * Creates and returns a deep copy of this SedWaterfallPlot object.
    *
@@ -176,6 +197,12 @@ public:
                              const std::string& newid);
 
 
+  /**
+   * @copydoc SedBase::getSIdRefs
+   */
+  virtual void getSIdRefs(std::vector<std::string>& refs) const;
+
+
   /**
    * Returns the XML element name of this SedWaterfallPlot object.
    *
@@ -754,6 +754,93 @@ ScaleType_isValidString(const char* code)
 }
 
 
+static
+const char* SEDML_VALUES_ENCODING_STRINGS[] =
+{
+  "text"
+, "base64"
+, "external"
+, "invalid ValuesEncoding value"
+};
+
+
+/*
+ * Returns the string version of the provided #ValuesEncoding_t enumeration.
+ */
+LIBSEDML_EXTERN
+const char*
+ValuesEncoding_toString(ValuesEncoding_t ve)
+{
+  int min = SEDML_VALUESENCODING_TEXT;
+  int max = SEDML_VALUESENCODING_INVALID;
+
+  if (ve < min || ve > max)
+  {
+    return "(Unknown ValuesEncoding value)";
+  }
+
+  return SEDML_VALUES_ENCODING_STRINGS[ve - min];
+}
+
+
+/*
+ * Returns the #ValuesEncoding_t enumeration corresponding to the given string or
+ * @sbmlconstant{SEDML_VALUESENCODING_INVALID, ValuesEncoding_t} if there is no such match.
+ */
+LIBSEDML_EXTERN
+ValuesEncoding_t
+ValuesEncoding_fromString(const char* code)
+{
+  static int size =
+    sizeof(SEDML_VALUES_ENCODING_STRINGS)/sizeof(SEDML_VALUES_ENCODING_STRINGS[0]);
+  std::string type(code);
+
+  for (int i = 0; i < size; i++)
+  {
+    if (type == SEDML_VALUES_ENCODING_STRINGS[i])
+    {
+      return (ValuesEncoding_t)(i);
+    }
+  }
+
+  return SEDML_VALUESENCODING_INVALID;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
+ * given #ValuesEncoding_t is valid.
+ */
+LIBSEDML_EXTERN
+int
+ValuesEncoding_isValid(ValuesEncoding_t ve)
+{
+  int min = SEDML_VALUESENCODING_TEXT;
+  int max = SEDML_VALUESENCODING_INVALID;
+
+  if (ve < min || ve >= max)
+  {
+    return 0;
+  }
+  else
+  {
+    return 1;
+  }
+}
+
+
+/*
+ * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
+ * given string is a valid #ValuesEncoding_t.
+ */
+LIBSEDML_EXTERN
+int
+ValuesEncoding_isValidString(const char* code)
+{
+  return ValuesEncoding_isValid(ValuesEncoding_fromString(code));
+}
+
+
 
 
 LIBSEDML_CPP_NAMESPACE_END
@@ -979,6 +979,115 @@ int
 ScaleType_isValidString(const char* code);
 
 
+/**
+ * @enum ValuesEncoding_t
+ * @brief Enumeration of the ways the values of a SedVectorRange can be stored.
+ *
+ * Only @sbmlconstant{SEDML_VALUESENCODING_TEXT, ValuesEncoding_t} is part of
+ * SED-ML; the binary encodings are a libSEDML extension.
+ */
+typedef enum
+{
+  SEDML_VALUESENCODING_TEXT          /*!< The values are written as @c "value" elements. */
+, SEDML_VALUESENCODING_BASE64        /*!< The values are written as base64-encoded binary. */
+, SEDML_VALUESENCODING_EXTERNAL      /*!< The values are kept in an external binary file. */
+, SEDML_VALUESENCODING_INVALID       /*!< Invalid ValuesEncoding value. */
+} ValuesEncoding_t;
+
+
+/**
+ * Returns the string version of the provided #ValuesEncoding_t enumeration.
+ *
+ * @param ve the #ValuesEncoding_t enumeration value to convert.
+ *
+ * @return A string corresponding to the given type:
+ * "text",
+ * "base64",
+ * "external",
+ * "invalid ValuesEncoding value",
+ * or @c NULL if the value is @sbmlconstant{SEDML_VALUESENCODING_INVALID, ValuesEncoding_t}
+ * or another invalid enumeration value.
+ *
+ * @copydetails doc_returned_unowned_char
+ *
+ * @if conly
+ * @memberof Sedml_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+const char*
+ValuesEncoding_toString(ValuesEncoding_t ve);
+
+
+/**
+ * Returns the #ValuesEncoding_t enumeration corresponding to the given string or
+ * @sbmlconstant{SEDML_VALUESENCODING_INVALID, ValuesEncoding_t} if there is no such match.
+ *
+ * @param code the string to convert to a #ValuesEncoding_t.
+ *
+ * @return the corresponding #ValuesEncoding_t or
+ * @sbmlconstant{SEDML_VALUESENCODING_INVALID, ValuesEncoding_t} if no match is found.
+ *
+ * @note The matching is case-sensitive: "text" will return
+ * @sbmlconstant{SEDML_VALUESENCODING_TEXT, ValuesEncoding_t}, but "Text" will return
+ * @sbmlconstant{SEDML_VALUESENCODING_INVALID, ValuesEncoding_t}.
+ *
+ * @if conly
+ * @memberof Sedml_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+ValuesEncoding_t
+ValuesEncoding_fromString(const char* code);
+
+
+/**
+ * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
+ * given #ValuesEncoding_t is valid.
+ *
+ * @param ve the #ValuesEncoding_t enumeration to query.
+ *
+ * @return @c 1 (true) if the #ValuesEncoding_t is
+ * @sbmlconstant{SEDML_VALUESENCODING_TEXT, ValuesEncoding_t},
+ * @sbmlconstant{SEDML_VALUESENCODING_BASE64, ValuesEncoding_t}, or
+ * @sbmlconstant{SEDML_VALUESENCODING_EXTERNAL, ValuesEncoding_t};
+ * @c 0 (false) otherwise (including @sbmlconstant{SEDML_VALUESENCODING_INVALID,
+ * ValuesEncoding_t}).
+ *
+ * @if conly
+ * @memberof Sedml_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+int
+ValuesEncoding_isValid(ValuesEncoding_t ve);
+
+
+/**
+ * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
+ * given string is a valid #ValuesEncoding_t.
+ *
+ * @param code the string to query.
+ *
+ * @return @c 1 (true) if the string is
+ * "text",
+ * "base64",
+ * "external", or
+ * "invalid ValuesEncoding value";
+ * @c 0 (false) otherwise.
+ *
+ * @note The matching is case-sensitive: "text" will return @c 1 (true), but
+ * "Text" will return @c 0 (false).
+ *
+ * @if conly
+ * @memberof Sedml_t
+ * @endif
+ */
+LIBSEDML_EXTERN
+int
+ValuesEncoding_isValidString(const char* code);
+
+
 
 
 END_C_DECLS
@@ -1,7 +1,7 @@
 
 /**
- * \file    kisao.cpp
- * \brief   KiSAO map
+ * \file    kisaomap.cpp
+ * \brief   KiSAO term table
  * \author  Lucian Smith
  * 
  * <!--------------------------------------------------------------------------
@@ -38,469 +38,997 @@
  * 
  */
  
-#include <map>
-#include <string>
+#include <sedml/SedKisao.h>
 
-std::map<int, std::string> g_kisaomap = {
-   {654, "amount rate"},
-   {386, "scaled preconditioned generalized minimal residual method"},
-   {810, "Reduced eigenvalue matrix"},
-   {621, "stochastic simulation leaping method"},
-   {808, "Reduced stoichiometry matrix"},
-   {404, "symmetricity of matrix"},
-   {539, "minimum factor to change step size by"},
-   {506, "genetic algorithm"},
-   {219, "maximum Adams order"},
-   {99, "type of system behaviour"},
-   {543, "stability limit detection flag"},
-   {510, "truncated Newton"},
-   {358, "biconjugate gradient method"},
-   {325, "minimum fast/discrete reaction occurrences number"},
-   {421, "type of validation"},
-   {824, "aggregation function"},
-   {556, "relative quadrature tolerance"},
-   {589, "ACB flux sampling method"},
-   {523, "cooling factor"},
-   {453, "ordered updating policy"},
-   {428, "matrix for clusterization"},
-   {497, "KLU"},
-   {338, "h-version of the finite element method"},
-   {639, "flux"},
-   {108, "progression with fixed time step"},
-   {606, "Hierarchical Stochastic Simulation Algorithm"},
-   {560, "LSODA/LSODAR hybrid method"},
-   {837, "particle number"},
-   {39, "tau-leaping method"},
-   {236, "exact solution"},
-   {592, "dynamic rFBA"},
-   {432, "IDA-like method"},
-   {203, "particle number lower limit"},
-   {517, "number of generations"},
-   {319, "Monte Carlo method"},
-   {632, "functional iteration root-finding method"},
-   {64, "Runge-Kutta based method"},
-   {97, "modelling and simulation algorithm characteristic"},
-   {415, "maximum number of steps"},
-   {448, "logical model simulation method"},
-   {521, "simulated annealing parameter"},
-   {554, "parsimonius flux balance analysis (minimum number of active fluxes)"},
-   {528, "parsimonious enzyme usage flux balance analysis (minimum sum of absolute fluxes)"},
-   {587, "IMEX"},
-   {599, "Hybrid Gibson - Euler-Maruyama Method"},
-   {201, "modelling and simulation algorithm parameter"},
-   {234, "LSODKR"},
-   {369, "partial differential equation discretization method"},
-   {106, "continuous variable"},
-   {604, "MSR Tolerance"},
-   {336, "D-leaping method"},
-   {835, "Concentration control coefficient matrix (scaled)"},
-   {567, "force physical correctness"},
-   {340, "h-p version of the finite element method"},
-   {17, "multi-state agent-based simulation method"},
-   {373, "differential-algebraic equation problem"},
-   {617, "IDA-CVODE hybrid method"},
-   {475, "integration method"},
-   {643, "upper bound"},
-   {571, "absolute tolerance adjustment factor"},
-   {75, "Gillespie multi-particle method"},
-   {829, "minimum"},
-   {21, "StochSim nearest-neighbour algorithm"},
-   {424, "mean-centring of variables"},
-   {469, "maximal timestep"},
-   {301, "Heun method"},
-   {430, "variables preprocessing parameter"},
-   {565, "absolute tolerance for root finding"},
-   {532, "loopless"},
-   {31, "Euler backward method"},
-   {302, "embedded Runge-Kutta method"},
-   {437, "flux balance analysis"},
-   {597, "tolerance"},
-   {104, "stochastic system behaviour"},
-   {334, "multiparticle lattice gas automata"},
-   {278, "Metropolis Monte Carlo algorithm"},
-   {15, "Gillespie first reaction algorithm"},
-   {615, "fully-implicit regular grid finite volume method with a variable time step"},
-   {347, "meshless geometry handling"},
-   {648, "step"},
-   {473, "Bayesian inference algorithm"},
-   {81, "estimated midpoint tau-leaping method"},
-   {223, "number of history bins"},
-   {282, "KINSOL"},
-   {504, "random search"},
-   {28, "slow-scale stochastic simulation algorithm"},
-   {384, "semi-implicit midpoint rule"},
-   {351, "multinomial tau-leaping method"},
-   {486, "maximum iterations"},
-   {628, "modelling and simulation algorithm parameter value"},
-   {256, "virtual box side length"},
-   {435, "embedded Runge-Kutta 5(4) method"},
-   {309, "Crank-Nicolson method"},
-   {239, "explicit method type"},
-   {537, "explicit Runge-Kutta method of order 3(2)"},
-   {86, "Fehlberg method"},
-   {563, "Pahle hybrid Gibson-Bruck Next Reaction method/RK-45 method"},
-   {378, "implicit midpoint rule"},
-   {345, "h-p cloud method"},
-   {576, "Quadratic MOMA"},
-   {243, "method switching control parameter"},
-   {626, "band direct solver"},
-   {451, "type of updating policy"},
-   {484, "maximum order"},
-   {58, "Greens function reaction dynamics"},
-   {289, "Adams method"},
-   {382, "modified midpoint method"},
-   {630, "root-finding method"},
-   {362, "implicit-state Doob-Gillespie algorithm"},
-   {590, "ACHR flux sampling method"},
-   {548, "quadratic programming"},
-   {515, "Levenberg-Marquardt"},
-   {260, "virtual box size"},
-   {807, "Elasticity coefficient (scaled)"},
-   {395, "improved biconjugate gradient method"},
-   {574, "species transition probabilities"},
-   {40, "Poisson tau-leaping method"},
-   {541, "Beta parameter for stabilized step size control"},
-   {95, "sub-volume stochastic reaction-diffusion algorithm"},
-   {317, "E-Cell multi-algorithm simulation method"},
-   {818, "L0 matrix"},
-   {413, "exact Newton method"},
-   {343, "generalized finite element method"},
-   {478, "preconditioner"},
-   {310, "method of lines"},
-   {822, "extensive property"},
-   {287, "Milstein method"},
-   {254, "Brownian diffusion accuracy"},
-   {389, "quasi-minimal residual method"},
-   {356, "DASSL"},
-   {624, "method for solving a system of linear equations"},
-   {552, "optimization method"},
-   {323, "equation-free probabilistic steady-state approximation"},
-   {482, "half-bandwith parameter"},
-   {228, "tau-leaping epsilon"},
-   {393, "ingenious conjugate gradients-squared method"},
-   {495, "random asynchronous updating policy"},
-   {637, "derived property"},
-   {90, "LSODI"},
-   {232, "LSOIBT"},
-   {367, "partitioned Runge-Kutta method"},
-   {806, "Elasticity matrix (scaled)"},
-   {641, "bound"},
-   {526, "flux variability analysis"},
-   {559, "initial step size"},
-   {321, "Cash-Karp method"},
-   {51, "Bortz-Kalos-Lebowitz algorithm"},
-   {585, "TOMS731"},
-   {328, "minimum fast rate"},
-   {820, "model and simulation property characteristic"},
-   {354, "Krylov subspace projection method"},
-   {602, "Minimum species threshold for continuous approximation"},
-   {230, "minimum reactions per leap"},
-   {595, "rFBA"},
-   {332, "ER-leap initial leap"},
-   {635, "unscaled property"},
-   {493, "synchronous updating policy"},
-   {276, "Gill method"},
-   {524, "partitioned leaping method"},
-   {45, "implicit tau-leaping method"},
-   {429, "clusterization parameter"},
-   {371, "stochastic differential equation problem"},
-   {307, "finite difference method"},
-   {652, "concentration rate"},
-   {204, "particle number upper limit"},
-   {409, "ordinary Newton method"},
-   {280, "Adams-Moulton method"},
-   {502, "DA-DFBA"},
-   {339, "p-version of the finite element method"},
-   {84, "nonnegative Poisson tau-leaping method"},
-   {263, "NFSim agent-based simulation method"},
-   {561, "Pahle hybrid Gibson-Bruck Next Reaction method/Runge-Kutta method"},
-   {398, "iterative method for solving a system of linear equations"},
-   {365, "NDSolve method"},
-   {838, "concentration"},
-   {102, "spatial description"},
-   {600, "Hybrid Adaptive Gibson - Milstein Method"},
-   {467, "maximum step size"},
-   {609, "Embedded Runge-Kutta Prince-Dormand (8,9) method"},
-   {593, "MOMA"},
-   {237, "approximate solution"},
-   {831, "model and simulation property"},
-   {613, "Stochastic simulation algorithm with normally-distributed next reaction times"},
-   {646, "propensity"},
-   {529, "parallelism"},
-   {241, "Gillespie-like method"},
-   {274, "first-passage Monte Carlo algorithm"},
-   {471, "local optimization algorithm"},
-   {809, "Reduced Jacobian matrix"},
-   {376, "linearity of equation"},
-   {407, "steady state method"},
-   {650, "sensitivity"},
-   {509, "evolutionary strategy"},
-   {805, "Elasticity coefficient (unscaled)"},
-   {535, "VODE"},
-   {568, "NLEQ1"},
-   {89, "LSODAR"},
-   {305, "Verner method"},
-   {56, "Smoluchowski equation based method"},
-   {546, "convex optimization algorithm"},
-   {513, "NL2SOL"},
-   {572, "level of superimposed noise"},
-   {816, "Link matrix"},
-   {579, "Linear MOMA"},
-   {411, "Newton-like method"},
-   {248, "tau-leaping delta"},
-   {341, "mixed finite element method"},
-   {644, "maximum flux"},
-   {611, "Incremental stochastic simulation algorithm"},
-   {500, "SOA-DFBA"},
-   {405, "type of differential equation"},
-   {380, "Richardson extrapolation based method"},
-   {285, "finite volume method"},
-   {507, "genetic algorithm SR"},
-   {0, "modelling and simulation algorithm"},
-   {252, "partitioning control parameter"},
-   {544, "IDAS"},
-   {418, "N-way partial least squares regression method"},
-   {511, "steepest descent"},
-   {348, "extended finite element method"},
-   {315, "lattice gas automata"},
-   {804, "Elasticity matrix (unscaled)"},
-   {827, "standard error"},
-   {422, "number of N-way partial least squares regression factors"},
-   {29, "Gillespie direct algorithm"},
-   {629, "Null"},
-   {557, "absolute steady-state tolerance"},
-   {487, "minimum damping"},
-   {454, "constant updating policy"},
-   {82, "k-alpha leaping method"},
-   {583, "minimum order"},
-   {326, "number of samples"},
-   {550, "simplex method"},
-   {505, "particle swarm"},
-   {622, "flux balance method"},
-   {655, "rate"},
-   {87, "Dormand-Prince method"},
-   {283, "IDA"},
-   {480, "lower half-bandwidth"},
-   {352, "hybrid method"},
-   {296, "Hammer-Hollingsworth method"},
-   {518, "evolutionary algorithm parameter"},
-   {98, "type of variable"},
-   {449, "synchronous logical model simulation method"},
-   {416, "partial least squares regression method"},
-   {802, "Control coefficient (scaled)"},
-   {803, "Control coefficient (unscaled)"},
-   {825, "mean"},
-   {588, "flux sampling"},
-   {420, "number of partial least squares components"},
-   {555, "absolute quadrature tolerance"},
-   {522, "start temperature"},
-   {93, "LSODPK"},
-   {235, "type of solution"},
-   {337, "finite element method"},
-   {433, "CVODE-like method"},
-   {363, "rule-based simulation method"},
-   {330, "R-leaping algorithm"},
-   {100, "type of progression time step"},
-   {498, "number of runs"},
-   {607, "Hierarchical Fehlberg method"},
-   {549, "non-linear programming"},
-   {516, "Hooke&Jeeves"},
-   {633, "computational function"},
-   {491, "discrete event simulation algorithm"},
-   {261, "Euler method"},
-   {396, "transpose-free quasi-minimal residual algorithm"},
-   {819, "Nr matrix"},
-   {553, "optimization solver"},
-   {801, "Concentration control coefficient matrix (unscaled)"},
-   {427, "number of clusters"},
-   {22, "Elf and Ehrenberg method"},
-   {520, "evolutionary algorithm"},
-   {324, "nested stochastic simulation algorithm"},
-   {76, "Stundzia and Lumsden method"},
-   {533, "pFBA factor"},
-   {566, "stochastic second order Runge-Kutta method"},
-   {605, "SDE Tolerance"},
-   {303, "Zonneveld method"},
-   {107, "progression with adaptive time step"},
-   {598, "Hybrid Gibson - Milstein Method"},
-   {836, "amount"},
-   {335, "generalized stochastic simulation algorithm"},
-   {209, "relative tolerance"},
-   {374, "ordinary differential equation problem"},
-   {476, "iteration type"},
-   {618, "bunker"},
-   {279, "Adams-Bashforth method"},
-   {71, "LSODE"},
-   {570, "auto reduce tolerances"},
-   {48, "adaptive explicit-implicit tau-leaping method"},
-   {329, "constant-time kinetic Monte Carlo algorithm"},
-   {74, "binomial tau-leaping method"},
-   {425, "standardising of variables"},
-   {20, "PVODE"},
-   {527, "geometric flux balance analysis"},
-   {32, "explicit fourth-order Runge-Kutta method"},
-   {834, "rate of change"},
-   {564, "stochastic Runge-Kutta method"},
-   {33, "Rosenbrock method"},
-   {531, "fraction of optimum"},
-   {105, "discrete variable"},
-   {346, "mesh-based geometry handling"},
-   {372, "partial differential equation problem"},
-   {577, "flux minimization weight"},
-   {649, "shadow price"},
-   {616, "semi-implicit regular grid finite volume method with a fixed time step"},
-   {244, "granularity control parameter"},
-   {379, "Bulirsch-Stoer algorithm"},
-   {211, "absolute tolerance"},
-   {452, "random updating policy"},
-   {581, "BKMC"},
-   {653, "particle number rate"},
-   {620, "parsimonius flux balance analysis"},
-   {257, "surface-bound epsilon"},
-   {580, "ROOM"},
-   {27, "Gibson-Bruck next reaction algorithm"},
-   {350, "probability-weighted dynamic Monte Carlo method"},
-   {308, "MacCormack method"},
-   {538, "safety factor on new step selection"},
-   {468, "maximal timestep method"},
-   {205, "partitioning interval"},
-   {30, "Euler forward method"},
-   {800, "systems property"},
-   {436, "Dormand-Prince 8(5,3) method"},
-   {403, "homogeneousness of equation"},
-   {614, "Implementation"},
-   {472, "global optimization algorithm"},
-   {311, "type of domain geometry handling"},
-   {575, "Hybrid tau-leaping method"},
-   {542, "correction step should use internally generated full Jacobian"},
-   {288, "backward differentiation formula"},
-   {627, "diagonal approximate Jacobian solver"},
-   {485, "minimum step size"},
-   {815, "Flux control coefficient matrix (scaled)"},
-   {255, "molecules per virtual box"},
-   {357, "conjugate gradient method"},
-   {383, "Bader-Deuflhard method"},
-   {38, "sorting stochastic simulation algorithm"},
-   {394, "quasi-minimal residual variant of biconjugate gradient stabilized method"},
-   {591, "mdFBA"},
-   {638, "level"},
-   {496, "CVODES"},
-   {631, "iterative root-finding method"},
-   {514, "Nelder-Mead"},
-   {318, "Gauss-Legendre Runge-Kutta method"},
-   {447, "COAST"},
-   {540, "maximum factor to change step size by"},
-   {573, "probabilistic logical model simulation method"},
-   {817, "Kernel matrix"},
-   {479, "upper half-bandwidth"},
-   {249, "critical firing threshold"},
-   {19, "CVODE"},
-   {216, "integrate reduced model"},
-   {586, "Gibson-Bruck next reaction algorithm with indexed priority queue"},
-   {821, "intensive property"},
-   {483, "step size"},
-   {625, "dense direct solver"},
-   {253, "coarse-graining factor"},
-   {450, "asynchronous logical model simulation method"},
-   {388, "minimal residual method"},
-   {220, "maximum BDF order"},
-   {355, "DASPK"},
-   {322, "hybridity"},
-   {419, "metamodelling method"},
-   {299, "Butcher-Kuntzmann method"},
-   {814, "Flux control coefficient matrix (unscaled)"},
-   {233, "LSODES"},
-   {91, "LSODIS"},
-   {392, "biconjugate gradient stabilized method"},
-   {636, "primary property"},
-   {603, "Minimum reaction rate for continuous approximation"},
-   {68, "deterministic cellular automata update algorithm"},
-   {558, "relative steady-state tolerance"},
-   {525, "stop condition"},
-   {642, "minimum flux"},
-   {423, "partial least squares regression-like method"},
-   {353, "generalized minimal residual algorithm"},
-   {320, "BioRica hybrid method"},
-   {455, "prioritized updating policy"},
-   {584, "initial order"},
-   {551, "primal-dual interior point method"},
-   {828, "maximum"},
-   {596, "srFBA"},
-   {601, "Number of trials"},
-   {333, "accelerated stochastic simulation algorithm"},
-   {366, "symplecticness"},
-   {103, "deterministic system behaviour"},
-   {832, "time"},
-   {812, "Jacobian matrix"},
-   {264, "cellular automata update method"},
-   {297, "Lobatto method"},
-   {519, "population size"},
-   {494, "fully asynchronous updating policy"},
-   {231, "Pahle hybrid method"},
-   {647, "derivative"},
-   {46, "trapezoidal tau-leaping method"},
-   {640, "lower bound"},
-   {813, "Eigenvalue matrix"},
-   {370, "type of problem"},
-   {839, "temperature"},
-   {434, "Higham-Hall method"},
-   {569, "NLEQ2"},
-   {306, "Lagrangian sliding fluid element algorithm"},
-   {536, "ZVODE"},
-   {281, "multistep method"},
-   {503, "simulated annealing"},
-   {408, "Newton-type method"},
-   {651, "reduced costs"},
-   {562, "Pahle hybrid Gibson-Bruck Next Reaction method/LSODA method"},
-   {492, "asynchronous updating policy"},
-   {634, "scaled property"},
-   {238, "type of method"},
-   {594, "order"},
-   {397, "preconditioning technique"},
-   {331, "exact R-leaping algorithm"},
-   {364, "Adams predictor-corrector method"},
-   {499, "dynamic flux balance analysis"},
-   {608, "Hierarchical flux balance analysis"},
-   {242, "error control parameter"},
-   {377, "one-step method"},
-   {645, "objective value"},
-   {612, "implicit 4th order Runge-Kutta method at Gaussian points"},
-   {470, "optimization algorithm"},
-   {811, "Stoichiometry matrix"},
-   {3, "weighted stochastic simulation algorithm"},
-   {501, "DOA-DFBA"},
-   {381, "midpoint method"},
-   {57, "Brownian diffusion Smoluchowski method"},
-   {304, "Radau method"},
-   {534, "reactions"},
-   {349, "method of finite spheres"},
-   {94, "Livermore solver"},
-   {316, "enhanced Greens function reaction dynamics"},
-   {412, "inexact Newton method"},
-   {547, "linear programming"},
-   {619, "emc-sim"},
-   {477, "linear solver"},
-   {273, "hard-particle molecular dynamics"},
-   {240, "implicit method type"},
-   {375, "delay differential equation problem"},
-   {342, "level set method"},
-   {610, "Composite-rejection stochastic simulation algorithm"},
-   {88, "LSODA"},
-   {508, "evolutionary programming"},
-   {286, "Euler-Maruyama method"},
-   {656, "use adaptive time steps"},
-   {481, "interpolate solution"},
-   {623, "flux balance problem"},
-   {410, "simlified Newton method"},
-   {578, "nested algorithm"},
-   {290, "Merson method"},
-   {512, "praxis"},
-   {545, "include sensitivity variables in error control mechanism"},
-   {417, "hierarchical cluster-based partial least squares regression method"},
-   {314, "S-System power-law canonical differential equations solver"},
-   {582, "Spatiocyte method"},
-   {826, "standard deviation"},
-   {488, "seed"},
-   {258, "neighbour distance"},
-   {327, "maximum discrete number"},
+LIBSEDML_CPP_NAMESPACE_BEGIN
+
+/** @cond doxygenLibsedmlInternal */
+
+constexpr KisaoTerm kisaoTerms[] = {
+   {0, "modelling and simulation algorithm", 0,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {3, "weighted stochastic simulation algorithm", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {15, "Gillespie first reaction algorithm", -1,
+    {0x400100001ULL, 0x0ULL}, 3, {76, 127, 0}, {1, 2, 3}},
+   {17, "multi-state agent-based simulation method", 1,
+    {0x20000000001ULL, 0x0ULL}, 2, {167, 0}, {1, 2}},
+   {19, "CVODE", -1,
+    {0x1000000000000001ULL, 0x0ULL}, 2, {224, 0}, {1, 2}},
+   {20, "PVODE", -1,
+    {0x1000000000000001ULL, 0x0ULL}, 2, {224, 0}, {1, 2}},
+   {21, "StochSim nearest-neighbour algorithm", -1,
+    {0x20000000001ULL, 0x0ULL}, 2, {167, 0}, {1, 2}},
+   {22, "Elf and Ehrenberg method", -1,
+    {0x1400100201ULL, 0x0ULL}, 5, {42, 143, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {27, "Gibson-Bruck next reaction algorithm", 2,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {28, "slow-scale stochastic simulation algorithm", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {29, "Gillespie direct algorithm", -1,
+    {0x400100001ULL, 0x0ULL}, 3, {76, 127, 0}, {1, 2, 3}},
+   {30, "Euler forward method", -1,
+    {0x200004000001ULL, 0x0ULL}, 3, {90, 180, 0}, {1, 2, 3}},
+   {31, "Euler backward method", -1,
+    {0x200004000001ULL, 0x0ULL}, 3, {90, 180, 0}, {1, 2, 3}},
+   {32, "explicit fourth-order Runge-Kutta method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {33, "Rosenbrock method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {38, "sorting stochastic simulation algorithm", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {39, "tau-leaping method", 3,
+    {0xc00100001ULL, 0x4000000ULL}, 5, {388, 141, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {40, "Poisson tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {45, "implicit tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {46, "trapezoidal tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {48, "adaptive explicit-implicit tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {51, "Bortz-Kalos-Lebowitz algorithm", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {56, "Smoluchowski equation based method", 4,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {57, "Brownian diffusion Smoluchowski method", -1,
+    {0x11ULL, 0x0ULL}, 2, {22, 0}, {1, 2}},
+   {58, "Greens function reaction dynamics", -1,
+    {0x11ULL, 0x0ULL}, 2, {22, 0}, {1, 2}},
+   {64, "Runge-Kutta based method", 5,
+    {0x200000000001ULL, 0x0ULL}, 2, {180, 0}, {1, 2}},
+   {68, "deterministic cellular automata update algorithm", 6,
+    {0x20008000001ULL, 0x0ULL}, 3, {92, 167, 0}, {1, 2, 3}},
+   {71, "LSODE", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {74, "binomial tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {75, "Gillespie multi-particle method", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {76, "Stundzia and Lumsden method", -1,
+    {0x1400100201ULL, 0x0ULL}, 5, {42, 143, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {81, "estimated midpoint tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {82, "k-alpha leaping method", -1,
+    {0xc00100001ULL, 0x4000000ULL}, 5, {388, 141, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {84, "nonnegative Poisson tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {86, "Fehlberg method", 7,
+    {0x2000200080000021ULL, 0x0ULL}, 5, {226, 112, 25, 180, 0}, {1, 2, 3, 4, 5}},
+   {87, "Dormand-Prince method", -1,
+    {0x2000200080000021ULL, 0x0ULL}, 5, {226, 112, 25, 180, 0}, {1, 2, 3, 4, 5}},
+   {88, "LSODA", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {89, "LSODAR", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {90, "LSODI", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {91, "LSODIS", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {93, "LSODPK", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {94, "Livermore solver", 8,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {95, "sub-volume stochastic reaction-diffusion algorithm", 9,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {97, "modelling and simulation algorithm characteristic", 10,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {98, "type of variable", 11,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {99, "type of system behaviour", 12,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {100, "type of progression time step", 13,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {102, "spatial description", -1,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {103, "deterministic system behaviour", -1,
+    {0x1400ULL, 0x0ULL}, 2, {45, 43}, {1, 2}},
+   {104, "stochastic system behaviour", -1,
+    {0x1400ULL, 0x0ULL}, 2, {45, 43}, {1, 2}},
+   {105, "discrete variable", -1,
+    {0xc00ULL, 0x0ULL}, 2, {44, 43}, {1, 2}},
+   {106, "continuous variable", -1,
+    {0xc00ULL, 0x0ULL}, 2, {44, 43}, {1, 2}},
+   {107, "progression with adaptive time step", -1,
+    {0x2400ULL, 0x0ULL}, 2, {46, 43}, {1, 2}},
+   {108, "progression with fixed time step", -1,
+    {0x2400ULL, 0x0ULL}, 2, {46, 43}, {1, 2}},
+   {201, "modelling and simulation algorithm parameter", 14,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {203, "particle number lower limit", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {204, "particle number upper limit", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {205, "partitioning interval", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {209, "relative tolerance", 15,
+    {0x204000ULL, 0x1000000ULL}, 3, {364, 77, 54}, {1, 2, 3}},
+   {211, "absolute tolerance", 16,
+    {0x204000ULL, 0x1000000ULL}, 3, {364, 77, 54}, {1, 2, 3}},
+   {216, "integrate reduced model", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {219, "maximum Adams order", -1,
+    {0x404000ULL, 0x400100ULL}, 4, {254, 361, 78, 54}, {1, 2, 3, 4}},
+   {220, "maximum BDF order", -1,
+    {0x404000ULL, 0x400100ULL}, 4, {254, 361, 78, 54}, {1, 2, 3, 4}},
+   {223, "number of history bins", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {228, "tau-leaping epsilon", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {230, "minimum reactions per leap", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {231, "Pahle hybrid method", 17,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {232, "LSOIBT", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {233, "LSODES", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {234, "LSODKR", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {235, "type of solution", 18,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {236, "exact solution", -1,
+    {0x40400ULL, 0x0ULL}, 2, {70, 43}, {1, 2}},
+   {237, "approximate solution", -1,
+    {0x40400ULL, 0x0ULL}, 2, {70, 43}, {1, 2}},
+   {238, "type of method", 19,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {239, "explicit method type", -1,
+    {0x80400ULL, 0x0ULL}, 2, {73, 43}, {1, 2}},
+   {240, "implicit method type", -1,
+    {0x80400ULL, 0x0ULL}, 2, {73, 43}, {1, 2}},
+   {241, "Gillespie-like method", 20,
+    {0x400000001ULL, 0x0ULL}, 2, {127, 0}, {1, 2}},
+   {242, "error control parameter", 21,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {243, "method switching control parameter", 22,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {244, "granularity control parameter", 23,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {248, "tau-leaping delta", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {249, "critical firing threshold", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {252, "partitioning control parameter", 24,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {253, "coarse-graining factor", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {254, "Brownian diffusion accuracy", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {255, "molecules per virtual box", -1,
+    {0x3004000ULL, 0x0ULL}, 3, {89, 82, 54}, {1, 2, 3}},
+   {256, "virtual box side length", -1,
+    {0x3004000ULL, 0x0ULL}, 3, {89, 82, 54}, {1, 2, 3}},
+   {257, "surface-bound epsilon", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {258, "neighbour distance", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {260, "virtual box size", 25,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {261, "Euler method", 26,
+    {0x200000000001ULL, 0x0ULL}, 2, {180, 0}, {1, 2}},
+   {263, "NFSim agent-based simulation method", -1,
+    {0x20000000003ULL, 0x0ULL}, 3, {3, 167, 0}, {1, 2, 3}},
+   {264, "cellular automata update method", 27,
+    {0x20000000001ULL, 0x0ULL}, 2, {167, 0}, {1, 2}},
+   {273, "hard-particle molecular dynamics", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {274, "first-passage Monte Carlo algorithm", -1,
+    {0x400000001ULL, 0x0ULL}, 2, {127, 0}, {1, 2}},
+   {276, "Gill method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {278, "Metropolis Monte Carlo algorithm", -1,
+    {0x400000001ULL, 0x0ULL}, 2, {127, 0}, {1, 2}},
+   {279, "Adams-Bashforth method", -1,
+    {0x50000001ULL, 0x0ULL}, 3, {106, 99, 0}, {1, 2, 3}},
+   {280, "Adams-Moulton method", -1,
+    {0x50000001ULL, 0x0ULL}, 3, {106, 99, 0}, {1, 2, 3}},
+   {281, "multistep method", 28,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {282, "KINSOL", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {283, "IDA", -1,
+    {0x840000000000001ULL, 0xc0000000ULL}, 5, {223, 202, 398, 397, 0}, {1, 2, 3, 4, 5}},
+   {285, "finite volume method", 29,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {286, "Euler-Maruyama method", -1,
+    {0x200000000001ULL, 0x0ULL}, 2, {180, 0}, {1, 2}},
+   {287, "Milstein method", -1,
+    {0x10000001ULL, 0x0ULL}, 2, {99, 0}, {1, 2}},
+   {288, "backward differentiation formula", -1,
+    {0x10000001ULL, 0x0ULL}, 2, {99, 0}, {1, 2}},
+   {289, "Adams method", 30,
+    {0x10000001ULL, 0x0ULL}, 2, {99, 0}, {1, 2}},
+   {290, "Merson method", -1,
+    {0x200080000021ULL, 0x0ULL}, 4, {112, 25, 180, 0}, {1, 2, 3, 4}},
+   {296, "Hammer-Hollingsworth method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {297, "Lobatto method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {299, "Butcher-Kuntzmann method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {301, "Heun method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {302, "embedded Runge-Kutta method", 31,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {303, "Zonneveld method", -1,
+    {0x200080000021ULL, 0x0ULL}, 4, {112, 25, 180, 0}, {1, 2, 3, 4}},
+   {304, "Radau method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {305, "Verner method", -1,
+    {0x200080000021ULL, 0x0ULL}, 4, {112, 25, 180, 0}, {1, 2, 3, 4}},
+   {306, "Lagrangian sliding fluid element algorithm", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {307, "finite difference method", 32,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {308, "MacCormack method", -1,
+    {0x40100000001ULL, 0x0ULL}, 3, {117, 172, 0}, {1, 2, 3}},
+   {309, "Crank-Nicolson method", -1,
+    {0x40100000001ULL, 0x0ULL}, 3, {117, 172, 0}, {1, 2, 3}},
+   {310, "method of lines", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {311, "type of domain geometry handling", 33,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {314, "S-System power-law canonical differential equations solver", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {315, "lattice gas automata", -1,
+    {0x20008000041ULL, 0x0ULL}, 4, {26, 92, 167, 0}, {1, 2, 3, 4}},
+   {316, "enhanced Greens function reaction dynamics", -1,
+    {0x11ULL, 0x0ULL}, 2, {22, 0}, {1, 2}},
+   {317, "E-Cell multi-algorithm simulation method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {318, "Gauss-Legendre Runge-Kutta method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {319, "Monte Carlo method", 34,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {320, "BioRica hybrid method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {321, "Cash-Karp method", -1,
+    {0x2000200080000021ULL, 0x0ULL}, 5, {226, 112, 25, 180, 0}, {1, 2, 3, 4, 5}},
+   {322, "hybridity", -1,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {323, "equation-free probabilistic steady-state approximation", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {324, "nested stochastic simulation algorithm", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {325, "minimum fast/discrete reaction occurrences number", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {326, "number of samples", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {327, "maximum discrete number", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {328, "minimum fast rate", -1,
+    {0x1004000ULL, 0x0ULL}, 2, {82, 54}, {1, 2}},
+   {329, "constant-time kinetic Monte Carlo algorithm", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {330, "R-leaping algorithm", -1,
+    {0xc00100001ULL, 0x4000000ULL}, 5, {388, 141, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {331, "exact R-leaping algorithm", -1,
+    {0xc00100001ULL, 0x4000000ULL}, 5, {388, 141, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {332, "ER-leap initial leap", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {333, "accelerated stochastic simulation algorithm", 35,
+    {0x400100001ULL, 0x0ULL}, 3, {76, 127, 0}, {1, 2, 3}},
+   {334, "multiparticle lattice gas automata", -1,
+    {0x20008000041ULL, 0x0ULL}, 4, {26, 92, 167, 0}, {1, 2, 3, 4}},
+   {335, "generalized stochastic simulation algorithm", 36,
+    {0x400100001ULL, 0x0ULL}, 3, {76, 127, 0}, {1, 2, 3}},
+   {336, "D-leaping method", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {337, "finite element method", 37,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {338, "h-version of the finite element method", -1,
+    {0x42000000001ULL, 0x0ULL}, 3, {145, 172, 0}, {1, 2, 3}},
+   {339, "p-version of the finite element method", -1,
+    {0x42000000001ULL, 0x0ULL}, 3, {145, 172, 0}, {1, 2, 3}},
+   {340, "h-p version of the finite element method", -1,
+    {0x42000000001ULL, 0x0ULL}, 3, {145, 172, 0}, {1, 2, 3}},
+   {341, "mixed finite element method", -1,
+    {0x42000000001ULL, 0x0ULL}, 3, {145, 172, 0}, {1, 2, 3}},
+   {342, "level set method", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {343, "generalized finite element method", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {345, "h-p cloud method", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {346, "mesh-based geometry handling", -1,
+    {0x200000400ULL, 0x0ULL}, 2, {121, 43}, {1, 2}},
+   {347, "meshless geometry handling", -1,
+    {0x200000400ULL, 0x0ULL}, 2, {121, 43}, {1, 2}},
+   {348, "extended finite element method", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {349, "method of finite spheres", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {350, "probability-weighted dynamic Monte Carlo method", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {351, "multinomial tau-leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {352, "hybrid method", 38,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {353, "generalized minimal residual algorithm", 39,
+    {0x8010000000001ULL, 0x10000000ULL}, 4, {161, 197, 391, 0}, {1, 2, 3, 4}},
+   {354, "Krylov subspace projection method", 40,
+    {0x8000000000001ULL, 0x10000000ULL}, 3, {197, 391, 0}, {1, 2, 3}},
+   {355, "DASPK", -1,
+    {0x840000000000001ULL, 0xc0000000ULL}, 5, {223, 202, 398, 397, 0}, {1, 2, 3, 4, 5}},
+   {356, "DASSL", -1,
+    {0x840000000000001ULL, 0xc0000000ULL}, 5, {223, 202, 398, 397, 0}, {1, 2, 3, 4, 5}},
+   {357, "conjugate gradient method", -1,
+    {0x8010000000001ULL, 0x10000000ULL}, 4, {161, 197, 391, 0}, {1, 2, 3, 4}},
+   {358, "biconjugate gradient method", -1,
+    {0x8010000000001ULL, 0x10000000ULL}, 4, {161, 197, 391, 0}, {1, 2, 3, 4}},
+   {362, "implicit-state Doob-Gillespie algorithm", -1,
+    {0x20000000003ULL, 0x0ULL}, 3, {3, 167, 0}, {1, 2, 3}},
+   {363, "rule-based simulation method", 41,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {364, "Adams predictor-corrector method", -1,
+    {0x50000001ULL, 0x0ULL}, 3, {106, 99, 0}, {1, 2, 3}},
+   {365, "NDSolve method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {366, "symplecticness", -1,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {367, "partitioned Runge-Kutta method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {369, "partial differential equation discretization method", 42,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {370, "type of problem", 43,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {371, "stochastic differential equation problem", -1,
+    {0x10080000000400ULL, 0x0ULL}, 3, {200, 173, 43}, {1, 2, 3}},
+   {372, "partial differential equation problem", -1,
+    {0x10080000000400ULL, 0x0ULL}, 3, {200, 173, 43}, {1, 2, 3}},
+   {373, "differential-algebraic equation problem", -1,
+    {0x10080000000400ULL, 0x0ULL}, 3, {200, 173, 43}, {1, 2, 3}},
+   {374, "ordinary differential equation problem", -1,
+    {0x10080000000400ULL, 0x0ULL}, 3, {200, 173, 43}, {1, 2, 3}},
+   {375, "delay differential equation problem", -1,
+    {0x10080000000400ULL, 0x0ULL}, 3, {200, 173, 43}, {1, 2, 3}},
+   {376, "linearity of equation", 44,
+    {0x80000000400ULL, 0x0ULL}, 2, {173, 43}, {1, 2}},
+   {377, "one-step method", 45,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {378, "implicit midpoint rule", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {379, "Bulirsch-Stoer algorithm", -1,
+    {0x600000000001ULL, 0x0ULL}, 3, {183, 180, 0}, {1, 2, 3}},
+   {380, "Richardson extrapolation based method", 46,
+    {0x200000000001ULL, 0x0ULL}, 2, {180, 0}, {1, 2}},
+   {381, "midpoint method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {382, "modified midpoint method", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {383, "Bader-Deuflhard method", -1,
+    {0x600000000001ULL, 0x0ULL}, 3, {183, 180, 0}, {1, 2, 3}},
+   {384, "semi-implicit midpoint rule", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {386, "scaled preconditioned generalized minimal residual method", -1,
+    {0x8018000000001ULL, 0x10000000ULL}, 5, {160, 161, 197, 391, 0}, {1, 2, 3, 4, 5}},
+   {388, "minimal residual method", -1,
+    {0x8010000000001ULL, 0x10000000ULL}, 4, {161, 197, 391, 0}, {1, 2, 3, 4}},
+   {389, "quasi-minimal residual method", 47,
+    {0xe010000000001ULL, 0x10000000ULL}, 6, {192, 194, 161, 197, 391, 0}, {1, 2, 3, 4, 5, 6}},
+   {392, "biconjugate gradient stabilized method", 48,
+    {0xc010000000001ULL, 0x10000000ULL}, 5, {194, 161, 197, 391, 0}, {1, 2, 3, 4, 5}},
+   {393, "ingenious conjugate gradients-squared method", 49,
+    {0xc010000000001ULL, 0x10000000ULL}, 5, {194, 161, 197, 391, 0}, {1, 2, 3, 4, 5}},
+   {394, "quasi-minimal residual variant of biconjugate gradient stabilized method", -1,
+    {0xd010000000001ULL, 0x10000000ULL}, 6, {191, 194, 161, 197, 391, 0}, {1, 2, 3, 4, 5, 6}},
+   {395, "improved biconjugate gradient method", 50,
+    {0x8010000000001ULL, 0x10000000ULL}, 4, {161, 197, 391, 0}, {1, 2, 3, 4}},
+   {396, "transpose-free quasi-minimal residual algorithm", -1,
+    {0xe810000000001ULL, 0x10000000ULL}, 7, {190, 192, 194, 161, 197, 391, 0}, {1, 2, 3, 4, 5, 6, 7}},
+   {397, "preconditioning technique", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {398, "iterative method for solving a system of linear equations", 51,
+    {0x1ULL, 0x10000000ULL}, 2, {391, 0}, {1, 2}},
+   {403, "homogeneousness of equation", -1,
+    {0x180000000400ULL, 0x0ULL}, 3, {179, 173, 43}, {1, 2, 3}},
+   {404, "symmetricity of matrix", -1,
+    {0x80000000400ULL, 0x0ULL}, 2, {173, 43}, {1, 2}},
+   {405, "type of differential equation", 52,
+    {0x80000000400ULL, 0x0ULL}, 2, {173, 43}, {1, 2}},
+   {407, "steady state method", 53,
+    {0x1ULL, 0x8000000ULL}, 2, {0, 389}, {1, 1}},
+   {408, "Newton-type method", 54,
+    {0x1ULL, 0xc0000000ULL}, 3, {398, 397, 0}, {1, 2, 3}},
+   {409, "ordinary Newton method", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {410, "simlified Newton method", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {411, "Newton-like method", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {412, "inexact Newton method", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {413, "exact Newton method", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {415, "maximum number of steps", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {416, "partial least squares regression method", -1,
+    {0x180000000000001ULL, 0x0ULL}, 3, {216, 212, 0}, {1, 2, 3}},
+   {417, "hierarchical cluster-based partial least squares regression method", -1,
+    {0x180000000000001ULL, 0x0ULL}, 3, {216, 212, 0}, {1, 2, 3}},
+   {418, "N-way partial least squares regression method", -1,
+    {0x180000000000001ULL, 0x0ULL}, 3, {216, 212, 0}, {1, 2, 3}},
+   {419, "metamodelling method", 55,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {420, "number of partial least squares components", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {421, "type of validation", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {422, "number of N-way partial least squares regression factors", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {423, "partial least squares regression-like method", 56,
+    {0x80000000000001ULL, 0x0ULL}, 2, {212, 0}, {1, 2}},
+   {424, "mean-centring of variables", -1,
+    {0x400000000004000ULL, 0x0ULL}, 2, {222, 54}, {1, 2}},
+   {425, "standardising of variables", -1,
+    {0x400000000004000ULL, 0x0ULL}, 2, {222, 54}, {1, 2}},
+   {427, "number of clusters", -1,
+    {0x200000000004000ULL, 0x0ULL}, 2, {221, 54}, {1, 2}},
+   {428, "matrix for clusterization", -1,
+    {0x200000000004000ULL, 0x0ULL}, 2, {221, 54}, {1, 2}},
+   {429, "clusterization parameter", 57,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {430, "variables preprocessing parameter", 58,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {432, "IDA-like method", 59,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {433, "CVODE-like method", 60,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {434, "Higham-Hall method", -1,
+    {0x2000200080000021ULL, 0x0ULL}, 5, {226, 112, 25, 180, 0}, {1, 2, 3, 4, 5}},
+   {435, "embedded Runge-Kutta 5(4) method", 61,
+    {0x200080000021ULL, 0x0ULL}, 4, {112, 25, 180, 0}, {1, 2, 3, 4}},
+   {436, "Dormand-Prince 8(5,3) method", -1,
+    {0x200080000021ULL, 0x0ULL}, 4, {112, 25, 180, 0}, {1, 2, 3, 4}},
+   {437, "flux balance analysis", 62,
+    {0x20000000000001ULL, 0x8000000ULL}, 3, {201, 389, 0}, {1, 1, 2}},
+   {447, "COAST", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {448, "logical model simulation method", 63,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {449, "synchronous logical model simulation method", -1,
+    {0x8000000000000001ULL, 0x0ULL}, 2, {230, 0}, {1, 2}},
+   {450, "asynchronous logical model simulation method", 64,
+    {0x8000000000000001ULL, 0x0ULL}, 2, {230, 0}, {1, 2}},
+   {451, "type of updating policy", 65,
+    {0x400ULL, 0x0ULL}, 1, {43}, {1}},
+   {452, "random updating policy", 66,
+    {0x400ULL, 0x2ULL}, 2, {233, 43}, {1, 2}},
+   {453, "ordered updating policy", 67,
+    {0x400ULL, 0x2ULL}, 2, {233, 43}, {1, 2}},
+   {454, "constant updating policy", -1,
+    {0x400ULL, 0xaULL}, 3, {235, 233, 43}, {1, 2, 3}},
+   {455, "prioritized updating policy", -1,
+    {0x400ULL, 0xaULL}, 3, {235, 233, 43}, {1, 2, 3}},
+   {467, "maximum step size", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {468, "maximal timestep method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {469, "maximal timestep", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {470, "optimization algorithm", 68,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {471, "local optimization algorithm", 69,
+    {0x1ULL, 0x10ULL}, 2, {241, 0}, {1, 2}},
+   {472, "global optimization algorithm", 70,
+    {0x1ULL, 0x10ULL}, 2, {241, 0}, {1, 2}},
+   {473, "Bayesian inference algorithm", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {475, "integration method", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {476, "iteration type", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {477, "linear solver", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {478, "preconditioner", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {479, "upper half-bandwidth", -1,
+    {0x4000ULL, 0x80ULL}, 2, {252, 54}, {1, 2}},
+   {480, "lower half-bandwidth", -1,
+    {0x4000ULL, 0x80ULL}, 2, {252, 54}, {1, 2}},
+   {481, "interpolate solution", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {482, "half-bandwith parameter", 71,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {483, "step size", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {484, "maximum order", 72,
+    {0x404000ULL, 0x400000ULL}, 3, {361, 78, 54}, {1, 2, 3}},
+   {485, "minimum step size", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {486, "maximum iterations", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {487, "minimum damping", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {488, "seed", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {491, "discrete event simulation algorithm", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {492, "asynchronous updating policy", 73,
+    {0x400ULL, 0x2ULL}, 2, {233, 43}, {1, 2}},
+   {493, "synchronous updating policy", -1,
+    {0x400ULL, 0x2ULL}, 2, {233, 43}, {1, 2}},
+   {494, "fully asynchronous updating policy", -1,
+    {0x400ULL, 0x202ULL}, 3, {260, 233, 43}, {1, 2, 3}},
+   {495, "random asynchronous updating policy", -1,
+    {0x400ULL, 0x206ULL}, 4, {234, 260, 233, 43}, {1, 1, 2, 3}},
+   {496, "CVODES", -1,
+    {0x1000000000000001ULL, 0x0ULL}, 2, {224, 0}, {1, 2}},
+   {497, "KLU", -1,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {498, "number of runs", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {499, "dynamic flux balance analysis", 74,
+    {0x4000000001ULL, 0x8000000ULL}, 3, {159, 389, 0}, {1, 1, 2}},
+   {500, "SOA-DFBA", -1,
+    {0x4000000001ULL, 0x8000400ULL}, 4, {267, 159, 389, 0}, {1, 2, 2, 3}},
+   {501, "DOA-DFBA", -1,
+    {0x4000000001ULL, 0x8000400ULL}, 4, {267, 159, 389, 0}, {1, 2, 2, 3}},
+   {502, "DA-DFBA", -1,
+    {0x4000000001ULL, 0x8000400ULL}, 4, {267, 159, 389, 0}, {1, 2, 2, 3}},
+   {503, "simulated annealing", -1,
+    {0x1ULL, 0x50ULL}, 3, {243, 241, 0}, {1, 2, 3}},
+   {504, "random search", -1,
+    {0x1ULL, 0x50ULL}, 3, {243, 241, 0}, {1, 2, 3}},
+   {505, "particle swarm", -1,
+    {0x1ULL, 0x50ULL}, 3, {243, 241, 0}, {1, 2, 3}},
+   {506, "genetic algorithm", 75,
+    {0x1ULL, 0x4050ULL}, 4, {288, 243, 241, 0}, {1, 2, 3, 4}},
+   {507, "genetic algorithm SR", -1,
+    {0x1ULL, 0x4850ULL}, 5, {274, 288, 243, 241, 0}, {1, 2, 3, 4, 5}},
+   {508, "evolutionary programming", 76,
+    {0x1ULL, 0x4050ULL}, 4, {288, 243, 241, 0}, {1, 2, 3, 4}},
+   {509, "evolutionary strategy", -1,
+    {0x1ULL, 0x5050ULL}, 5, {276, 288, 243, 241, 0}, {1, 2, 3, 4, 5}},
+   {510, "truncated Newton", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {511, "steepest descent", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {512, "praxis", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {513, "NL2SOL", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {514, "Nelder-Mead", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {515, "Levenberg-Marquardt", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {516, "Hooke&Jeeves", -1,
+    {0x1ULL, 0x30ULL}, 3, {242, 241, 0}, {1, 2, 3}},
+   {517, "number of generations", -1,
+    {0x4000ULL, 0x2000ULL}, 2, {286, 54}, {1, 2}},
+   {518, "evolutionary algorithm parameter", 77,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {519, "population size", -1,
+    {0x4000ULL, 0x2000ULL}, 2, {286, 54}, {1, 2}},
+   {520, "evolutionary algorithm", 78,
+    {0x1ULL, 0x50ULL}, 3, {243, 241, 0}, {1, 2, 3}},
+   {521, "simulated annealing parameter", 79,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {522, "start temperature", -1,
+    {0x4000ULL, 0x8000ULL}, 2, {289, 54}, {1, 2}},
+   {523, "cooling factor", -1,
+    {0x4000ULL, 0x8000ULL}, 2, {289, 54}, {1, 2}},
+   {524, "partitioned leaping method", -1,
+    {0xc00100009ULL, 0x4000000ULL}, 6, {16, 388, 141, 76, 127, 0}, {1, 2, 3, 4, 5, 6}},
+   {525, "stop condition", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {526, "flux variability analysis", -1,
+    {0x20000000000001ULL, 0x8000000ULL}, 3, {201, 389, 0}, {1, 1, 2}},
+   {527, "geometric flux balance analysis", -1,
+    {0x4020000000000001ULL, 0x8000000ULL}, 4, {228, 201, 389, 0}, {1, 2, 2, 3}},
+   {528, "parsimonious enzyme usage flux balance analysis (minimum sum of absolute fluxes)", -1,
+    {0x4020000000000001ULL, 0xa000000ULL}, 5, {387, 228, 201, 389, 0}, {1, 2, 3, 3, 4}},
+   {529, "parallelism", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {531, "fraction of optimum", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {532, "loopless", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {533, "pFBA factor", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {534, "reactions", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {535, "VODE", -1,
+    {0x1000000000000001ULL, 0x0ULL}, 2, {224, 0}, {1, 2}},
+   {536, "ZVODE", -1,
+    {0x1000000000000001ULL, 0x0ULL}, 2, {224, 0}, {1, 2}},
+   {537, "explicit Runge-Kutta method of order 3(2)", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {538, "safety factor on new step selection", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {539, "minimum factor to change step size by", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {540, "maximum factor to change step size by", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {541, "Beta parameter for stabilized step size control", -1,
+    {0x604000ULL, 0x0ULL}, 3, {77, 78, 54}, {1, 1, 2}},
+   {542, "correction step should use internally generated full Jacobian", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {543, "stability limit detection flag", -1,
+    {0x604000ULL, 0x0ULL}, 3, {77, 78, 54}, {1, 1, 2}},
+   {544, "IDAS", -1,
+    {0x840000000000001ULL, 0xc0000000ULL}, 5, {223, 202, 398, 397, 0}, {1, 2, 3, 4, 5}},
+   {545, "include sensitivity variables in error control mechanism", -1,
+    {0x604000ULL, 0x0ULL}, 3, {77, 78, 54}, {1, 1, 2}},
+   {546, "convex optimization algorithm", 80,
+    {0x1ULL, 0x50ULL}, 3, {243, 241, 0}, {1, 2, 3}},
+   {547, "linear programming", 81,
+    {0x1ULL, 0x10050ULL}, 4, {313, 243, 241, 0}, {1, 2, 3, 4}},
+   {548, "quadratic programming", -1,
+    {0x1ULL, 0x40050ULL}, 4, {316, 243, 241, 0}, {1, 2, 3, 4}},
+   {549, "non-linear programming", 82,
+    {0x1ULL, 0x50ULL}, 3, {243, 241, 0}, {1, 2, 3}},
+   {550, "simplex method", -1,
+    {0x1ULL, 0x30050ULL}, 5, {314, 313, 243, 241, 0}, {1, 2, 3, 4, 5}},
+   {551, "primal-dual interior point method", -1,
+    {0x1ULL, 0x30050ULL}, 5, {314, 313, 243, 241, 0}, {1, 2, 3, 4, 5}},
+   {552, "optimization method", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {553, "optimization solver", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {554, "parsimonius flux balance analysis (minimum number of active fluxes)", -1,
+    {0x4020000000000001ULL, 0xa000000ULL}, 5, {387, 228, 201, 389, 0}, {1, 2, 3, 3, 4}},
+   {555, "absolute quadrature tolerance", -1,
+    {0x214000ULL, 0x1000000ULL}, 4, {59, 364, 77, 54}, {1, 2, 3, 4}},
+   {556, "relative quadrature tolerance", -1,
+    {0x20c000ULL, 0x1000000ULL}, 4, {58, 364, 77, 54}, {1, 2, 3, 4}},
+   {557, "absolute steady-state tolerance", -1,
+    {0x214000ULL, 0x1000000ULL}, 4, {59, 364, 77, 54}, {1, 2, 3, 4}},
+   {558, "relative steady-state tolerance", -1,
+    {0x20c000ULL, 0x1000000ULL}, 4, {58, 364, 77, 54}, {1, 2, 3, 4}},
+   {559, "initial step size", -1,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {560, "LSODA/LSODAR hybrid method", -1,
+    {0x101ULL, 0x0ULL}, 2, {41, 0}, {1, 2}},
+   {561, "Pahle hybrid Gibson-Bruck Next Reaction method/Runge-Kutta method", -1,
+    {0x4000020001ULL, 0x0ULL}, 3, {66, 159, 0}, {1, 2, 3}},
+   {562, "Pahle hybrid Gibson-Bruck Next Reaction method/LSODA method", -1,
+    {0x4000020001ULL, 0x0ULL}, 3, {66, 159, 0}, {1, 2, 3}},
+   {563, "Pahle hybrid Gibson-Bruck Next Reaction method/RK-45 method", -1,
+    {0x4000020001ULL, 0x0ULL}, 3, {66, 159, 0}, {1, 2, 3}},
+   {564, "stochastic Runge-Kutta method", 83,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {565, "absolute tolerance for root finding", -1,
+    {0x214000ULL, 0x1000000ULL}, 4, {59, 364, 77, 54}, {1, 2, 3, 4}},
+   {566, "stochastic second order Runge-Kutta method", -1,
+    {0x200000000021ULL, 0x80000ULL}, 4, {331, 25, 180, 0}, {1, 2, 3, 4}},
+   {567, "force physical correctness", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {568, "NLEQ1", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {569, "NLEQ2", -1,
+    {0x40000000000001ULL, 0xc0000000ULL}, 4, {202, 398, 397, 0}, {1, 2, 3, 4}},
+   {570, "auto reduce tolerances", -1,
+    {0x604000ULL, 0x0ULL}, 3, {77, 78, 54}, {1, 1, 2}},
+   {571, "absolute tolerance adjustment factor", -1,
+    {0x204000ULL, 0x1000000ULL}, 3, {364, 77, 54}, {1, 2, 3}},
+   {572, "level of superimposed noise", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {573, "probabilistic logical model simulation method", -1,
+    {0x8000000400000001ULL, 0x0ULL}, 3, {127, 230, 0}, {1, 1, 2}},
+   {574, "species transition probabilities", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {575, "Hybrid tau-leaping method", -1,
+    {0x4c00100009ULL, 0x4000000ULL}, 7, {16, 159, 0, 388, 141, 76, 127}, {1, 1, 2, 2, 3, 4, 5}},
+   {576, "Quadratic MOMA", -1,
+    {0x20000000000001ULL, 0x8200000ULL}, 4, {360, 201, 389, 0}, {1, 2, 2, 3}},
+   {577, "flux minimization weight", -1,
+    {0x4000ULL, 0x0ULL}, 1, {54}, {1}},
+   {578, "nested algorithm", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {579, "Linear MOMA", -1,
+    {0x20000000000001ULL, 0x8200000ULL}, 4, {360, 201, 389, 0}, {1, 2, 2, 3}},
+   {580, "ROOM", -1,
+    {0x20000000000001ULL, 0x8000000ULL}, 3, {201, 389, 0}, {1, 1, 2}},
+   {581, "BKMC", -1,
+    {0x8000000400000001ULL, 0x1ULL}, 4, {127, 232, 0, 230}, {1, 1, 2, 2}},
+   {582, "Spatiocyte method", -1,
+    {0x11ULL, 0x0ULL}, 2, {22, 0}, {1, 2}},
+   {583, "minimum order", -1,
+    {0x404000ULL, 0x400000ULL}, 3, {361, 78, 54}, {1, 2, 3}},
+   {584, "initial order", -1,
+    {0x404000ULL, 0x400000ULL}, 3, {361, 78, 54}, {1, 2, 3}},
+   {585, "TOMS731", -1,
+    {0x40000000001ULL, 0x0ULL}, 2, {172, 0}, {1, 2}},
+   {586, "Gibson-Bruck next reaction algorithm with indexed priority queue", -1,
+    {0xc00100005ULL, 0x0ULL}, 5, {8, 141, 76, 127, 0}, {1, 2, 3, 4, 5}},
+   {587, "IMEX", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {588, "flux sampling", 84,
+    {0x20000000000001ULL, 0x8000000ULL}, 3, {201, 0, 389}, {1, 2, 2}},
+   {589, "ACB flux sampling method", -1,
+    {0x20000000000001ULL, 0x8100000ULL}, 4, {355, 201, 0, 389}, {1, 2, 3, 3}},
+   {590, "ACHR flux sampling method", -1,
+    {0x20000000000001ULL, 0x8100000ULL}, 4, {355, 201, 0, 389}, {1, 2, 3, 3}},
+   {591, "mdFBA", -1,
+    {0x4020000000000001ULL, 0x8000000ULL}, 4, {228, 201, 389, 0}, {1, 2, 2, 3}},
+   {592, "dynamic rFBA", -1,
+    {0x4000000001ULL, 0x8800000ULL}, 4, {362, 159, 389, 0}, {1, 2, 2, 3}},
+   {593, "MOMA", 85,
+    {0x20000000000001ULL, 0x8000000ULL}, 3, {201, 389, 0}, {1, 1, 2}},
+   {594, "order", 86,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {595, "rFBA", 87,
+    {0x4000000001ULL, 0x8000000ULL}, 3, {159, 389, 0}, {1, 1, 2}},
+   {596, "srFBA", -1,
+    {0x4020004000000001ULL, 0x8800000ULL}, 6, {228, 362, 159, 201, 389, 0}, {1, 1, 2, 2, 2, 3}},
+   {597, "tolerance", 88,
+    {0x204000ULL, 0x0ULL}, 2, {77, 54}, {1, 2}},
+   {598, "Hybrid Gibson - Milstein Method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {599, "Hybrid Gibson - Euler-Maruyama Method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {600, "Hybrid Adaptive Gibson - Milstein Method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {601, "Number of trials", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {602, "Minimum species threshold for continuous approximation", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {603, "Minimum reaction rate for continuous approximation", -1,
+    {0x804000ULL, 0x0ULL}, 2, {79, 54}, {1, 2}},
+   {604, "MSR Tolerance", -1,
+    {0x20c000ULL, 0x1000000ULL}, 4, {58, 364, 77, 54}, {1, 2, 3, 4}},
+   {605, "SDE Tolerance", -1,
+    {0x20c000ULL, 0x1000000ULL}, 4, {58, 364, 77, 54}, {1, 2, 3, 4}},
+   {606, "Hierarchical Stochastic Simulation Algorithm", -1,
+    {0x400100001ULL, 0x0ULL}, 3, {76, 127, 0}, {1, 2, 3}},
+   {607, "Hierarchical Fehlberg method", -1,
+    {0x20002000800000a1ULL, 0x0ULL}, 6, {34, 226, 112, 25, 180, 0}, {1, 2, 3, 4, 5, 6}},
+   {608, "Hierarchical flux balance analysis", -1,
+    {0x4020000000000001ULL, 0x8000000ULL}, 4, {228, 201, 389, 0}, {1, 2, 2, 3}},
+   {609, "Embedded Runge-Kutta Prince-Dormand (8,9) method", -1,
+    {0x200080000021ULL, 0x0ULL}, 4, {112, 25, 180, 0}, {1, 2, 3, 4}},
+   {610, "Composite-rejection stochastic simulation algorithm", -1,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {611, "Incremental stochastic simulation algorithm", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {612, "implicit 4th order Runge-Kutta method at Gaussian points", -1,
+    {0x200000000021ULL, 0x0ULL}, 3, {25, 180, 0}, {1, 2, 3}},
+   {613, "Stochastic simulation algorithm with normally-distributed next reaction times", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {614, "Implementation", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {615, "fully-implicit regular grid finite volume method with a variable time step", -1,
+    {0x40020000001ULL, 0x0ULL}, 3, {102, 172, 0}, {1, 2, 3}},
+   {616, "semi-implicit regular grid finite volume method with a fixed time step", -1,
+    {0x40020000001ULL, 0x0ULL}, 3, {102, 172, 0}, {1, 2, 3}},
+   {617, "IDA-CVODE hybrid method", -1,
+    {0x4000000001ULL, 0x0ULL}, 2, {159, 0}, {1, 2}},
+   {618, "bunker", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {619, "emc-sim", -1,
+    {0x1400100001ULL, 0x0ULL}, 4, {143, 76, 127, 0}, {1, 2, 3, 4}},
+   {620, "parsimonius flux balance analysis", 89,
+    {0x4020000000000001ULL, 0x8000000ULL}, 4, {228, 201, 389, 0}, {1, 2, 2, 3}},
+   {621, "stochastic simulation leaping method", 90,
+    {0xc00100001ULL, 0x0ULL}, 4, {141, 76, 127, 0}, {1, 2, 3, 4}},
+   {622, "flux balance method", 91,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {623, "flux balance problem", -1,
+    {0x80000000400ULL, 0x0ULL}, 2, {173, 43}, {1, 2}},
+   {624, "method for solving a system of linear equations", 92,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {625, "dense direct solver", -1,
+    {0x1ULL, 0x10000000ULL}, 2, {391, 0}, {1, 2}},
+   {626, "band direct solver", -1,
+    {0x1ULL, 0x10000000ULL}, 2, {391, 0}, {1, 2}},
+   {627, "diagonal approximate Jacobian solver", -1,
+    {0x1ULL, 0x10000000ULL}, 2, {391, 0}, {1, 2}},
+   {628, "modelling and simulation algorithm parameter value", 93,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {629, "Null", -1,
+    {0x0ULL, 0x20000000ULL}, 1, {395}, {1}},
+   {630, "root-finding method", 94,
+    {0x1ULL, 0x0ULL}, 1, {0}, {1}},
+   {631, "iterative root-finding method", 95,
+    {0x1ULL, 0x40000000ULL}, 2, {397, 0}, {1, 2}},
+   {632, "functional iteration root-finding method", -1,
+    {0x1ULL, 0xc0000000ULL}, 3, {398, 397, 0}, {1, 2, 3}},
+   {633, "computational function", 96,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {634, "scaled property", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {635, "unscaled property", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {636, "primary property", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {637, "derived property", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {638, "level", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {639, "flux", 97,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {640, "lower bound", -1,
+    {0x0ULL, 0x2400000000ULL}, 2, {408, 444}, {1, 2}},
+   {641, "bound", 98,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {642, "minimum flux", -1,
+    {0x0ULL, 0x8200000000ULL}, 2, {406, 453}, {1, 2}},
+   {643, "upper bound", -1,
+    {0x0ULL, 0x2400000000ULL}, 2, {408, 444}, {1, 2}},
+   {644, "maximum flux", -1,
+    {0x0ULL, 0x8200000000ULL}, 2, {406, 453}, {1, 2}},
+   {645, "objective value", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {646, "propensity", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {647, "derivative", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {648, "step", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {649, "shadow price", -1,
+    {0x0ULL, 0x8800000000ULL}, 2, {417, 453}, {1, 2}},
+   {650, "sensitivity", 99,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {651, "reduced costs", -1,
+    {0x0ULL, 0x8800000000ULL}, 2, {417, 453}, {1, 2}},
+   {652, "concentration rate", -1,
+    {0x0ULL, 0x18000000000ULL}, 2, {455, 453}, {1, 2}},
+   {653, "particle number rate", -1,
+    {0x0ULL, 0x18000000000ULL}, 2, {455, 453}, {1, 2}},
+   {654, "amount rate", -1,
+    {0x0ULL, 0x18000000000ULL}, 2, {455, 453}, {1, 2}},
+   {655, "rate", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {656, "use adaptive time steps", -1,
+    {0x404000ULL, 0x0ULL}, 2, {78, 54}, {1, 2}},
+   {800, "systems property", 100,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {801, "Concentration control coefficient matrix (unscaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {802, "Control coefficient (scaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {803, "Control coefficient (unscaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {804, "Elasticity matrix (unscaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {805, "Elasticity coefficient (unscaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {806, "Elasticity matrix (scaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {807, "Elasticity coefficient (scaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {808, "Reduced stoichiometry matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {809, "Reduced Jacobian matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {810, "Reduced eigenvalue matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {811, "Stoichiometry matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {812, "Jacobian matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {813, "Eigenvalue matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {814, "Flux control coefficient matrix (unscaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {815, "Flux control coefficient matrix (scaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {816, "Link matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {817, "Kernel matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {818, "L0 matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {819, "Nr matrix", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {820, "model and simulation property characteristic", 101,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {821, "intensive property", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {822, "extensive property", -1,
+    {0x0ULL, 0x2000000000ULL}, 1, {444}, {1}},
+   {824, "aggregation function", 102,
+    {0x0ULL, 0x100000000ULL}, 1, {400}, {1}},
+   {825, "mean", -1,
+    {0x0ULL, 0x4100000000ULL}, 2, {447, 400}, {1, 2}},
+   {826, "standard deviation", -1,
+    {0x0ULL, 0x4100000000ULL}, 2, {447, 400}, {1, 2}},
+   {827, "standard error", -1,
+    {0x0ULL, 0x4100000000ULL}, 2, {447, 400}, {1, 2}},
+   {828, "maximum", -1,
+    {0x0ULL, 0x4100000000ULL}, 2, {447, 400}, {1, 2}},
+   {829, "minimum", -1,
+    {0x0ULL, 0x4100000000ULL}, 2, {447, 400}, {1, 2}},
+   {831, "model and simulation property", 103,
+    {0x0ULL, 0x0ULL}, 0, {}, {}},
+   {832, "time", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {834, "rate of change", 104,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {835, "Concentration control coefficient matrix (scaled)", -1,
+    {0x0ULL, 0x9000000000ULL}, 2, {424, 453}, {1, 2}},
+   {836, "amount", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {837, "particle number", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {838, "concentration", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+   {839, "temperature", -1,
+    {0x0ULL, 0x8000000000ULL}, 1, {453}, {1}},
+};
+
+constexpr unsigned int kisaoNumTerms = 461;
+
+constexpr int kisaoMaxID = 839;
+
+constexpr short kisaoTermIndex[] = {
+   0, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2,
+   -1, 3, -1, 4, 5, 6, 7, -1, -1, -1, -1, 8, 9, 10, 11, 12,
+   13, 14, -1, -1, -1, -1, 15, 16, 17, -1, -1, -1, -1, 18, 19, -1,
+   20, -1, -1, 21, -1, -1, -1, -1, 22, 23, 24, -1, -1, -1, -1, -1,
+   25, -1, -1, -1, 26, -1, -1, 27, -1, -1, 28, 29, 30, -1, -1, -1,
+   -1, 31, 32, -1, 33, -1, 34, 35, 36, 37, 38, 39, -1, 40, 41, 42,
+   -1, 43, 44, 45, 46, -1, 47, 48, 49, 50, 51, 52, 53, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, 54, -1, 55, 56, 57, -1, -1,
+   -1, 58, -1, 59, -1, -1, -1, -1, 60, -1, -1, 61, 62, -1, -1, 63,
+   -1, -1, -1, -1, 64, -1, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+   75, 76, 77, 78, 79, -1, -1, -1, 80, 81, -1, -1, 82, 83, 84, 85,
+   86, 87, 88, -1, 89, 90, -1, 91, 92, -1, -1, -1, -1, -1, -1, -1,
+   -1, 93, 94, -1, 95, -1, 96, 97, 98, 99, 100, 101, -1, 102, 103, 104,
+   105, 106, 107, -1, -1, -1, -1, -1, 108, 109, -1, 110, -1, 111, 112, 113,
+   114, 115, 116, 117, 118, 119, 120, 121, -1, -1, 122, 123, 124, 125, 126, 127,
+   128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+   144, 145, 146, 147, 148, 149, 150, 151, -1, 152, 153, 154, 155, 156, 157, 158,
+   159, 160, 161, 162, 163, 164, 165, -1, -1, -1, 166, 167, 168, 169, 170, 171,
+   -1, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
+   187, -1, 188, -1, 189, 190, -1, -1, 191, 192, 193, 194, 195, 196, 197, -1,
+   -1, -1, -1, 198, 199, 200, -1, 201, 202, 203, 204, 205, 206, 207, -1, 208,
+   209, 210, 211, 212, 213, 214, 215, 216, 217, 218, -1, 219, 220, 221, 222, -1,
+   223, 224, 225, 226, 227, 228, -1, -1, -1, -1, -1, -1, -1, -1, -1, 229,
+   230, 231, 232, 233, 234, 235, 236, 237, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, 238, 239, 240, 241, 242, 243, 244, -1, 245, 246, 247, 248, 249,
+   250, 251, 252, 253, 254, 255, 256, 257, 258, -1, -1, 259, 260, 261, 262, 263,
+   264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+   280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+   296, 297, -1, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310,
+   311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326,
+   327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342,
+   343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+   359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+   375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390,
+   391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406,
+   407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+   423, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439,
+   440, 441, 442, 443, 444, 445, 446, -1, 447, 448, 449, 450, 451, 452, -1, 453,
+   454, -1, 455, 456, 457, 458, 459, 460,
 };
+
+/** @endcond */
+
+LIBSEDML_CPP_NAMESPACE_END
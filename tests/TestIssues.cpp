@@ -38,6 +38,7 @@
  */
 
 #include "catch.hpp"
+#include <cmath>
 #include <limits>
 
 #include <iostream>
@@ -55,6 +56,7 @@
 #include <sbml/math/L3Parser.h>
 
 #include <sedml/SedTypes.h>
+#include <cstdio>
 #include <cstdlib>
 
 /** @cond doxygenIgnored */
@@ -932,3 +934,1363 @@ TEST_CASE("Create Analysis simulation", "[sedml]")
 
 }
 
+
+TEST_CASE("getElementBySId stays current after edits", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    auto* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    auto* var = dg->createVariable();
+    var->setId("v0");
+
+    REQUIRE(doc.getElementBySId("dg1") == dg);
+    REQUIRE(doc.getElementBySId("v0") == var);
+    REQUIRE(doc.getElementBySId("v1") == NULL);
+
+    // added after the index was built
+    auto* var1 = dg->createVariable();
+    var1->setId("v1");
+    REQUIRE(doc.getElementBySId("v1") == var1);
+
+    // renamed
+    var->setId("v2");
+    REQUIRE(doc.getElementBySId("v0") == NULL);
+    REQUIRE(doc.getElementBySId("v2") == var);
+    var->unsetId();
+    REQUIRE(doc.getElementBySId("v2") == NULL);
+
+    // removed without being deleted
+    SedVariable* removed = dg->removeVariable("v1");
+    REQUIRE(removed == var1);
+    REQUIRE(doc.getElementBySId("v1") == NULL);
+    removed->setId("v3");
+    REQUIRE(doc.getElementBySId("v3") == NULL);
+    delete removed;
+
+    // removed and deleted
+    REQUIRE(dg->removeFromParentAndDelete() == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(doc.getElementBySId("dg1") == NULL);
+
+    // duplicates resolve to the first element in document order
+    auto* m1 = doc.createModel();
+    m1->setId("dup");
+    auto* m2 = doc.createModel();
+    m2->setId("dup");
+    REQUIRE(doc.getElementBySId("dup") == m1);
+    delete doc.removeModel(0u);
+    REQUIRE(doc.getElementBySId("dup") == m2);
+}
+
+
+TEST_CASE("id lookup in large lists", "[sedml]")
+{
+    SedDataGenerator dg(1, 4);
+    for (int i = 0; i < 50; ++i)
+    {
+        auto* var = dg.createVariable();
+        var->setId("v" + std::to_string(i));
+    }
+
+    REQUIRE(dg.getVariable("v0") == dg.getVariable(0u));
+    REQUIRE(dg.getVariable("v49") == dg.getVariable(49u));
+    REQUIRE(dg.getVariable("v50") == NULL);
+
+    // positions shift after a removal
+    delete dg.removeVariable("v10");
+    REQUIRE(dg.getVariable("v10") == NULL);
+    REQUIRE(dg.getVariable("v11") == dg.getVariable(10u));
+    REQUIRE(dg.getVariable("v49") == dg.getVariable(48u));
+
+    // ... and after an insertion
+    SedVariable var(1, 4);
+    var.setId("first");
+    REQUIRE(dg.getListOfVariables()->insert(0, &var) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(dg.getVariable("first") == dg.getVariable(0u));
+    REQUIRE(dg.getVariable("v49") == dg.getVariable(49u));
+
+    // renamed items are found under their new id only
+    dg.getVariable("v20")->setId("renamed");
+    REQUIRE(dg.getVariable("v20") == NULL);
+    REQUIRE(dg.getVariable("renamed") == dg.getVariable(20u));
+
+    // duplicates resolve to the first occurrence
+    dg.getVariable("v30")->setId("v5");
+    REQUIRE(dg.getVariable("v5") == dg.getVariable(6u));
+    delete dg.removeVariable(6u);
+    REQUIRE(dg.getVariable("v5") == dg.getVariable(29u));
+}
+
+
+TEST_CASE("getReferencingElements follows reference edits", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    auto* model = doc.createModel();
+    model->setId("m1");
+    auto* t1 = doc.createTask();
+    t1->setId("t1");
+    t1->setModelReference("m1");
+    auto* t2 = doc.createTask();
+    t2->setId("t2");
+    t2->setModelReference("m1");
+    auto* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    auto* var = dg->createVariable();
+    var->setId("v1");
+    var->setTaskReference("t1");
+    var->setModelReference("m1");
+
+    List* refs = doc.getReferencingElements("m1");
+    REQUIRE(refs->getSize() == 3);
+    delete refs;
+
+    refs = doc.getReferencingElements("t1");
+    REQUIRE(refs->getSize() == 1);
+    REQUIRE(refs->get(0) == var);
+    delete refs;
+
+    // edited references
+    var->setTaskReference("t2");
+    t2->unsetModelReference();
+    refs = doc.getReferencingElements("t1");
+    REQUIRE(refs->getSize() == 0);
+    delete refs;
+    refs = doc.getReferencingElements("t2");
+    REQUIRE(refs->getSize() == 1);
+    delete refs;
+    refs = doc.getReferencingElements("m1");
+    REQUIRE(refs->getSize() == 2);
+    delete refs;
+
+    // removed and added elements
+    delete doc.removeTask("t1");
+    refs = doc.getReferencingElements("m1");
+    REQUIRE(refs->getSize() == 1);
+    REQUIRE(refs->get(0) == var);
+    delete refs;
+
+    auto* t3 = doc.createTask();
+    t3->setModelReference("m1");
+    refs = doc.getReferencingElements("m1");
+    REQUIRE(refs->getSize() == 2);
+    delete refs;
+}
+
+
+TEST_CASE("bulk renameSIdRefs on a document", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    auto* t1 = doc.createTask();
+    t1->setId("t1");
+    t1->setModelReference("a");
+    t1->setSimulationReference("s");
+    auto* t2 = doc.createTask();
+    t2->setId("t2");
+    t2->setModelReference("b");
+    auto* dg = doc.createDataGenerator();
+    dg->setId("dg1");
+    auto* var = dg->createVariable();
+    var->setId("x");
+    var->setTaskReference("t1");
+    ASTNode* math = SBML_parseL3Formula("x * y");
+    dg->setMath(math);
+    delete math;
+    auto* curve = doc.createPlot2D()->createCurve();
+    curve->setXDataReference("dg1");
+    curve->setYDataReference("dg1");
+    auto* subChange = doc.createRepeatedTask()->createSubTask()->createTaskChange();
+    math = SBML_parseL3Formula("x + 1");
+    subChange->setMath(math);
+    delete math;
+
+    // swap a and b, chain x -> y -> z, plain rename of dg1 and t1
+    std::map<std::string, std::string> renames;
+    renames["a"] = "b";
+    renames["b"] = "a";
+    renames["x"] = "y";
+    renames["y"] = "z";
+    renames["dg1"] = "dg2";
+    renames["t1"] = "task1";
+    doc.renameSIdRefs(renames);
+
+    REQUIRE(t1->getModelReference() == "b");
+    REQUIRE(t1->getSimulationReference() == "s");
+    REQUIRE(t2->getModelReference() == "a");
+    REQUIRE(var->getTaskReference() == "task1");
+    REQUIRE(curve->getXDataReference() == "dg2");
+    REQUIRE(curve->getYDataReference() == "dg2");
+    REQUIRE(std::string(dg->getMath()->getChild(0)->getName()) == "y");
+    REQUIRE(std::string(dg->getMath()->getChild(1)->getName()) == "z");
+    REQUIRE(std::string(subChange->getMath()->getChild(0)->getName()) == "y");
+
+    // ids themselves are unchanged
+    REQUIRE(var->getId() == "x");
+    REQUIRE(dg->getId() == "dg1");
+
+    List* refs = doc.getReferencingElements("dg2");
+    REQUIRE(refs->getSize() == 1);
+    delete refs;
+}
+
+
+TEST_CASE("elements share their SedNamespaces until modified", "[sedml]")
+{
+    SedDataGenerator dg(1, 4);
+    auto* v1 = dg.createVariable();
+    auto* v2 = dg.createVariable();
+    SedParameter param(1, 4);
+    REQUIRE(v1->getSedNamespaces() == v2->getSedNamespaces());
+    REQUIRE(dg.getSedNamespaces() == param.getSedNamespaces());
+
+    XMLNamespaces xmlns;
+    xmlns.add("http://sed-ml.org/sed-ml/level1/version4");
+    xmlns.add("http://www.example.org/", "ex");
+    REQUIRE(v1->setNamespaces(&xmlns) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(v1->getSedNamespaces() != v2->getSedNamespaces());
+    REQUIRE(v1->getSedNamespaces()->getNamespaces()->hasPrefix("ex"));
+    REQUIRE(!v2->getSedNamespaces()->getNamespaces()->hasPrefix("ex"));
+
+    // copies share the namespaces of the original
+    SedVariable copy(*v1);
+    REQUIRE(copy.getSedNamespaces() == v1->getSedNamespaces());
+}
+
+
+TEST_CASE("elements read from a document share their SedNamespaces", "[sedml]")
+{
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<sedML xmlns=\"http://sed-ml.org/sed-ml/level1/version4\" level=\"1\" version=\"4\">\n"
+      "  <listOfModels>\n"
+      "    <model id=\"m1\" language=\"urn:sedml:language:sbml\" source=\"a.xml\"/>\n"
+      "    <model id=\"m2\" language=\"urn:sedml:language:sbml\" source=\"b.xml\"/>\n"
+      "  </listOfModels>\n"
+      "  <listOfTasks>\n"
+      "    <task id=\"t1\" modelReference=\"m1\"/>\n"
+      "  </listOfTasks>\n"
+      "</sedML>\n";
+
+    SedDocument* doc = readSedMLFromString(xml.c_str());
+    REQUIRE(doc->getNumErrors() == 0);
+
+    // once detached, elements report their own SedNamespaces
+    SedModel* m1 = doc->removeModel(0);
+    SedModel* m2 = doc->removeModel(0);
+    SedAbstractTask* t1 = doc->removeTask(0);
+    REQUIRE(m1->getSedNamespaces() == m2->getSedNamespaces());
+    REQUIRE(m1->getSedNamespaces() == t1->getSedNamespaces());
+    REQUIRE(m1->getSedNamespaces() != doc->getSedNamespaces());
+    REQUIRE(m1->getSedNamespaces()->getNamespaces() == NULL);
+
+    // writing leaves the namespaces of the document shared
+    SedWriter sw;
+    const SedNamespaces* before = doc->getSedNamespaces();
+    std::string written = sw.writeSedMLToStdString(doc);
+    REQUIRE(doc->getSedNamespaces() == before);
+    REQUIRE(written.find("http://sed-ml.org/sed-ml/level1/version4") != std::string::npos);
+
+    delete t1;
+    delete m2;
+    delete m1;
+    delete doc;
+}
+
+
+TEST_CASE("reading a document into an arena", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/noble_1962_local.sedml");
+    SedReader reader;
+    REQUIRE(!reader.getUseArena());
+    SedDocument* heapDoc = reader.readSedMLFromFile(fileName);
+    REQUIRE(heapDoc->getArena() == NULL);
+
+    reader.setUseArena(true);
+    SedDocument* doc = reader.readSedMLFromFile(fileName);
+    REQUIRE(doc->getNumErrors(LIBSEDML_SEV_ERROR) == 0);
+    REQUIRE(doc->getArena() != NULL);
+    REQUIRE(doc->getArena()->getBytesAllocated() > 0);
+    REQUIRE(SedArena::getCurrent() == NULL);
+
+    REQUIRE(doc->getNumModels() == heapDoc->getNumModels());
+    REQUIRE(doc->getNumDataGenerators() == heapDoc->getNumDataGenerators());
+    REQUIRE(doc->getNumOutputs() == heapDoc->getNumOutputs());
+
+    SedWriter sw;
+    REQUIRE(sw.writeSedMLToStdString(doc) == sw.writeSedMLToStdString(heapDoc));
+
+    // elements created in the scope of the arena are placed in it
+    size_t before = doc->getArena()->getBytesAllocated();
+    {
+      SedArena::Scope scope(doc->getArena());
+      doc->createModel()->setId("arena_model");
+    }
+    REQUIRE(doc->getArena()->getBytesAllocated() > before);
+    REQUIRE(SedArena::find(doc->getModel("arena_model")) == doc->getArena());
+    REQUIRE(SedArena::find(heapDoc->getModel(0)) == NULL);
+    delete doc->removeModel("arena_model");
+
+    delete doc;
+    delete heapDoc;
+}
+
+
+TEST_CASE("elements removed from an arena document outlive it", "[sedml]")
+{
+    SedDocument* doc = new SedDocument(1, 4);
+    doc->enableArena();
+    {
+      SedArena::Scope scope(doc->getArena());
+      SedDataGenerator* dg = doc->createDataGenerator();
+      dg->setId("dg");
+      dg->createVariable()->setId("v");
+      doc->createModel()->setId("m1");
+    }
+
+    SedDataGenerator* dg = doc->removeDataGenerator("dg");
+    REQUIRE(dg != NULL);
+    delete doc;
+
+    // the arena stays until the last element placed in it is deleted
+    REQUIRE(dg->getId() == "dg");
+    REQUIRE(dg->getNumVariables() == 1);
+    REQUIRE(dg->getVariable(0)->getId() == "v");
+    dg->setName("still here");
+    REQUIRE(dg->getName() == "still here");
+    delete dg;
+}
+
+
+TEST_CASE("reading from a buffer without copying", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/noble_1962_local.sedml");
+    SedDocument* orig = readSedMLFromFile(fileName.c_str());
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(orig);
+    delete orig;
+
+    // drop the XML declaration, and embed the document in a larger buffer
+    std::string body = xml.substr(xml.find("<sedML"));
+    std::string archive = "PK" + body + "trailing data";
+
+    SedReader reader;
+    SedDocument* doc = reader.readSedMLFromString(body.c_str());
+    REQUIRE(doc->getNumErrors() == 0);
+    std::string expected = sw.writeSedMLToStdString(doc);
+    delete doc;
+
+    doc = reader.readSedMLFromString(archive.data() + 2, body.size());
+    REQUIRE(doc->getNumErrors() == 0);
+    REQUIRE(sw.writeSedMLToStdString(doc) == expected);
+    delete doc;
+
+    doc = reader.readSedMLFromString(xml);
+    REQUIRE(doc->getNumErrors() == 0);
+    REQUIRE(sw.writeSedMLToStdString(doc) == expected);
+    delete doc;
+}
+
+
+TEST_CASE("reading a memory-mapped file", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/noble_1962_local.sedml");
+    SedReader reader;
+    SedDocument* buffered = reader.readSedMLFromFile(fileName);
+
+    reader.setUseMemoryMap(true);
+    REQUIRE(reader.getUseMemoryMap());
+    SedDocument* mapped = reader.readSedMLFromFile(fileName);
+    REQUIRE(mapped->getNumErrors() == buffered->getNumErrors());
+
+    SedWriter sw;
+    REQUIRE(sw.writeSedMLToStdString(mapped) == sw.writeSedMLToStdString(buffered));
+    delete mapped;
+    delete buffered;
+
+    // missing files are still reported
+    SedDocument* missing = reader.readSedMLFromFile(fileName + ".missing");
+    REQUIRE(missing->getNumErrors() == 1);
+    delete missing;
+}
+
+
+class CountingStreamHandler : public SedStreamHandler
+{
+public:
+    CountingStreamHandler(unsigned int limit = 0)
+      : level(0), numModels(0), numOutputs(0), numElements(0), limit(limit)
+    {
+    }
+
+    virtual bool startDocument(const SedDocument& doc)
+    {
+        level = doc.getLevel();
+        return true;
+    }
+
+    virtual bool element(const SedBase& element)
+    {
+        REQUIRE(element.getParentSedObject() == NULL);
+        if (element.getTypeCode() == SEDML_MODEL) ++numModels;
+        if (dynamic_cast<const SedOutput*>(&element) != NULL) ++numOutputs;
+        ids.push_back(element.getId());
+        ++numElements;
+        return limit == 0 || numElements < limit;
+    }
+
+    unsigned int level;
+    unsigned int numModels;
+    unsigned int numOutputs;
+    unsigned int numElements;
+    unsigned int limit;
+    std::vector<std::string> ids;
+};
+
+
+TEST_CASE("streaming the top-level elements of a document", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/noble_1962_local.sedml");
+    SedDocument* full = readSedMLFromFile(fileName.c_str());
+
+    SedReader reader;
+    CountingStreamHandler handler;
+    SedDocument* header = reader.streamSedML(fileName, handler);
+    REQUIRE(header->getNumErrors() == full->getNumErrors());
+    REQUIRE(header->getNumModels() == 0);
+    REQUIRE(header->getNumOutputs() == 0);
+    REQUIRE(handler.level == full->getLevel());
+    REQUIRE(handler.numModels == full->getNumModels());
+    REQUIRE(handler.numOutputs == full->getNumOutputs());
+    REQUIRE(handler.ids.front() == full->getSimulation(0)->getId());
+    delete header;
+
+    // stop after the first element
+    CountingStreamHandler first(1);
+    header = reader.streamSedML(fileName, first);
+    REQUIRE(first.numElements == 1);
+    delete header;
+
+    delete full;
+}
+
+
+TEST_CASE("reading only selected top-level lists", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/noble_1962_local.sedml");
+    SedDocument* full = readSedMLFromFile(fileName.c_str());
+
+    std::set<std::string> lists;
+    lists.insert("listOfDataGenerators");
+    lists.insert("listOfOutputs");
+
+    SedReader reader;
+    reader.setListsToRead(lists);
+    SedDocument* doc = reader.readSedMLFromFile(fileName);
+    REQUIRE(doc->getNumErrors() == full->getNumErrors());
+    REQUIRE(doc->getNumModels() == 0);
+    REQUIRE(doc->getNumTasks() == 0);
+    REQUIRE(doc->getNumDataGenerators() == full->getNumDataGenerators());
+    REQUIRE(doc->getNumOutputs() == full->getNumOutputs());
+    REQUIRE(doc->getSkippedList("listOfModels") == NULL);
+    delete doc;
+
+    // kept lists are written back out unchanged
+    reader.setKeepSkippedLists(true);
+    doc = reader.readSedMLFromFile(fileName);
+    REQUIRE(doc->getNumModels() == 0);
+    REQUIRE(doc->getSkippedList("listOfModels") != NULL);
+    REQUIRE(doc->getSkippedList("listOfOutputs") == NULL);
+
+    SedWriter sw;
+    SedDocument* roundtrip = readSedMLFromString(sw.writeSedMLToStdString(doc).c_str());
+    REQUIRE(roundtrip->getNumModels() == full->getNumModels());
+    REQUIRE(roundtrip->getNumTasks() == full->getNumTasks());
+    REQUIRE(sw.writeSedMLToStdString(roundtrip) == sw.writeSedMLToStdString(full));
+
+    delete roundtrip;
+    delete doc;
+    delete full;
+}
+
+
+TEST_CASE("math is parsed on first use", "[sedml]")
+{
+    std::string fileName = getTestFile("/test-data/noble_1962_local.sedml");
+    SedDocument* doc = readSedMLFromFile(fileName.c_str());
+    REQUIRE(doc->getNumDataGenerators() > 0);
+
+    // an unchanged document is written back from the retained MathML
+    SedWriter sw;
+    std::string xml = sw.writeSedMLToStdString(doc);
+    SedDocument* copy = readSedMLFromString(xml.c_str());
+    REQUIRE(copy->getNumErrors() == 0);
+    REQUIRE(sw.writeSedMLToStdString(copy) == xml);
+
+    const SedDataGenerator* dg = doc->getDataGenerator(0);
+    REQUIRE(dg->isSetMath());
+    REQUIRE(dg->getMath() != NULL);
+    char* parsed = SBML_formulaToL3String(dg->getMath());
+    std::string formula = parsed;
+    free(parsed);
+
+    // clones parse the shared MathML on their own
+    SedDataGenerator* clone = dg->clone();
+    char* cloned = SBML_formulaToL3String(clone->getMath());
+    REQUIRE(formula == cloned);
+    free(cloned);
+
+    // replacing the math writes the new math
+    ASTNode* math = SBML_parseL3Formula("renamed_variable * 2");
+    REQUIRE(clone->setMath(math) == LIBSEDML_OPERATION_SUCCESS);
+    delete math;
+    char* written = clone->toSed();
+    REQUIRE(std::string(written).find("renamed_variable") != std::string::npos);
+    free(written);
+    clone->unsetMath();
+    REQUIRE(!clone->isSetMath());
+    REQUIRE(clone->getMath() == NULL);
+
+    delete clone;
+    delete copy;
+    delete doc;
+}
+
+
+TEST_CASE("math that fails to parse is reported on first use", "[sedml]")
+{
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<sedML xmlns=\"http://sed-ml.org/sed-ml/level1/version4\" level=\"1\" version=\"4\">\n"
+      "  <listOfDataGenerators>\n"
+      "    <dataGenerator id=\"dg\">\n"
+      "      <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+      "        <apply><notAnOperator/><ci> x </ci></apply>\n"
+      "      </math>\n"
+      "    </dataGenerator>\n"
+      "  </listOfDataGenerators>\n"
+      "</sedML>\n";
+
+    SedDocument* doc = readSedMLFromString(xml.c_str());
+    SedDataGenerator* dg = doc->getDataGenerator(0);
+    REQUIRE(dg->isSetMath());
+    unsigned int numErrors = doc->getNumErrors();
+
+    dg->renameSIdRefs("x", "y");
+    REQUIRE(dg->getMath() == NULL);
+    REQUIRE(!dg->isSetMath());
+    REQUIRE(doc->getNumErrors() > numErrors);
+
+    // the math is still written back as it was read
+    SedWriter sw;
+    REQUIRE(sw.writeSedMLToStdString(doc).find("notAnOperator") != std::string::npos);
+
+    delete doc;
+}
+
+
+TEST_CASE("copies share notes and annotations until modified", "[sedml]")
+{
+    SedModel model(1, 4);
+    model.setId("m1");
+    REQUIRE(model.setAnnotation("<annotation><ex:info xmlns:ex=\"http://www.example.org/\"/></annotation>") == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(model.setNotes("<notes><p xmlns=\"http://www.w3.org/1999/xhtml\">first</p></notes>") == LIBSEDML_OPERATION_SUCCESS);
+
+    SedModel copy(model);
+    const SedModel& constModel = model;
+    const SedModel& constCopy = copy;
+    REQUIRE(constCopy.getAnnotation() == constModel.getAnnotation());
+    REQUIRE(constCopy.getNotes() == constModel.getNotes());
+    REQUIRE(copy.getAnnotationString() == model.getAnnotationString());
+
+    // modifying the copy leaves the original alone
+    REQUIRE(copy.appendNotes("<p xmlns=\"http://www.w3.org/1999/xhtml\">second</p>") == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(constCopy.getNotes() != constModel.getNotes());
+    REQUIRE(copy.getNotesString().find("second") != std::string::npos);
+    REQUIRE(model.getNotesString().find("second") == std::string::npos);
+
+    REQUIRE(copy.removeTopLevelAnnotationElement("info") == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(!copy.isSetAnnotation());
+    REQUIRE(model.isSetAnnotation());
+}
+
+
+TEST_CASE("vector range values round-trip exactly", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedVectorRange* range = doc.createRepeatedTask()->createVectorRange();
+    range->setId("range");
+
+    std::vector<double> values;
+    values.push_back(0.1);
+    values.push_back(1.0 / 3.0);
+    values.push_back(-2.5e-300);
+    values.push_back(123456789012345678.0);
+    values.push_back(std::numeric_limits<double>::infinity());
+    REQUIRE(range->setValues(std::move(values)) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(values.empty());
+    REQUIRE(range->getNumValues() == 5);
+
+    char buffer[32];
+    SedVectorRange::formatValue(0.1, buffer);
+    REQUIRE(std::string(buffer) == "0.1");
+    double parsed = 0;
+    REQUIRE(SedVectorRange::parseValue("  2.5 ", parsed));
+    REQUIRE(parsed == 2.5);
+    REQUIRE(!SedVectorRange::parseValue(" abc", parsed));
+
+    char* xml = writeSedMLToString(&doc);
+    SedDocument* read = readSedMLFromString(xml);
+    free(xml);
+
+    SedRepeatedTask* task = static_cast<SedRepeatedTask*>(read->getTask(0));
+    const std::vector<double>& readValues =
+        static_cast<SedVectorRange*>(task->getRange(0))->getValues();
+    REQUIRE(readValues == range->getValues());
+
+    const double raw[] = { 1.0, 2.0, 3.0 };
+    REQUIRE(range->setValues(raw, 3) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(range->getNumValues() == 3);
+    REQUIRE(range->setValues(NULL, 1) == LIBSEDML_INVALID_OBJECT);
+
+    delete read;
+}
+
+
+TEST_CASE("vector range values stored in binary", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedVectorRange* range = doc.createRepeatedTask()->createVectorRange();
+    range->setId("range");
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.push_back(i / 7.0);
+    }
+    range->setValues(values);
+    REQUIRE(range->setValuesEncoding(SEDML_VALUESENCODING_EXTERNAL) == LIBSEDML_OPERATION_FAILED);
+
+    // embedded as base64
+    REQUIRE(range->setValuesEncoding(SEDML_VALUESENCODING_BASE64) == LIBSEDML_OPERATION_SUCCESS);
+    char* xml = writeSedMLToString(&doc);
+    REQUIRE(std::string(xml).find("<value>") == std::string::npos);
+    SedDocument* read = readSedMLFromString(xml);
+    free(xml);
+    SedVectorRange* readRange = static_cast<SedVectorRange*>(
+        static_cast<SedRepeatedTask*>(read->getTask(0))->getRange(0));
+    REQUIRE(readRange->getValuesEncoding() == SEDML_VALUESENCODING_BASE64);
+    REQUIRE(readRange->getValues() == values);
+    delete read;
+
+    // in a file next to the document, read back through a mapping
+    REQUIRE(range->writeValuesFile("vector_range_values.bin") == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(range->getValuesSource() == "vector_range_values.bin");
+    REQUIRE(writeSedML(&doc, "vector_range_values.sedml") == 1);
+    read = readSedML("vector_range_values.sedml");
+    readRange = static_cast<SedVectorRange*>(
+        static_cast<SedRepeatedTask*>(read->getTask(0))->getRange(0));
+    REQUIRE(read->getNumErrors() == 0);
+    REQUIRE(readRange->getValuesEncoding() == SEDML_VALUESENCODING_EXTERNAL);
+    REQUIRE(readRange->getNumValues() == 1000);
+    REQUIRE(readRange->getValuesData()[999] == values[999]);
+
+    // modifying the values detaches them from the file
+    REQUIRE(readRange->addValue(1.0) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(!readRange->isSetValuesSource());
+    REQUIRE(readRange->getValuesEncoding() == SEDML_VALUESENCODING_TEXT);
+    REQUIRE(readRange->getNumValues() == 1001);
+    delete read;
+
+    // for export, the values are written as SED-ML again
+    REQUIRE(range->setValuesEncoding(SEDML_VALUESENCODING_TEXT) == LIBSEDML_OPERATION_SUCCESS);
+    xml = writeSedMLToString(&doc);
+    REQUIRE(std::string(xml).find("binaryValues") == std::string::npos);
+    free(xml);
+
+    std::remove("vector_range_values.bin");
+    std::remove("vector_range_values.sedml");
+}
+
+
+TEST_CASE("moving documents and elements does not copy them", "[sedml]")
+{
+    SedDocument* doc = new SedDocument(1, 4);
+    for (int i = 0; i < 100; ++i)
+    {
+        std::unique_ptr<SedModel> model(new SedModel(1, 4));
+        model->setId("m" + std::to_string(i));
+        REQUIRE(doc->getListOfModels()->appendAndOwn(std::move(model)) == LIBSEDML_OPERATION_SUCCESS);
+        REQUIRE(model.get() == NULL);
+    }
+
+    // a rejected item stays with the caller
+    std::unique_ptr<SedTask> task(new SedTask(1, 4));
+    REQUIRE(doc->getListOfModels()->appendAndOwn(std::move(task)) == LIBSEDML_INVALID_OBJECT);
+    REQUIRE(task.get() != NULL);
+
+    SedModel* first = doc->getModel("m0");
+    REQUIRE(first != NULL);
+
+    SedDocument moved(std::move(*doc));
+    REQUIRE(doc->getNumModels() == 0);
+    REQUIRE(doc->getModel("m0") == NULL);
+    delete doc;
+
+    REQUIRE(moved.getNumModels() == 100);
+    REQUIRE(moved.getModel("m0") == first);
+    REQUIRE(first->getSedDocument() == &moved);
+    REQUIRE(moved.getModel("m99")->getId() == "m99");
+
+    SedDocument assigned(1, 4);
+    assigned.createModel()->setId("other");
+    assigned = std::move(moved);
+    REQUIRE(assigned.getModel("other") == NULL);
+    REQUIRE(assigned.getModel("m0") == first);
+    REQUIRE(moved.getNumModels() == 0);
+
+    SedStyle style(1, 4);
+    style.setId("style");
+    SedLine* line = style.createLineStyle();
+    SedStyle movedStyle(std::move(style));
+    REQUIRE(movedStyle.getId() == "style");
+    REQUIRE(movedStyle.getLineStyle() == line);
+    REQUIRE(!style.isSetLineStyle());
+}
+
+
+TEST_CASE("moving elements out of a document takes their children along", "[sedml]")
+{
+    SedDocument* doc = new SedDocument(1, 4);
+    SedRepeatedTask* task = doc->createRepeatedTask();
+    task->setId("r1");
+    task->createVectorRange()->setId("range");
+    task->createSubTask()->setId("sub");
+    SedPlot2D* plot = doc->createPlot2D();
+    plot->setId("plot");
+    plot->createCurve()->setId("curve");
+    plot->createXAxis()->setId("axis");
+
+    REQUIRE(doc->getElementBySId("range") != NULL);
+    REQUIRE(doc->getElementBySId("axis") != NULL);
+
+    SedRepeatedTask movedTask(std::move(*task));
+    SedPlot2D movedPlot(1, 4);
+    movedPlot = std::move(*plot);
+
+    // the document no longer finds what it does not own
+    REQUIRE(doc->getElementBySId("r1") == NULL);
+    REQUIRE(doc->getElementBySId("range") == NULL);
+    REQUIRE(doc->getElementBySId("sub") == NULL);
+    REQUIRE(doc->getElementBySId("curve") == NULL);
+    REQUIRE(doc->getElementBySId("axis") == NULL);
+    REQUIRE(doc->getNumTasks() == 1);
+
+    // the moved elements outlive the document
+    delete doc;
+    REQUIRE(movedTask.getRange(0)->getId() == "range");
+    REQUIRE(movedTask.getSubTask(0)->getId() == "sub");
+    REQUIRE(movedPlot.getCurve(0)->getId() == "curve");
+    REQUIRE(movedPlot.getXAxis()->getId() == "axis");
+}
+
+
+TEST_CASE("copy-on-write clones share unmodified lists", "[sedml]")
+{
+    SedDocument* doc = new SedDocument(1, 4);
+    for (int i = 0; i < 50; ++i)
+    {
+        SedModel* model = doc->createModel();
+        model->setId("m" + std::to_string(i));
+        model->setLanguage("urn:sedml:language:sbml");
+        model->setSource("model.xml");
+        SedTask* task = doc->createTask();
+        task->setId("t" + std::to_string(i));
+        task->setModelReference(model->getId());
+    }
+    doc->createReport()->setId("report");
+
+    std::shared_ptr<const SedDocument> base(doc);
+    char* baseXml = writeSedMLToString(doc);
+
+    SedDocument* variant = SedDocument::cloneOnWrite(base);
+    const SedDocument* constVariant = variant;
+    REQUIRE(constVariant->getListOfModels() == base->getListOfModels());
+    REQUIRE(constVariant->getNumTasks() == 50);
+    REQUIRE(constVariant->getOutput("report") == base->getOutput("report"));
+
+    char* xml = writeSedMLToString(variant);
+    REQUIRE(std::string(xml) == baseXml);
+    free(xml);
+
+    // modifying a task copies the tasks only
+    static_cast<SedTask*>(variant->getTask("t3"))->setModelReference("m4");
+    REQUIRE(constVariant->getListOfTasks() != base->getListOfTasks());
+    REQUIRE(constVariant->getListOfModels() == base->getListOfModels());
+    REQUIRE(static_cast<const SedTask*>(base->getTask("t3"))->getModelReference() == "m3");
+    REQUIRE(variant->getTask("t3")->getSedDocument() == variant);
+
+    // clones of the clone keep sharing the lists of the base
+    SedDocument* copy = variant->clone();
+    const SedDocument* constCopy = copy;
+    REQUIRE(constCopy->getListOfModels() == base->getListOfModels());
+    REQUIRE(static_cast<const SedTask*>(constCopy->getTask("t3"))->getModelReference() == "m4");
+    delete variant;
+
+    // looking elements up by id copies only the list holding the element
+    REQUIRE(copy->getElementBySId("missing") == NULL);
+    REQUIRE(constCopy->getListOfModels() == base->getListOfModels());
+    REQUIRE(copy->getElementBySId("m7") != base->getModel("m7"));
+    REQUIRE(copy->getElementBySId("m7")->getSedDocument() == copy);
+    REQUIRE(constCopy->getListOfModels() != base->getListOfModels());
+    REQUIRE(constCopy->getListOfOutputs() == base->getListOfOutputs());
+    REQUIRE(base->getModel("m7")->getSedDocument() == base.get());
+    REQUIRE(copy->getElementBySId("t3") == copy->getTask("t3"));
+    REQUIRE(constCopy->getListOfOutputs() == base->getListOfOutputs());
+    delete copy;
+
+    xml = writeSedMLToString(base.get());
+    REQUIRE(std::string(xml) == baseXml);
+    free(xml);
+    free(baseXml);
+}
+
+
+TEST_CASE("resolved styles are cached until their chain changes", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedStyle* base = doc.createStyle();
+    base->setId("base");
+    base->createLineStyle()->setColor("FF0000");
+    base->getLineStyle()->setThickness(2);
+    SedStyle* middle = doc.createStyle();
+    middle->setId("middle");
+    middle->setBaseStyle("base");
+    middle->createLineStyle()->setThickness(3);
+    SedStyle* top = doc.createStyle();
+    top->setId("top");
+    top->setBaseStyle("middle");
+    top->createMarkerStyle()->setSize(4);
+    SedStyle* other = doc.createStyle();
+    other->setId("other");
+    other->setBaseStyle("base");
+
+    const SedStyle* resolved = doc.getResolvedStyle("top");
+    REQUIRE(resolved != NULL);
+    REQUIRE(resolved->getId() == "top");
+    REQUIRE(!resolved->isSetBaseStyle());
+    REQUIRE(resolved->getLineStyle()->getColor() == "FF0000");
+    REQUIRE(resolved->getLineStyle()->getThickness() == 3);
+    REQUIRE(resolved->getMarkerStyle()->getSize() == 4);
+    REQUIRE(doc.getResolvedStyle("top") == resolved);
+    REQUIRE(doc.getResolvedStyle("missing") == NULL);
+
+    // changing a style of the chain, however deep, resolves it again
+    // into a new SedStyle, the one handed out before is left as it was
+    base->getLineStyle()->setColor("00FF00");
+    const SedStyle* updated = doc.getResolvedStyle("top");
+    REQUIRE(updated != resolved);
+    REQUIRE(updated->getLineStyle()->getColor() == "00FF00");
+    REQUIRE(resolved->getLineStyle()->getColor() == "FF0000");
+    REQUIRE(doc.getResolvedStyle("top") == updated);
+    REQUIRE(doc.getEffectiveStyle("other").getLineStyle()->getColor() == "00FF00");
+
+    // as does a base style going missing
+    middle->setId("renamed");
+    REQUIRE(!doc.getResolvedStyle("top")->isSetLineStyle());
+    middle->setId("middle");
+    REQUIRE(doc.getResolvedStyle("top")->getLineStyle()->getThickness() == 3);
+
+    // cycles in the baseStyle chain are cut instead of recursing forever
+    base->setBaseStyle("top");
+    SedStyle effective = doc.getEffectiveStyle("top");
+    REQUIRE(effective.getLineStyle()->getThickness() == 3);
+    REQUIRE(effective.getLineStyle()->getColor() == "00FF00");
+    REQUIRE(doc.getEffectiveStyle("base").getMarkerStyle()->getSize() == 4);
+    REQUIRE(doc.getEffectiveStyle("middle").getLineStyle()->getThickness() == 3);
+}
+
+
+TEST_CASE("error log counts errors by id and severity", "[sedml]")
+{
+    SedErrorLog log;
+    for (int i = 0; i < 1000; ++i)
+    {
+        log.logError(SedUnknownCoreAttribute, 1, 4, "attribute " + std::to_string(i));
+    }
+    log.logError(SedNotUTF8, 1, 4, "details");
+    // errors logged through the base class, as the XML parser does, count too
+    static_cast<XMLErrorLog&>(log).add(SedError(SedNotUTF8, 1, 4));
+
+    REQUIRE(log.getNumErrors() == 1002);
+    REQUIRE(log.contains(SedUnknownCoreAttribute));
+    REQUIRE(!log.contains(SedUnrecognizedElement));
+    REQUIRE(log.getNumFailsWithSeverity(LIBSEDML_SEV_ERROR) == 1002);
+    REQUIRE(log.getNumFailsWithSeverity(LIBSEDML_SEV_WARNING) == 0);
+
+    // the message is only put together when asked for
+    const SedError* error = log.getError(1000);
+    REQUIRE(error->getShortMessage() == "File does not use UTF-8 encoding");
+    REQUIRE(error->getMessage().find("must use UTF-8") != std::string::npos);
+    REQUIRE(error->getMessage().find(" details") != std::string::npos);
+    REQUIRE(static_cast<const XMLError*>(error)->getMessage() == error->getMessage());
+    SedError direct(SedNotUTF8, 1, 4, "details");
+    direct.getMessage();
+    REQUIRE(static_cast<const XMLError&>(direct).getMessage() == direct.getMessage());
+
+    log.remove(SedNotUTF8);
+    REQUIRE(log.getNumErrors() == 1001);
+    REQUIRE(log.contains(SedNotUTF8));
+    REQUIRE(log.getError(1000)->getMessage().find("details") == std::string::npos);
+
+    log.removeAll(SedUnknownCoreAttribute);
+    REQUIRE(log.getNumErrors() == 1);
+    REQUIRE(!log.contains(SedUnknownCoreAttribute));
+    REQUIRE(log.getNumFailsWithSeverity(LIBSEDML_SEV_ERROR) == 1);
+    REQUIRE(log.getErrorWithSeverity(1, LIBSEDML_SEV_ERROR) == NULL);
+
+    log.clearLog();
+    REQUIRE(log.getNumFailsWithSeverity(LIBSEDML_SEV_ERROR) == 0);
+    REQUIRE(!log.contains(SedNotUTF8));
+}
+
+
+TEST_CASE("reading stops at the error limits", "[sedml]")
+{
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<sedML xmlns=\"http://sed-ml.org/sed-ml/level1/version4\" level=\"1\" version=\"4\">\n"
+      "  <listOfModels>\n";
+    for (int i = 0; i < 10; ++i)
+    {
+        xml += "    <model id=\"m" + std::to_string(i) + "\" language=\"urn:sedml:language:sbml\""
+               " source=\"model.xml\" unknown=\"x\"/>\n";
+    }
+    xml += "  </listOfModels>\n</sedML>\n";
+
+    SedReader reader;
+    REQUIRE(reader.getMaxErrors() == 0);
+    REQUIRE(reader.getFailFastSeverity() == LIBSEDML_SEV_NOT_APPLICABLE);
+    SedDocument* doc = reader.readSedMLFromString(xml);
+    REQUIRE(doc->getNumModels() == 10);
+    REQUIRE(doc->getErrorLog()->getNumFailsWithSeverity(LIBSEDML_SEV_ERROR) == 10);
+    delete doc;
+
+    // a partial document is returned with the errors read so far
+    reader.setMaxErrors(3);
+    doc = reader.readSedMLFromString(xml);
+    REQUIRE(doc->getNumModels() == 3);
+    REQUIRE(doc->getErrorLog()->getNumFailsWithSeverity(LIBSEDML_SEV_ERROR) == 3);
+    delete doc;
+
+    reader.setMaxErrors(0);
+    reader.setFailFastSeverity(LIBSEDML_SEV_ERROR);
+    doc = reader.readSedMLFromString(xml);
+    REQUIRE(doc->getNumModels() == 1);
+    REQUIRE(doc->getNumErrors() == 1);
+    delete doc;
+
+    // errors below the severity do not stop reading
+    reader.setFailFastSeverity(LIBSEDML_SEV_FATAL);
+    doc = reader.readSedMLFromString(xml);
+    REQUIRE(doc->getNumModels() == 10);
+    delete doc;
+}
+
+
+TEST_CASE("KiSAO terms are looked up in the compiled table", "[sedml]")
+{
+    REQUIRE(std::string(getKisaoName(19)) == "CVODE");
+    REQUIRE(getKisaoName(1) == NULL);
+    REQUIRE(getKisaoName(-1) == NULL);
+    REQUIRE(getKisaoName(100000) == NULL);
+
+    REQUIRE(isKisaoKindOf(19, 433));
+    REQUIRE(isKisaoKindOf(19, 19));
+    REQUIRE(isKisaoKindOf(27, 0));
+    REQUIRE(!isKisaoKindOf(433, 19));
+    REQUIRE(!isKisaoKindOf(19, 29));
+
+    // LSODA and LSODE share a parent, CVODE and the Gillespie direct method
+    // only the root of the ontology
+    std::vector<int> supported;
+    supported.push_back(29);
+    supported.push_back(88);
+    REQUIRE(getKisaoSubstitute(71, supported) == 88);
+    REQUIRE(getKisaoSubstitute(19, supported) == -1);
+    supported.push_back(71);
+    REQUIRE(getKisaoSubstitute(71, supported) == 71);
+
+    SedAlgorithm alg(1, 4);
+    alg.setKisaoID(19);
+    REQUIRE(alg.getName() == "CVODE");
+    REQUIRE(alg.isKisaoIDKindOf(433));
+    REQUIRE(alg.getKisaoIDSubstitute(supported) == -1);
+}
+
+
+TEST_CASE("repeated tasks expand their ranges on demand", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedTask* task = doc.createTask();
+    task->setId("t1");
+
+    SedRepeatedTask* inner = doc.createRepeatedTask();
+    inner->setId("r2");
+    inner->setRangeId("w");
+    SedVectorRange* w = inner->createVectorRange();
+    w->setId("w");
+    w->addValue(10);
+    w->addValue(20);
+    inner->createSubTask()->setTask("t1");
+
+    SedRepeatedTask* outer = doc.createRepeatedTask();
+    outer->setId("r1");
+    outer->setRangeId("u");
+    SedUniformRange* u = outer->createUniformRange();
+    u->setId("u");
+    u->setStart(0);
+    u->setEnd(10);
+    u->setNumberOfSteps(5);
+    u->setType("linear");
+    SedUniformRange* l = outer->createUniformRange();
+    l->setId("l");
+    l->setStart(1);
+    l->setEnd(100);
+    l->setNumberOfSteps(2);
+    l->setType("log");
+    SedVectorRange* v = outer->createVectorRange();
+    v->setId("v");
+    v->addValue(1);
+    v->addValue(2);
+    v->addValue(3);
+    SedFunctionalRange* f = outer->createFunctionalRange();
+    f->setId("f");
+    f->setRange("u");
+    SedParameter* p = f->createParameter();
+    p->setId("p");
+    p->setValue(2);
+    ASTNode* math = SBML_parseL3Formula("u * p + v");
+    f->setMath(math);
+    delete math;
+
+    // the plain task runs after the nested repeated task
+    SedSubTask* subTask = outer->createSubTask();
+    subTask->setTask("t1");
+    subTask->setOrder(2);
+    subTask = outer->createSubTask();
+    subTask->setTask("r2");
+    subTask->setOrder(1);
+
+    SedRangeExpansion expansion(*outer);
+    REQUIRE(expansion.getNumIterations() == 6);
+    REQUIRE(expansion.getValue(5, "u") == 10);
+    REQUIRE(expansion.getValue(1, "l") == Approx(10));
+    REQUIRE(expansion.getValue(2, "v") == 3);
+    REQUIRE(std::isnan(expansion.getValue(3, "v")));
+    REQUIRE(expansion.getValue(1, "f") == 6);
+    REQUIRE(std::isnan(expansion.getValue(3, "f")));
+    REQUIRE(std::isnan(expansion.getValue(0, "x")));
+
+    double sum = 0;
+    for (SedRangeExpansion::const_iterator it = expansion.begin();
+         it != expansion.end(); ++it)
+    {
+        sum += (*it).getValue("u");
+    }
+    REQUIRE(sum == 30);
+
+    // two steps of the nested task, then one of the plain task, per iteration
+    REQUIRE(expansion.getNumSubTasks() == 2);
+    REQUIRE(expansion.getSubExpansion(0) != NULL);
+    REQUIRE(expansion.getSubExpansion(1) == NULL);
+    REQUIRE(expansion.getNumSteps() == 18);
+
+    SedRangeStep step;
+    expansion.getStep(4, step);
+    REQUIRE(step.getTask() == task);
+    REQUIRE(step.getNumLevels() == 2);
+    REQUIRE(step.getIteration(0) == 1);
+    REQUIRE(step.getIteration(1) == 1);
+    REQUIRE(step.getValue("u") == 2);
+    REQUIRE(step.getValue("w") == 20);
+
+    expansion.getStep(5, step);
+    REQUIRE(step.getTask() == task);
+    REQUIRE(step.getNumLevels() == 1);
+    REQUIRE(std::isnan(step.getValue("w")));
+
+    expansion.getStep(18, step);
+    REQUIRE(step.getTask() == NULL);
+
+    // a functional range referring to itself has no values
+    ASTNode* cycle = SBML_parseL3Formula("f + 1");
+    f->setMath(cycle);
+    delete cycle;
+    SedRangeExpansion cyclic(*outer);
+    REQUIRE(std::isnan(cyclic.getValue(0, "f")));
+    REQUIRE(cyclic.getValue(0, "u") == 0);
+}
+
+TEST_CASE("compiled math evaluates single rows and batches", "[sedml]")
+{
+    std::vector<std::string> names;
+    names.push_back("x");
+    names.push_back("y");
+
+    SedDocument doc(1, 4);
+    SedRepeatedTask* task = doc.createRepeatedTask();
+    SedFunctionalRange* range = task->createFunctionalRange();
+    SedParameter* p = range->createParameter();
+    p->setId("p");
+    p->setValue(3);
+
+    SedCompiledMath compiled;
+    ASTNode* math = SBML_parseL3Formula(
+        "piecewise(x * p + y, x < y, max(x, y) - 2 ^ y)");
+    REQUIRE(compiled.compile(math, names, range->getListOfParameters())
+            == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(compiled.isCompiled());
+    REQUIRE(compiled.getNumSlots() == 2);
+    REQUIRE(compiled.getSlot("y") == 1);
+    REQUIRE(compiled.getSlot("p") == -1);
+
+    double slots[] = { 1, 2 };
+    REQUIRE(compiled.evaluate(slots) == 5);
+    slots[0] = 4;
+    REQUIRE(compiled.evaluate(slots) == 0);
+
+    // more rows than fit in one block
+    std::vector<double> x(100), y(100), results(100);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = i % 7;
+        y[i] = i % 5;
+    }
+    const double* columns[] = { &x[0], &y[0] };
+    compiled.evaluate(columns, x.size(), &results[0]);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        slots[0] = x[i];
+        slots[1] = y[i];
+        REQUIRE(results[i] == compiled.evaluate(slots));
+    }
+    delete math;
+
+    // names neither bound to slots nor parameters are rejected
+    math = SBML_parseL3Formula("x + z");
+    REQUIRE(compiled.compile(math, names) == LIBSEDML_INVALID_OBJECT);
+    REQUIRE(!compiled.isCompiled());
+    REQUIRE(std::isnan(compiled.evaluate(slots)));
+    delete math;
+
+    // variables of a functional range come first
+    SedVariable* variable = range->createVariable();
+    variable->setId("v");
+    math = SBML_parseL3Formula("v / x - p");
+    range->setMath(math);
+    delete math;
+    REQUIRE(compiled.compile(*range, names) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(compiled.getNumSlots() == 3);
+    REQUIRE(compiled.getSlot("v") == 0);
+    double values[] = { 8, 2, 0 };
+    REQUIRE(compiled.evaluate(values) == 1);
+}
+
+TEST_CASE("data generators are evaluated over whole columns", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("normalized");
+    SedVariable* x = dg->createVariable();
+    x->setId("x");
+    SedVariable* y = dg->createVariable();
+    y->setId("y");
+    SedParameter* p = dg->createParameter();
+    p->setId("p");
+    p->setValue(2);
+    ASTNode* math = SBML_parseL3Formula(
+        "(x - mean(x)) / (max(x) - min(x)) + p * y + sum(y)");
+    dg->setMath(math);
+    delete math;
+
+    SedCompiledMath compiled;
+    REQUIRE(compiled.compile(*dg) == LIBSEDML_OPERATION_SUCCESS);
+    REQUIRE(compiled.getNumSlots() == 2);
+
+    std::vector<double> xs(1001), ys(1001, 0.0), results(1001);
+    for (size_t i = 0; i < xs.size(); ++i)
+    {
+        xs[i] = (double)i;
+    }
+    ys[3] = 1;
+    const double* columns[] = { &xs[0], &ys[0] };
+    compiled.evaluate(columns, xs.size(), &results[0]);
+    REQUIRE(results[0] == Approx(0.5));
+    REQUIRE(results[3] == Approx(2.503));
+    REQUIRE(results[1000] == Approx(1.5));
+
+    // a single row aggregates to its own value
+    double row[] = { 4, 1 };
+    REQUIRE(std::isnan(compiled.evaluate(row)));
+
+    math = SBML_parseL3Formula("sum(x - mean(x)) + max(x)");
+    dg->setMath(math);
+    delete math;
+    REQUIRE(compiled.compile(*dg) == LIBSEDML_OPERATION_SUCCESS);
+    compiled.evaluate(columns, xs.size(), &results[0]);
+    REQUIRE(results[10] == Approx(1000));
+    REQUIRE(compiled.evaluate(row) == 4);
+
+    math = SBML_parseL3Formula("median(x)");
+    dg->setMath(math);
+    delete math;
+    REQUIRE(compiled.compile(*dg) == LIBSEDML_INVALID_OBJECT);
+}
+
+TEST_CASE("execution plans split documents into stages", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    SedModel* m1 = doc.createModel();
+    m1->setId("m1");
+    m1->setSource("model.xml");
+    SedModel* m2 = doc.createModel();
+    m2->setId("m2");
+    m2->setSource("#m1");
+    SedModel* m3 = doc.createModel();
+    m3->setId("m3");
+    m3->setSource("#m4");
+    SedModel* m4 = doc.createModel();
+    m4->setId("m4");
+    m4->setSource("m3");
+    SedUniformTimeCourse* s1 = doc.createUniformTimeCourse();
+    s1->setId("s1");
+
+    SedTask* t1 = doc.createTask();
+    t1->setId("t1");
+    t1->setModelReference("m2");
+    t1->setSimulationReference("s1");
+    SedTask* t2 = doc.createTask();
+    t2->setId("t2");
+    t2->setModelReference("m1");
+    t2->setSimulationReference("s1");
+    SedTask* t3 = doc.createTask();
+    t3->setId("t3");
+    t3->setModelReference("m2");
+    t3->setSimulationReference("s1");
+
+    // the tasks of the sub-tasks run as part of the repeated task
+    SedRepeatedTask* r1 = doc.createRepeatedTask();
+    r1->setId("r1");
+    r1->setResetModel(true);
+    SedSubTask* subTask = r1->createSubTask();
+    subTask->setTask("t1");
+    subTask->setOrder(1);
+    subTask = r1->createSubTask();
+    subTask->setTask("t3");
+    subTask->setOrder(1);
+    subTask = r1->createSubTask();
+    subTask->setTask("t2");
+    subTask->setOrder(1);
+
+    SedRepeatedTask* r2 = doc.createRepeatedTask();
+    r2->setId("r2");
+    r2->createSubTask()->setTask("r2");
+
+    SedDataGenerator* d1 = doc.createDataGenerator();
+    d1->setId("d1");
+    d1->createVariable()->setTaskReference("r1");
+    SedDataGenerator* d2 = doc.createDataGenerator();
+    d2->setId("d2");
+    d2->createVariable()->setTaskReference("t2");
+    SedReport* report = doc.createReport();
+    report->setId("report");
+    report->createDataSet()->setDataReference("d1");
+
+    SedExecutionPlan plan(doc);
+    REQUIRE(plan.getNumStages() == 5);
+    REQUIRE(plan.getStage(0).size() == 2);
+    REQUIRE(plan.getStage(0)[0] == m1);
+    REQUIRE(plan.getStage(0)[1] == s1);
+    REQUIRE(plan.getStageIndex(m2) == 1);
+    REQUIRE(plan.getStageIndex(t2) == 1);
+    REQUIRE(plan.getStageIndex(t1) == 2);
+    REQUIRE(plan.getStageIndex(r1) == 2);
+    REQUIRE(plan.getStageIndex(d2) == 2);
+    REQUIRE(plan.getStageIndex(d1) == 3);
+    REQUIRE(plan.getStageIndex(report) == 4);
+    REQUIRE(plan.getStage(5).empty());
+
+    REQUIRE(plan.getDependencies(r1).size() == 3);
+    REQUIRE(plan.getDependencies(m2).size() == 1);
+    REQUIRE(plan.getDependencies(m2)[0] == m1);
+
+    // models derived from each other and tasks running themselves
+    REQUIRE(plan.getNumUnscheduled() == 3);
+    REQUIRE(plan.getUnscheduled(0) == m3);
+    REQUIRE(plan.getUnscheduled(1) == m4);
+    REQUIRE(plan.getUnscheduled(2) == r2);
+    REQUIRE(plan.getStageIndex(r2) == -1);
+
+    // t1 and t3 run the same model
+    std::vector<std::vector<const SedSubTask*> > stages;
+    plan.getSubTaskStages(*r1, stages);
+    REQUIRE(stages.size() == 2);
+    REQUIRE(stages[0].size() == 1);
+    REQUIRE(stages[0][0]->getTask() == "t1");
+    REQUIRE(stages[1].size() == 2);
+    REQUIRE(stages[1][1]->getTask() == "t2");
+    REQUIRE(plan.hasIndependentIterations(*r1));
+}
+
+TEST_CASE("documents are pruned to the elements of some outputs", "[sedml]")
+{
+    SedDocument doc(1, 4);
+    doc.createModel()->setId("m1");
+    doc.createModel()->setId("m2");
+    doc.createUniformTimeCourse()->setId("s1");
+    doc.createUniformTimeCourse()->setId("s2");
+
+    SedTask* task = doc.createTask();
+    task->setId("t1");
+    task->setModelReference("m1");
+    task->setSimulationReference("s1");
+    task = doc.createTask();
+    task->setId("t2");
+    task->setModelReference("m2");
+    task->setSimulationReference("s2");
+    SedRepeatedTask* repeated = doc.createRepeatedTask();
+    repeated->setId("r1");
+    repeated->createSubTask()->setTask("t1");
+
+    SedDataGenerator* dg = doc.createDataGenerator();
+    dg->setId("d1");
+    dg->createVariable()->setTaskReference("r1");
+    dg = doc.createDataGenerator();
+    dg->setId("d2");
+    dg->createVariable()->setTaskReference("t2");
+
+    SedReport* report = doc.createReport();
+    report->setId("report1");
+    report->createDataSet()->setDataReference("d1");
+    report = doc.createReport();
+    report->setId("report2");
+    report->createDataSet()->setDataReference("d2");
+
+    std::vector<std::string> ids;
+    ids.push_back("report1");
+    ids.push_back("unknown");
+
+    SedExecutionPlan plan(doc);
+    std::vector<const SedBase*> elements;
+    plan.getRequiredElements(ids, elements);
+    REQUIRE(elements.size() == 6);
+    REQUIRE(elements[0] == doc.getModel("m1"));
+    REQUIRE(elements[2] == doc.getTask("t1"));
+    REQUIRE(elements[5] == doc.getOutput("report1"));
+
+    SedDocument* pruned = plan.createPrunedDocument(ids);
+    REQUIRE(pruned->getNumModels() == 1);
+    REQUIRE(pruned->getNumSimulations() == 1);
+    REQUIRE(pruned->getNumTasks() == 2);
+    REQUIRE(pruned->getTask("t1") != NULL);
+    REQUIRE(pruned->getTask("r1") != NULL);
+    REQUIRE(pruned->getNumDataGenerators() == 1);
+    REQUIRE(pruned->getNumOutputs() == 1);
+    REQUIRE(pruned->getOutput("report1") != NULL);
+    REQUIRE(doc.getNumOutputs() == 2);
+    delete pruned;
+}